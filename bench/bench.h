@@ -0,0 +1,101 @@
+/*
+ *
+ * bench.h - Minimal timing helpers for the termlib benchmark programs.
+ *
+ * Benchmarks are normal programs that time a function over a number of
+ * iterations and print the cost per call in nanoseconds. The iterations are
+ * split into up to BENCH_SAMPLES batches after a warmup, and the min, median,
+ * and 99th percentile of the per-call cost of each batch are reported.
+ *
+ * Set the BENCH_JSON environment variable to get one JSON object per line
+ * instead of a table, for example with `make bench-json`.
+ *
+ *
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define BENCH_SAMPLES 100
+
+// Monotonic clock in nanoseconds.
+static inline uint64_t bench_now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Whether results are printed as JSON.
+static inline int bench_json(void) {
+	const char *s = getenv("BENCH_JSON");
+	return s && *s && *s != '0';
+}
+
+// Print name as a JSON string.
+static inline void bench_json_str(const char *name) {
+	putchar('"');
+	for (const char *p = name; *p; p++) {
+		if (*p == '"' || *p == '\\') putchar('\\');
+		if ((unsigned char)*p >= ' ') putchar(*p);
+	}
+	putchar('"');
+}
+
+// Report a result that isn't a timing, such as a size or a throughput.
+static inline void bench_report(const char *name, const char *unit, double value) {
+	if (!bench_json()) {
+		printf("%-40s %10.1f %s\n", name, value, unit);
+		return;
+	}
+	printf("{\"name\": ");
+	bench_json_str(name);
+	printf(", \"value\": %.1f, \"unit\": ", value);
+	bench_json_str(unit);
+	printf("}\n");
+}
+
+static int bench_cmp(const void *a, const void *b) {
+	double x = *(const double*)a, y = *(const double*)b;
+	return (x > y) - (x < y);
+}
+
+// Call fn(arg) iters times after a short warmup and print ns per call.
+// Returns the median ns per call.
+static inline double bench_run(const char *name, long iters,
+                               void (*fn)(void *), void *arg) {
+	for (long i = 0; i < iters / 10 + 1; i++) fn(arg);
+
+	int nsamples = iters < BENCH_SAMPLES ? (int)iters : BENCH_SAMPLES;
+	if (nsamples < 1) nsamples = 1;
+	long batch = iters / nsamples;
+	if (batch < 1) batch = 1;
+
+	double samples[BENCH_SAMPLES];
+	for (int s = 0; s < nsamples; s++) {
+		uint64_t start = bench_now();
+		for (long i = 0; i < batch; i++) fn(arg);
+		samples[s] = (double)(bench_now() - start) / batch;
+	}
+	qsort(samples, nsamples, sizeof(double), bench_cmp);
+
+	double min = samples[0];
+	double median = samples[nsamples / 2];
+	double p99 = samples[(nsamples * 99 - 1) / 100];
+
+	if (!bench_json()) {
+		printf("%-40s %10.1f ns/op  (min %.1f, p99 %.1f)\n",
+		       name, median, min, p99);
+		return median;
+	}
+	printf("{\"name\": ");
+	bench_json_str(name);
+	printf(", \"iters\": %ld, \"min_ns\": %.1f, \"median_ns\": %.1f, "
+	       "\"p99_ns\": %.1f}\n", batch * nsamples, min, median, p99);
+	return median;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,220 @@
+#include "../sgr.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct input {
+	const char *name;
+	struct sgr sgr;
+};
+
+static char buf[SGR_STR_MAX];
+static volatile int sink;
+
+static void str(void *arg) {
+	struct input *in = arg;
+	sink = sgr_str(buf, in->sgr);
+}
+
+struct strbuf {
+	int pos;
+	char *str;
+};
+
+static void strbuf_write(void *dest, char *src, int n) {
+	struct strbuf *buf = dest;
+	memcpy(buf->str + buf->pos, src, n);
+	buf->pos += n;
+}
+
+// Encoding with one callback per token from the sgr_unpack() codes, which
+// sgr_str() used before the single pass formatter.
+static int token_str(char *dest, struct sgr sgr) {
+	uint16_t codes[SGR_ELMS_MAX];
+	int ncodes = sgr_unpack(codes, sgr);
+	struct strbuf sb = {0, dest};
+	void (* volatile func)(void *, char *, int) = strbuf_write;
+	if (ncodes) {
+		char num[8];
+		func(&sb, SGR_OPEN, sizeof(SGR_OPEN) - 1);
+		for (int i = 0; i < ncodes; i++) {
+			if (i > 0) func(&sb, SGR_SEP, sizeof(SGR_SEP) - 1);
+			func(&sb, num, uitoa(codes[i], num));
+		}
+		func(&sb, SGR_CLOSE, sizeof(SGR_CLOSE) - 1);
+	}
+	dest[sb.pos] = '\0';
+	return sb.pos;
+}
+
+static void token(void *arg) {
+	struct input *in = arg;
+	sink = token_str(buf, in->sgr);
+}
+
+static void unpack(void *arg) {
+	struct input *in = arg;
+	uint16_t codes[SGR_ELMS_MAX];
+	sink = sgr_unpack(codes, in->sgr);
+}
+
+// A dashboard frame: rows of bold labels, values colored by status, and dim
+// separators on a shared background, written cell by cell.
+#define FRAME_W 80
+#define FRAME_H 24
+static struct sgr frame[FRAME_H * FRAME_W];
+
+static void frame_init(void) {
+	struct sgr label = {SGR_BOLD|SGR_FG256|SGR_BG256, 255, 236};
+	struct sgr ok = {SGR_FG256|SGR_BG256, 46, 236};
+	struct sgr bad = {SGR_BOLD|SGR_FG256|SGR_BG256, 196, 236};
+	struct sgr sep = {SGR_FAINT|SGR_FG256|SGR_BG256, 244, 236};
+	for (int y = 0; y < FRAME_H; y++) {
+		for (int x = 0; x < FRAME_W; x++) {
+			struct sgr *c = &frame[y * FRAME_W + x];
+			int col = x % 20;
+			if (col < 8)       *c = label;
+			else if (col < 10) *c = sep;
+			else if (col < 18) *c = (x + y) % 3 ? ok : bad;
+			else               *c = sep;
+		}
+	}
+}
+
+// Bytes for a frame sending sgr0 and the full attributes on every change.
+static long frame_reset(void) {
+	long n = 0;
+	struct sgr last = {0};
+	for (int i = 0; i < FRAME_H * FRAME_W; i++) {
+		if (memcmp(&frame[i], &last, sizeof(last)) == 0) continue;
+		n += strlen("\033[m") + sgr_str(buf, frame[i]);
+		last = frame[i];
+	}
+	return n;
+}
+
+static long frame_pen(void) {
+	long n = 0;
+	struct sgr_pen pen = {0};
+	for (int i = 0; i < FRAME_H * FRAME_W; i++) {
+		n += sgr_pen_str(&pen, buf, frame[i]);
+	}
+	return n;
+}
+
+static void frame_pen_fn(void *arg) {
+	(void)arg;
+	sink = frame_pen();
+}
+
+// A row of true color cells.
+#define ROW_W 200
+static struct sgr_quant *quant;
+static uint32_t row_rgb[ROW_W];
+static uint8_t row_idx[ROW_W];
+
+// Nearest color search over the whole 256-color palette for every cell.
+static void row_search(void *arg) {
+	(void)arg;
+	for (int i = 0; i < ROW_W; i++) {
+		uint32_t c = row_rgb[i];
+		row_idx[i] = sgr_nearest_256(c >> 16, (c >> 8) & 0xff, c & 0xff);
+	}
+}
+
+static void row_scalar(void *arg) {
+	(void)arg;
+	sgr_quant_row_path(quant, row_idx, row_rgb, ROW_W, SGR_PATH_SCALAR);
+}
+
+static void row_auto(void *arg) {
+	(void)arg;
+	sgr_quant_row(quant, row_idx, row_rgb, ROW_W);
+}
+
+// Colored log output: short styled words in long plain lines.
+#define LOG_SIZE (256 * 1024)
+static char *log_text;
+static size_t log_len;
+static struct sgr_cell log_cells[LOG_SIZE];
+
+static void log_init(void) {
+	log_text = malloc(LOG_SIZE + 256);
+	log_len = 0;
+	int line = 0;
+	while (log_len < LOG_SIZE) {
+		log_len += sprintf(log_text + log_len,
+			"\033[2m2024-05-01 12:00:%02d\033[0m \033[1;3%dmINFO\033[0m "
+			"worker %d: request handled in %d ms, status \033[38;5;%dm%d\033[39m "
+			"path /api/v1/items?page=%d\n",
+			line % 60, line % 7 + 1, line % 16, line * 7 % 1000,
+			line % 200 + 16, 200 + line % 5, line);
+		line++;
+	}
+}
+
+static void parse_log(void *arg) {
+	struct sgr_parser p;
+	sgr_parser_init(&p);
+	size_t used;
+	sink = sgr_parse_path(&p, log_cells, LOG_SIZE, log_text, log_len,
+	                      &used, *(int*)arg);
+}
+
+static void quant_new(void *arg) {
+	sgr_quant_free(sgr_quant_new(*(int*)arg));
+}
+
+int main(void) {
+	struct input inputs[] = {
+		{"reset",     {SGR_RESET, 0, 0}},
+		{"bold",      {SGR_BOLD, 0, 0}},
+		{"fg bg",     {SGR_FG|SGR_BG, SGR_RED, SGR_BLUE}},
+		{"fg16 bg16", {SGR_BOLD|SGR_FG16|SGR_BG16, SGR_RED, SGR_WHITE}},
+		{"fg256",     {SGR_UNDERLINE|SGR_FG256, 202, 0}},
+		{"fg16m bg16m", {SGR_RESET|SGR_BOLD|SGR_ITALIC|SGR_FG16M|SGR_BG16M,
+		                 0xff8000, 0x102030}},
+	};
+
+	char name[64];
+	for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+		snprintf(name, sizeof(name), "sgr_str %s", inputs[i].name);
+		bench_run(name, 1000000, str, &inputs[i]);
+		snprintf(name, sizeof(name), "per-token encode %s", inputs[i].name);
+		bench_run(name, 1000000, token, &inputs[i]);
+		snprintf(name, sizeof(name), "sgr_unpack %s", inputs[i].name);
+		bench_run(name, 1000000, unpack, &inputs[i]);
+	}
+
+	frame_init();
+	bench_report("dashboard frame sgr0+sgr_str", "bytes", frame_reset());
+	bench_report("dashboard frame sgr_pen_str", "bytes", frame_pen());
+	bench_run("dashboard frame sgr_pen_str", 10000, frame_pen_fn, NULL);
+
+	static int ncolors[] = {256, 16};
+	bench_run("sgr_quant_new 256", 200, quant_new, &ncolors[0]);
+	bench_run("sgr_quant_new 16", 200, quant_new, &ncolors[1]);
+	quant = sgr_quant_new(256);
+	for (int i = 0; i < ROW_W; i++) row_rgb[i] = (i * 0x10204f) & 0xffffff;
+	bench_run("palette search 200 cells", 100000, row_search, NULL);
+	bench_run("sgr_quant_row scalar 200 cells", 100000, row_scalar, NULL);
+	bench_run("sgr_quant_row 200 cells", 100000, row_auto, NULL);
+	sgr_quant_free(quant);
+
+	static int paths[] = {SGR_PATH_SCALAR, SGR_PATH_SSE2, SGR_PATH_AVX2};
+	static const char *path_names[] = {"scalar", "sse2", "avx2"};
+	log_init();
+	for (int i = 0; i < 3; i++) {
+		char label[64];
+		snprintf(label, sizeof(label), "sgr_parse %s log", path_names[i]);
+		double ns = bench_run(label, 100, parse_log, &paths[i]);
+		bench_report(label, "MB/s", log_len / ns * 1e3);
+	}
+	free(log_text);
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,106 @@
+#include "../ti.c"
+#include "../tkbd.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define INPUT_SIZE (1 << 20)
+
+struct input {
+	const char *name;
+	char       *data;
+	size_t      len;
+	int         path;
+};
+
+static char *out;
+
+// Terminal traffic: text lines with color changes and cursor movement.
+static void fill_traffic(char *buf, size_t len) {
+	static const char *parts[] = {
+		"\033[38;5;208m", "The quick brown fox jumps over the lazy dog. ",
+		"\033[0m", "\r\n", "\033[12;40H", "status: ok ", "\033[1m", "\t",
+	};
+	size_t n = 0;
+	for (unsigned int i = 0; n < len; i++) {
+		const char *p = parts[(i * 7 + i / 3) % 8];
+		size_t l = strlen(p);
+		if (l > len - n) l = len - n;
+		memcpy(buf + n, p, l);
+		n += l;
+	}
+}
+
+static void fill_text(char *buf, size_t len) {
+	for (size_t i = 0; i < len; i++) buf[i] = ' ' + i % 95;
+}
+
+static void fill_binary(char *buf, size_t len) {
+	unsigned int seed = 1;
+	for (size_t i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		buf[i] = seed >> 16;
+	}
+}
+
+static void escape(void *arg) {
+	struct input *in = arg;
+	size_t used;
+	stresc_kernel(out, 4 * in->len, in->data, in->len, &used, 0, in->path);
+}
+
+static void escape_ti(void *arg) {
+	struct input *in = arg;
+	ti_stresc(out, in->data, 4 * in->len + 1);
+}
+
+static void escape_tkbd(void *arg) {
+	struct input *in = arg;
+	tkbd_stresc(out, in->data, in->len);
+}
+
+static void report(const char *name, struct input *in, void (*fn)(void *)) {
+	char label[64];
+	snprintf(label, sizeof(label), "%s %s", name, in->name);
+	double ns = bench_run(label, 20, fn, in);
+	bench_report(label, "MB/s", in->len / ns * 1e3);
+}
+
+int main(void) {
+	static const char *paths[] = {"auto", "scalar", "sse2", "avx2"};
+	struct input inputs[] = {
+		{"traffic", malloc(INPUT_SIZE + 1), INPUT_SIZE, 0},
+		{"text",    malloc(INPUT_SIZE + 1), INPUT_SIZE, 0},
+		{"binary",  malloc(INPUT_SIZE + 1), INPUT_SIZE, 0},
+	};
+	out = malloc(4 * INPUT_SIZE + 1);
+	fill_traffic(inputs[0].data, INPUT_SIZE);
+	fill_text(inputs[1].data, INPUT_SIZE);
+	fill_binary(inputs[2].data, INPUT_SIZE);
+
+	for (int i = 0; i < 3; i++) {
+		struct input *in = &inputs[i];
+		in->data[in->len] = 0;
+		for (int p = STRESC_PATH_SCALAR; p <= STRESC_PATH_AVX2; p++) {
+#ifndef STRESC_X86
+			if (p != STRESC_PATH_SCALAR) continue;
+#else
+			if (p == STRESC_PATH_AVX2 && !__builtin_cpu_supports("avx2")) continue;
+#endif
+			char name[32];
+			snprintf(name, sizeof(name), "stresc %s", paths[p]);
+			in->path = p;
+			report(name, in, escape);
+		}
+		// NUL bytes end ti_stresc() input early, so only text inputs
+		if (i != 2) report("ti_stresc", in, escape_ti);
+		report("tkbd_stresc", in, escape_tkbd);
+	}
+
+	for (int i = 0; i < 3; i++) free(inputs[i].data);
+	free(out);
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,234 @@
+#define _XOPEN_SOURCE 700
+#include <unistd.h>
+
+// Count the bytes termbox writes to the terminal.
+static long written;
+static ssize_t count_write(int fd, const void *buf, size_t n) {
+	ssize_t r = write(fd, buf, n);
+	if (r > 0) written += r;
+	return r;
+}
+#define write count_write
+
+#include "../termbox/termbox.c"
+#include "../sgr.c"
+#include "../ti.c"
+#include "bench.h"
+
+#undef write
+
+#include <signal.h>
+#include <sys/wait.h>
+
+// termbox draws to a pseudo terminal whose output is read and dropped by a
+// child process, so only the cost of building the frames is measured. The
+// bytes written per frame are reported for the workloads where they matter.
+
+#define W 200
+#define H 50
+
+static pid_t reader;
+static int frame;
+
+static int open_pty(int w, int h) {
+	int master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0) return -1;
+	int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if (slave < 0) return -1;
+	struct winsize ws = {h, w, 0, 0};
+	ioctl(slave, TIOCSWINSZ, &ws);
+
+	reader = fork();
+	if (reader == 0) {
+		char buf[65536];
+		close(slave);
+		while (read(master, buf, sizeof(buf)) > 0) {}
+		_exit(0);
+	}
+	close(master);
+	return slave;
+}
+
+// A dashboard of colored panels with a status line.
+static void draw_dashboard(void) {
+	for (int y = 0; y < H; y++) {
+		for (int x = 0; x < W; x++) {
+			uint32_t ch = "0123456789abcdef"[(x * 7 + y * 3) & 15];
+			uint16_t fg = (x / 20) % 7 + 2, bg = y == 0 ? TB_BLUE : TB_DEFAULT;
+			tb_change_cell(x, y, ch, fg | (y % 4 ? 0 : TB_BOLD), bg);
+		}
+	}
+}
+
+// Rewrite the clock in the status line.
+static void draw_clock(void) {
+	char clock[16];
+	snprintf(clock, sizeof(clock), "%02d:%02d:%02d",
+	         frame / 3600 % 24, frame / 60 % 60, frame % 60);
+	for (int i = 0; clock[i]; i++) {
+		tb_change_cell(W - 9 + i, 0, clock[i], TB_WHITE | TB_BOLD, TB_BLUE);
+	}
+}
+
+static void idle(void *arg) {
+	(void)arg;
+	tb_present();
+}
+
+static void tick(void *arg) {
+	(void)arg;
+	frame++;
+	draw_clock();
+	tb_present();
+}
+
+static void redraw(void *arg) {
+	(void)arg;
+	frame++;
+	tb_clear();
+	draw_dashboard();
+	draw_clock();
+	tb_present();
+}
+
+static void tick_cell_buffer(void *arg) {
+	(void)arg;
+	frame++;
+	struct tb_cell *cells = tb_cell_buffer();
+	cells[(H - 1) * W + frame % W].ch = 'a' + frame % 26;
+	tb_present();
+}
+
+// The frame demo/paint.c draws: the canvas copied in through the cell
+// buffer and the buttons drawn over it.
+static struct tb_cell canvas[W * H];
+
+static void paint_stroke(void) {
+	frame++;
+	int x = frame * 7 % W, y = 3 + frame % (H - 6);
+	canvas[y * W + x].ch = 0x2588;
+	canvas[y * W + x].sgr = (struct sgr){SGR_BG, 0, frame % 8};
+}
+
+static void paint_redraw(void *arg) {
+	(void)arg;
+	paint_stroke();
+	tb_clear();
+	memcpy(tb_cell_buffer(), canvas, sizeof(canvas));
+	for (int i = 0; i < 8; i++) {
+		for (int x = 0; x < 4; x++) {
+			tb_change_cell(i * 4 + x, 0, 0x2591, TB_DEFAULT, TB_DEFAULT);
+			tb_change_cell(i * 4 + x, H - 3, ' ', TB_DEFAULT, i + 1);
+		}
+	}
+	tb_present();
+}
+
+// The same stroke presented as a region.
+static void paint_rect(void *arg) {
+	(void)arg;
+	paint_stroke();
+	int x = frame * 7 % W, y = 3 + frame % (H - 6);
+	tb_put_cell(x, y, &canvas[y * W + x]);
+	tb_present_rect(x, y, 1, 1);
+}
+
+// The same stroke written through the cell buffer with its damage given.
+static void paint_damage(void *arg) {
+	(void)arg;
+	paint_stroke();
+	int x = frame * 7 % W, y = 3 + frame % (H - 6);
+	tb_cell_buffer()[y * W + x] = canvas[y * W + x];
+	tb_damage(x, y, 1, 1);
+	tb_present();
+}
+
+// A log pane between a header and a status line that scrolls by a line
+// every frame.
+static void log_scroll(void *arg) {
+	(void)arg;
+	frame++;
+	for (int y = 1; y < H - 1; y++) {
+		int line = frame + y;
+		for (int x = 0; x < W; x++) {
+			uint32_t ch = x < 60 + line % 97 ? "etaoin shrdlu"[(line * 31 + x) % 13] : ' ';
+			tb_change_cell(x, y, ch, line % 5 ? TB_DEFAULT : TB_RED, TB_DEFAULT);
+		}
+	}
+	tb_present();
+}
+
+// A table of counters of which a few digits change every frame.
+static void stats_tick(void *arg) {
+	(void)arg;
+	frame++;
+	for (int y = 2; y < H - 2; y++) {
+		for (int col = 0; col < 4; col++) {
+			char num[16];
+			unsigned v = (unsigned)(y * 4 + col) * 2654435761u;
+			v = v % 100000 + frame * (1 + (v >> 28) % 7) / 3;
+			snprintf(num, sizeof(num), "%8u", v);
+			for (int i = 0; num[i]; i++) {
+				tb_change_cell(20 + col * 45 + i, y, num[i],
+				               col % 2 ? TB_GREEN : TB_DEFAULT, TB_DEFAULT);
+			}
+		}
+	}
+	tb_present();
+}
+
+// Report the bytes per frame of fn over n frames.
+static void report_bytes(const char *name, void (*fn)(void *), int n) {
+	long start = written;
+	for (int i = 0; i < n; i++) fn(NULL);
+	bench_report(name, "bytes/frame", (double)(written - start) / n);
+}
+
+int main(void) {
+	setenv("TERMINFO", "../test/terminfo", 1);
+	setenv("TERM", "xterm-new", 1);
+
+	int fd = open_pty(W, H);
+	if (fd < 0 || tb_init_fd(fd) < 0) {
+		fprintf(stderr, "termbox_bench: can't open a pseudo terminal\n");
+		return 1;
+	}
+	draw_dashboard();
+	draw_clock();
+	tb_present();
+
+	char name[64];
+	snprintf(name, sizeof(name), "tb_present %dx%d unchanged", W, H);
+	bench_run(name, 20000, idle, NULL);
+	snprintf(name, sizeof(name), "tb_present %dx%d clock tick", W, H);
+	bench_run(name, 20000, tick, NULL);
+	snprintf(name, sizeof(name), "tb_present %dx%d cell buffer tick", W, H);
+	bench_run(name, 2000, tick_cell_buffer, NULL);
+	snprintf(name, sizeof(name), "tb_present %dx%d clear and redraw", W, H);
+	bench_run(name, 2000, redraw, NULL);
+	snprintf(name, sizeof(name), "paint %dx%d full redraw", W, H);
+	bench_run(name, 2000, paint_redraw, NULL);
+	snprintf(name, sizeof(name), "paint %dx%d tb_present_rect", W, H);
+	bench_run(name, 20000, paint_rect, NULL);
+	snprintf(name, sizeof(name), "paint %dx%d tb_damage", W, H);
+	bench_run(name, 20000, paint_damage, NULL);
+	snprintf(name, sizeof(name), "tb_present %dx%d log scroll", W, H);
+	bench_run(name, 2000, log_scroll, NULL);
+	snprintf(name, sizeof(name), "tb_present %dx%d counters", W, H);
+	bench_run(name, 2000, stats_tick, NULL);
+
+	snprintf(name, sizeof(name), "tb_present %dx%d clock tick output", W, H);
+	report_bytes(name, tick, 200);
+	snprintf(name, sizeof(name), "tb_present %dx%d log scroll output", W, H);
+	report_bytes(name, log_scroll, 200);
+	snprintf(name, sizeof(name), "tb_present %dx%d counters output", W, H);
+	report_bytes(name, stats_tick, 200);
+	snprintf(name, sizeof(name), "paint %dx%d full redraw output", W, H);
+	report_bytes(name, paint_redraw, 200);
+
+	tb_shutdown();
+	waitpid(reader, NULL, 0);
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,99 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *terms[] = {
+	"xterm-color", "xterm-new", "xterm-kitty", "minitel1", NULL,
+};
+
+// Count the heap blocks and bytes held by a loaded terminfo struct.
+static size_t footprint(ti_terminfo *ti, int *blocks) {
+	size_t hash = ti->ext_hash ? (ti->ext_hash_mask + 1) * sizeof(uint16_t) : 0;
+	if (ti->flags & TI_F_COMPACT) {
+		*blocks = 1;
+		return sizeof(ti_terminfo) + ti->len + hash +
+		       (ti->nums_count + ti->ext_nums_count) * sizeof(int32_t);
+	}
+
+	size_t sizes[] = {
+		sizeof(ti_terminfo),
+		ti->len,
+		ti->nums ? ti->nums_count * sizeof(int32_t) : 0,
+		ti->strs ? ti->strs_count * sizeof(char*) : 0,
+		ti->ext_nums ? ti->ext_nums_count * sizeof(int32_t) : 0,
+		ti->ext_strs ? ti->ext_strs_count * sizeof(char*) : 0,
+		ti->ext_names ? ti->ext_names_count * sizeof(char*) : 0,
+		hash,
+	};
+	size_t total = 0;
+	*blocks = 0;
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		total += sizes[i];
+		*blocks += (sizes[i] != 0);
+	}
+	return total;
+}
+
+static void print_footprint(const char *name, size_t size, int blocks) {
+	if (!bench_json()) {
+		printf("%-40s %10zu %10d\n", name, size, blocks);
+		return;
+	}
+	char label[80];
+	snprintf(label, sizeof(label), "%s bytes", name);
+	bench_report(label, "bytes", size);
+	snprintf(label, sizeof(label), "%s blocks", name);
+	bench_report(label, "blocks", blocks);
+}
+
+static void load(void *term) {
+	ti_free(ti_load(term, NULL));
+}
+
+static void load_compact(void *term) {
+	ti_free(ti_load_compact(term, NULL));
+}
+
+int main(void) {
+	// load terminfo data from the test directory only
+	setenv("TERMINFO", "../test/terminfo", 1);
+
+	if (!bench_json()) printf("%-40s %10s %10s\n", "terminal", "bytes", "blocks");
+	for (int i = 0; terms[i]; i++) {
+		char name[64];
+		int blocks;
+		ti_terminfo *ti = ti_load(terms[i], NULL);
+		ti_terminfo *cti = ti_load_compact(terms[i], NULL);
+		if (!ti || !cti) {
+			fprintf(stderr, "error: failed to load %s\n", terms[i]);
+			return 1;
+		}
+
+		snprintf(name, sizeof(name), "ti_load %s", terms[i]);
+		size_t size = footprint(ti, &blocks);
+		print_footprint(name, size, blocks);
+		snprintf(name, sizeof(name), "ti_load_compact %s", terms[i]);
+		size = footprint(cti, &blocks);
+		print_footprint(name, size, blocks);
+
+		ti_free(cti);
+		ti_free(ti);
+	}
+
+	if (!bench_json()) printf("\n");
+	for (int i = 0; terms[i]; i++) {
+		char name[64];
+		snprintf(name, sizeof(name), "ti_load %s", terms[i]);
+		bench_run(name, 20000, load, (void*)terms[i]);
+		snprintf(name, sizeof(name), "ti_load_compact %s", terms[i]);
+		bench_run(name, 20000, load_compact, (void*)terms[i]);
+	}
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,63 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// capability names from the start and end of the standard table, extended
+// names, and a name the terminal doesn't have
+static const char *caps[] = {
+	"cbt", "cup", "box1", "setrgbf", "smxx", "kUP7", "Smulx", NULL,
+};
+
+static ti_terminfo *ti;
+static char * volatile sink;
+
+// Linear name search used by ti_getstr() before the hash tables were added.
+static char *scan_getstr(ti_terminfo *ti, const char *cap) {
+	static const int n = (sizeof(ti_strnames) / sizeof(char*));
+	for (int i = 0; i < n; i++) {
+		if (strcmp(ti_strnames[i], cap)) continue;
+		return ti_getstri(ti, i);
+	}
+	for (int i = 0; i < ti->ext_strs_count; i++) {
+		if (strcmp(ti_extname(ti, TI_STR, i), cap)) continue;
+		return ti_getextstri(ti, i);
+	}
+	return NULL;
+}
+
+static void getstr(void *cap) {
+	sink = ti_getstr(ti, cap);
+}
+
+static void getstr_scan(void *cap) {
+	sink = scan_getstr(ti, cap);
+}
+
+int main(void) {
+	// load terminfo data from the test directory only
+	setenv("TERMINFO", "../test/terminfo", 1);
+
+	int err;
+	ti = ti_load("xterm-kitty", &err);
+	if (!ti) {
+		fprintf(stderr, "error: xterm-kitty: %s\n", ti_strerror(err));
+		return 1;
+	}
+
+	char name[64];
+	for (int i = 0; caps[i]; i++) {
+		snprintf(name, sizeof(name), "ti_getstr %s", caps[i]);
+		bench_run(name, 1000000, getstr, (void*)caps[i]);
+		snprintf(name, sizeof(name), "linear scan %s", caps[i]);
+		bench_run(name, 100000, getstr_scan, (void*)caps[i]);
+	}
+
+	ti_free(ti);
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,51 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char *terms[] = {
+	"xterm-color", "xterm-new", "xterm-kitty", "minitel1", NULL,
+};
+
+static void load(void *term) {
+	int err;
+	ti_terminfo *ti = ti_load(term, &err);
+	ti_getstri(ti, ti_cup);
+	ti_free(ti);
+}
+
+static void load_mmap(void *term) {
+	int err;
+	ti_terminfo *ti = ti_load_mmap(term, &err);
+	ti_getstri(ti, ti_cup);
+	ti_free(ti);
+}
+
+static void load_shared(void *term) {
+	int err;
+	ti_terminfo *ti = ti_load_shared(term, &err);
+	ti_getstri(ti, ti_cup);
+	ti_release(ti);
+}
+
+int main(void) {
+	// load terminfo data from the test directory only
+	setenv("TERMINFO", "../test/terminfo", 1);
+
+	char name[64];
+	for (int i = 0; terms[i]; i++) {
+		snprintf(name, sizeof(name), "ti_load %s", terms[i]);
+		bench_run(name, 20000, load, (void*)terms[i]);
+		snprintf(name, sizeof(name), "ti_load_mmap %s", terms[i]);
+		bench_run(name, 20000, load_mmap, (void*)terms[i]);
+		snprintf(name, sizeof(name), "ti_load_shared %s", terms[i]);
+		bench_run(name, 20000, load_shared, (void*)terms[i]);
+	}
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,85 @@
+#include "../ti.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+struct parm_case {
+	const char   *cap;
+	int           params[9];
+	const char   *ps;
+	ti_parm_prog *prog;
+	ti_fastparm   fast;
+};
+
+// cup, setaf with a 256 color index, and sgr with standout, underline and bold
+static struct parm_case cases[] = {
+	{"cup",   {12, 40}},
+	{"setaf", {196}},
+	{"sgr",   {1, 1, 0, 0, 0, 1, 0, 0, 0}},
+};
+
+static char buf[TI_PARM_OUTPUT_MAX];
+
+static void interp(void *arg) {
+	struct parm_case *c = arg;
+	int *p = c->params;
+	ti_parm(buf, c->ps, 9, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8]);
+}
+
+static void exec(void *arg) {
+	struct parm_case *c = arg;
+	ti_parm_exec(c->prog, buf, c->params, 9);
+}
+
+static void fast(void *arg) {
+	struct parm_case *c = arg;
+	ti_fastparm_fmt(&c->fast, buf, c->params, 9);
+}
+
+static ti_colortab *colortab;
+
+// Table lookup and copy of a setaf sequence.
+static void colortab_fg(void *arg) {
+	struct parm_case *c = arg;
+	ti_slice sl = ti_colortab_fg(colortab, c->params[0]);
+	memcpy(buf, sl.ptr, sl.len);
+}
+
+int main(void) {
+	// xterm-256color comes from the system terminfo database
+	int err;
+	ti_terminfo *ti = ti_load("xterm-256color", &err);
+	if (!ti) {
+		fprintf(stderr, "error: xterm-256color: %s\n", ti_strerror(err));
+		return 1;
+	}
+
+	char name[64];
+	for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		struct parm_case *c = &cases[i];
+		c->ps = ti_getstr(ti, c->cap);
+		c->prog = ti_parm_compile(c->ps);
+		if (!c->ps || !c->prog) {
+			fprintf(stderr, "error: xterm-256color has no %s\n", c->cap);
+			return 1;
+		}
+		snprintf(name, sizeof(name), "ti_parm %s", c->cap);
+		bench_run(name, 1000000, interp, c);
+		snprintf(name, sizeof(name), "ti_parm_exec %s", c->cap);
+		bench_run(name, 1000000, exec, c);
+		ti_fastparm_bind(&c->fast, c->ps);
+		snprintf(name, sizeof(name), "ti_fastparm_fmt %s", c->cap);
+		bench_run(name, 1000000, fast, c);
+		ti_parm_free(c->prog);
+	}
+
+	colortab = ti_colortab_new(ti);
+	bench_run("ti_colortab_fg setaf", 1000000, colortab_fg, &cases[1]);
+	ti_colortab_free(colortab);
+
+	ti_free(ti);
+	return 0;
+}
+
+// vim: noexpandtab
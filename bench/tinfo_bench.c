@@ -0,0 +1,117 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <dlfcn.h>
+
+// Compare against the system terminfo library when one can be loaded. The
+// library is opened at run time so the benchmarks build without it.
+static const char *libs[] = {
+	"libtinfo.so.6", "libtinfo.so", "libncursesw.so.6", "libncurses.so.6", NULL,
+};
+
+static int (*sys_setupterm)(const char *, int, int *);
+static char *(*sys_tigetstr)(const char *);
+static char *(*sys_tparm)(const char *, ...);
+
+struct input {
+	const char *cap;
+	const char *str;
+	const char *sys_str;
+	int params[2];
+};
+
+static ti_terminfo *ti;
+static char buf[TI_PARM_OUTPUT_MAX];
+static char * volatile sink;
+
+static void getstr(void *arg) {
+	struct input *in = arg;
+	sink = ti_getstr(ti, in->cap);
+}
+
+static void sys_getstr(void *arg) {
+	struct input *in = arg;
+	sink = sys_tigetstr(in->cap);
+}
+
+static void parm(void *arg) {
+	struct input *in = arg;
+	ti_parm(buf, in->str, in->params[0], in->params[1]);
+	sink = buf;
+}
+
+static void sys_parm(void *arg) {
+	struct input *in = arg;
+	sink = sys_tparm(in->sys_str, in->params[0], in->params[1]);
+}
+
+static void *open_tinfo(void) {
+	for (int i = 0; libs[i]; i++) {
+		void *lib = dlopen(libs[i], RTLD_NOW | RTLD_LOCAL);
+		if (!lib) continue;
+		*(void**)&sys_setupterm = dlsym(lib, "setupterm");
+		*(void**)&sys_tigetstr = dlsym(lib, "tigetstr");
+		*(void**)&sys_tparm = dlsym(lib, "tparm");
+		if (sys_setupterm && sys_tigetstr && sys_tparm) return lib;
+		dlclose(lib);
+	}
+	return NULL;
+}
+
+int main(void) {
+	// load terminfo data from the test directory only
+	setenv("TERMINFO", "../test/terminfo", 1);
+
+	void *lib = open_tinfo();
+	if (!lib) {
+		printf("system terminfo library not found, skipped\n");
+		return 0;
+	}
+
+	int err;
+	ti = ti_load("xterm-kitty", &err);
+	if (!ti) {
+		fprintf(stderr, "error: xterm-kitty: %s\n", ti_strerror(err));
+		return 1;
+	}
+	if (sys_setupterm("xterm-kitty", 1, &err) != 0) {
+		fprintf(stderr, "error: setupterm xterm-kitty failed\n");
+		return 1;
+	}
+
+	struct input inputs[] = {
+		{"cup",   NULL, NULL, {23, 79}},
+		{"setaf", NULL, NULL, {196, 0}},
+		{"sgr",   NULL, NULL, {1, 0}},
+	};
+
+	char name[64];
+	for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+		struct input *in = &inputs[i];
+		in->str = ti_getstr(ti, in->cap);
+		in->sys_str = sys_tigetstr(in->cap);
+		if (!in->str || !in->sys_str || in->sys_str == (char*)-1) {
+			fprintf(stderr, "error: xterm-kitty has no %s\n", in->cap);
+			return 1;
+		}
+
+		snprintf(name, sizeof(name), "ti_getstr %s", in->cap);
+		bench_run(name, 1000000, getstr, in);
+		snprintf(name, sizeof(name), "tigetstr %s", in->cap);
+		bench_run(name, 1000000, sys_getstr, in);
+		snprintf(name, sizeof(name), "ti_parm %s", in->cap);
+		bench_run(name, 1000000, parm, in);
+		snprintf(name, sizeof(name), "tparm %s", in->cap);
+		bench_run(name, 1000000, sys_parm, in);
+	}
+
+	ti_free(ti);
+	dlclose(lib);
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,42 @@
+#include "../tkbd.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+struct input {
+	const char *name;
+	const char *seq;
+};
+
+static volatile int sink;
+
+static void parse(void *arg) {
+	struct input *in = arg;
+	struct tkbd_seq seq;
+	sink = tkbd_parse(&seq, in->seq, strlen(in->seq));
+}
+
+int main(void) {
+	struct input inputs[] = {
+		{"char",        "a"},
+		{"utf8",        "\xe2\x82\xac"},
+		{"ctrl",        "\x01"},
+		{"alt",         "\033a"},
+		{"up",          "\033[A"},
+		{"ctrl+right",  "\033[1;5C"},
+		{"f5",          "\033[15~"},
+		{"mouse x10",   "\033[M !!"},
+		{"mouse sgr",   "\033[<0;120;40M"},
+	};
+
+	char name[64];
+	for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+		snprintf(name, sizeof(name), "tkbd_parse %s", inputs[i].name);
+		bench_run(name, 1000000, parse, &inputs[i]);
+	}
+
+	return 0;
+}
+
+// vim: noexpandtab
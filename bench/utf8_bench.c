@@ -0,0 +1,64 @@
+#include "../utf8.c"
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// one to four byte sequences, mostly ASCII like typical terminal text
+static const char text[] =
+	"The quick brown fox jumps over the lazy dog. "
+	"caf\xc3\xa9 na\xc3\xafve \xe2\x82\xac 10 \xe2\x94\x80\xe2\x94\x80 "
+	"\xf0\x9f\x98\x80 end";
+
+static uint32_t codepoints[sizeof(text)];
+static size_t ncodepoints;
+static volatile uint32_t sink;
+
+static void seq_len(void *arg) {
+	(void)arg;
+	int n = 0;
+	for (size_t i = 0; i < sizeof(text) - 1; i += utf8_seq_len(text[i])) n++;
+	sink = n;
+}
+
+static void decode(void *arg) {
+	(void)arg;
+	uint32_t cp, sum = 0;
+	size_t len = sizeof(text) - 1;
+	for (size_t i = 0; i < len;) {
+		int n = utf8_seq_to_codepoint(&cp, text + i, len - i);
+		if (n == 0) break;
+		sum += cp;
+		i += n;
+	}
+	sink = sum;
+}
+
+static void encode(void *arg) {
+	(void)arg;
+	char buf[4 * sizeof(text)];
+	size_t pos = 0;
+	for (size_t i = 0; i < ncodepoints; i++) {
+		pos += utf8_codepoint_to_seq(buf + pos, codepoints[i]);
+	}
+	sink = buf[pos - 1];
+}
+
+int main(void) {
+	size_t len = sizeof(text) - 1;
+	for (size_t i = 0; i < len;) {
+		i += utf8_seq_to_codepoint(&codepoints[ncodepoints++], text + i, len - i);
+	}
+
+	char name[64];
+	snprintf(name, sizeof(name), "utf8_seq_len %zu chars", ncodepoints);
+	bench_run(name, 1000000, seq_len, NULL);
+	snprintf(name, sizeof(name), "utf8_seq_to_codepoint %zu chars", ncodepoints);
+	bench_run(name, 1000000, decode, NULL);
+	snprintf(name, sizeof(name), "utf8_codepoint_to_seq %zu chars", ncodepoints);
+	bench_run(name, 1000000, encode, NULL);
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -26,13 +26,13 @@ int main(void) {
 		printf("%s %s=%d\n", "std bool", ti_boolnames[i], ti_getbooli(ti, i));
 	}
 	for (int i = 0; i < ti->ext_bools_count; i++) {
-		printf("%s %s=%d\n", "ext bool", ti->ext_bool_names[i], ti->ext_bools[i]);
+		printf("%s %s=%d\n", "ext bool", ti_extname(ti, TI_BOOL, i), ti_getextbooli(ti, i));
 	}
 	for (int i = 0; i < ti->nums_count; i++) {
 		printf("%s %s=%d\n", "std num", ti_numnames[i], ti_getnumi(ti, i));
 	}
 	for (int i = 0; i < ti->ext_nums_count; i++) {
-		printf("%s %s=%d\n", "ext num", ti->ext_num_names[i], ti->ext_nums[i]);
+		printf("%s %s=%d\n", "ext num", ti_extname(ti, TI_NUM, i), ti_getextnumi(ti, i));
 	}
 
 	char esc[1024]; // escape string buffer
@@ -45,12 +45,12 @@ int main(void) {
 		printf("%s %s=%s\n", "std str", ti_strnames[i], s);
 	}
 	for (int i = 0; i < ti->ext_strs_count; i++) {
-		char *s = ti->ext_strs[i];
+		char *s = ti_getextstri(ti, i);
 		if (s) {
 			ti_stresc(esc, s, sizeof(esc));
 			s = esc;
 		}
-		printf("%s %s=%s\n", "ext str", ti->ext_str_names[i], s);
+		printf("%s %s=%s\n", "ext str", ti_extname(ti, TI_STR, i), s);
 	}
 
 	return 0;
@@ -90,6 +90,19 @@ void updateAndRedrawAll(int mx, int my) {
 	tb_present();
 }
 
+// Paints one cell between the button rows, presenting only that cell.
+int paintCell(int mx, int my) {
+	if (mx < 0 || mx >= bbw || my < 3 || my >= bbh - 3)
+		return 0;
+	struct tb_cell *c = &backbuf[bbw*my+mx];
+	c->ch = runes[curRune];
+	c->sgr.at |= SGR_BG;
+	c->sgr.bg = colors[curCol] - 1;
+	tb_put_cell(mx, my, c);
+	tb_present_rect(mx, my, 1, 1);
+	return 1;
+}
+
 void reallocBackBuffer(int w, int h) {
 	bbw = w;
 	bbh = h;
@@ -133,6 +146,8 @@ int main(int argv, char **argc) {
 			if (ev.key == TB_KEY_MOUSE_LEFT) {
 				mx = ev.x;
 				my = ev.y;
+				if (paintCell(mx, my))
+					continue;
 			}
 			break;
 		case TB_EVENT_RESIZE:
@@ -0,0 +1,63 @@
+/*
+ *
+ * tiscan.c - Load every terminfo entry and list terminals by capability.
+ * Copyright (c) 2020, Auxrelius I <aux01@aux.life>
+ *
+ * Usage: demo/tiscan [-j <threads>] [<capname>...]
+ *
+ * Parses all entries in the terminfo search paths in parallel and reports
+ * the ones that fail. For each capname argument, prints the terminals that
+ * define the capability. Exits non-zero when any entry failed to parse.
+ *
+ *
+ */
+
+#include "../ti.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char *argv[]) {
+	int nthreads = 0, i = 1;
+	if (argc > 2 && strcmp(argv[1], "-j") == 0) {
+		nthreads = atoi(argv[2]);
+		i = 3;
+	} else if (argc > 1 && argv[1][0] == '-') {
+		fprintf(stderr, "Usage: %s [-j <threads>] [<capname>...]\n", argv[0]);
+		return 2;
+	}
+
+	int err;
+	ti_scan *scan = ti_db_scan(nthreads, &err);
+	if (!scan) {
+		fprintf(stderr, "error: %s\n", ti_strerror(err));
+		return 1;
+	}
+
+	for (int e = 0; e < scan->nentries; e++) {
+		if (!scan->entries[e].err) continue;
+		printf("FAILED: %s\n", scan->entries[e].name);
+		printf("    %s: %s\n", scan->entries[e].path,
+		       ti_strerror(scan->entries[e].err));
+	}
+
+	for (; i < argc; i++) {
+		const int *entries;
+		int n = ti_scan_find(scan, argv[i], &entries);
+		printf("%s:", argv[i]);
+		for (int j = 0; j < n; j++) {
+			printf(" %s", scan->entries[entries[j]].name);
+		}
+		printf("\n");
+	}
+
+	printf("%d terminfo files loaded: %d ok, %d failed.\n", scan->nentries,
+	       scan->nentries - scan->nfailed, scan->nfailed);
+
+	int failed = scan->nfailed > 0;
+	ti_scan_free(scan);
+	return failed;
+}
+
+// vim: noexpandtab
@@ -11,10 +11,35 @@
 #include "sgr.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define SGR_X86 1
+#endif
+
+// Code paths of the SIMD routines. Tests and benchmarks select them directly.
+#define SGR_PATH_AUTO   0  // best path the CPU supports
+#define SGR_PATH_SCALAR 1
+#define SGR_PATH_SSE2   2
+#define SGR_PATH_AVX2   3
+
+static int sgr_path(int path)
+{
+#ifdef SGR_X86
+	if (path == SGR_PATH_AUTO) {
+		path = __builtin_cpu_supports("avx2") ? SGR_PATH_AVX2 : SGR_PATH_SSE2;
+	}
+	return path;
+#else
+	(void)path;
+	return SGR_PATH_SCALAR;
+#endif
+}
+
 // Fills an array of ints with SGR formatting codes for the sgr structure.
 // This is mostly used internally to drive encoding to SGR string sequence.
 int sgr_unpack(uint16_t codes[], struct sgr sgr)
@@ -130,128 +155,800 @@ static inline int uitoa(uint16_t n, char *buf)
 	return i;
 }
 
-// Emit string characters for an SGR value.
-// This lets us keep the uint32_t -> string logic in one place but allow writing
-// to different types of mediums (FILE, fd, char* buffer, etc.).
-int sgr_encode(void *p, void (*func)(void *, char *, int), struct sgr sgr)
+// Decimal strings with a trailing separator for codes 0-255. Every code is
+// written with one fixed size copy and the pointer advanced by its length.
+static const char sgr_dec[256][5] = {
+	"0;", "1;", "2;", "3;", "4;", "5;", "6;", "7;",
+	"8;", "9;", "10;", "11;", "12;", "13;", "14;", "15;",
+	"16;", "17;", "18;", "19;", "20;", "21;", "22;", "23;",
+	"24;", "25;", "26;", "27;", "28;", "29;", "30;", "31;",
+	"32;", "33;", "34;", "35;", "36;", "37;", "38;", "39;",
+	"40;", "41;", "42;", "43;", "44;", "45;", "46;", "47;",
+	"48;", "49;", "50;", "51;", "52;", "53;", "54;", "55;",
+	"56;", "57;", "58;", "59;", "60;", "61;", "62;", "63;",
+	"64;", "65;", "66;", "67;", "68;", "69;", "70;", "71;",
+	"72;", "73;", "74;", "75;", "76;", "77;", "78;", "79;",
+	"80;", "81;", "82;", "83;", "84;", "85;", "86;", "87;",
+	"88;", "89;", "90;", "91;", "92;", "93;", "94;", "95;",
+	"96;", "97;", "98;", "99;", "100;", "101;", "102;", "103;",
+	"104;", "105;", "106;", "107;", "108;", "109;", "110;", "111;",
+	"112;", "113;", "114;", "115;", "116;", "117;", "118;", "119;",
+	"120;", "121;", "122;", "123;", "124;", "125;", "126;", "127;",
+	"128;", "129;", "130;", "131;", "132;", "133;", "134;", "135;",
+	"136;", "137;", "138;", "139;", "140;", "141;", "142;", "143;",
+	"144;", "145;", "146;", "147;", "148;", "149;", "150;", "151;",
+	"152;", "153;", "154;", "155;", "156;", "157;", "158;", "159;",
+	"160;", "161;", "162;", "163;", "164;", "165;", "166;", "167;",
+	"168;", "169;", "170;", "171;", "172;", "173;", "174;", "175;",
+	"176;", "177;", "178;", "179;", "180;", "181;", "182;", "183;",
+	"184;", "185;", "186;", "187;", "188;", "189;", "190;", "191;",
+	"192;", "193;", "194;", "195;", "196;", "197;", "198;", "199;",
+	"200;", "201;", "202;", "203;", "204;", "205;", "206;", "207;",
+	"208;", "209;", "210;", "211;", "212;", "213;", "214;", "215;",
+	"216;", "217;", "218;", "219;", "220;", "221;", "222;", "223;",
+	"224;", "225;", "226;", "227;", "228;", "229;", "230;", "231;",
+	"232;", "233;", "234;", "235;", "236;", "237;", "238;", "239;",
+	"240;", "241;", "242;", "243;", "244;", "245;", "246;", "247;",
+	"248;", "249;", "250;", "251;", "252;", "253;", "254;", "255;",
+};
+
+static inline char *sgr_put(char *p, unsigned n)
 {
-	uint16_t codes[SGR_ELMS_MAX];
-	int ncodes = sgr_unpack(codes, sgr);
-	if (ncodes == 0) return 0;
+	if (n > 255) {
+		p += uitoa(n, p);
+		*p++ = ';';
+		return p;
+	}
+	memcpy(p, sgr_dec[n], 4);
+	return p + (n < 10 ? 2 : n < 100 ? 3 : 4);
+}
 
-	int sz = 0;
+// Write the codes for one color. The mode is the fg or bg mode bits shifted
+// down so both use the same numbering: 1=8, 2=16, 3=24, 4=216, 5=256, 6=16M.
+// The base code is 30 for foreground and 40 for background colors.
+static inline char *sgr_put_color(char *p, unsigned mode, uint32_t color,
+                                  int neg, unsigned base)
+{
+	if (!mode) return p;
 
-	// write SGR open: "\e["
-	func(p, SGR_OPEN, sizeof(SGR_OPEN) - 1);
-	sz += sizeof(SGR_OPEN) - 1;
+	if (mode <= 2 || neg) {
+		// SGR_NEGATE specified: use default color
+		if (neg) color = 9;
 
-	// write formatting codes separated by ";"
-	int n;
-	char buf[8];
-	for (int i = 0; i < ncodes; i++) {
-		if (i > 0) {
-			// write SGR separator: ";"
-			func(p, SGR_SEP, sizeof(SGR_SEP) - 1);
-			sz += sizeof(SGR_SEP) - 1;
-		}
-		n = uitoa(codes[i], buf);
-		func(p, buf, n);
-		sz += n;
+		// truncate to 8 colors but allow 9 (default fg/bg)
+		if (color > 7 && color != SGR_DEFAULT)
+			color = 7;
+
+		color += base;
+		if (mode == 2) color += 60; // bright fg [9x] or bg [10x]
+		return sgr_put(p, color);
 	}
 
-	// write SGR close: "m"
-	func(p, SGR_CLOSE, sizeof(SGR_CLOSE) - 1);
-	sz += sizeof(SGR_CLOSE) - 1;
+	if (mode <= 5) {
+		memcpy(p, base == 30 ? "38;5;" : "48;5;", 5);
+		p += 5;
 
-	return sz;
+		// the 24, 216, and 256 color modes all use the same 256-color
+		// palette, adjust the index for the first two
+		if (mode == 3)      color = (color > 23 ? 23 : color) + 232;
+		else if (mode == 4) color = (color > 215 ? 215 : color) + 16;
+		return sgr_put(p, (uint16_t)color);
+	}
+
+	if (mode == 6) {
+		memcpy(p, base == 30 ? "38;2;" : "48;2;", 5);
+		p += 5;
+		p = sgr_put(p, (color&0xFF0000) >> 16); // red
+		p = sgr_put(p, (color&0x00FF00) >> 8);  // green
+		return sgr_put(p, (color&0x0000FF));    // blue
+	}
+
+	return p;
 }
 
+// Write the whole SGR sequence to dest in one pass. This produces the same
+// codes as sgr_unpack() without going through the codes array.
+// Returns the number of bytes written, 0 when there's nothing to write.
+// No null terminator is written.
+static int sgr_fmt(char *dest, struct sgr sgr)
+{
+	int at = sgr.at;
+	int neg = (at&SGR_NEGATE) ? 20 : 0;
 
-struct strbuf {
-	int pos;
-	char *str;
-};
+	memcpy(dest, SGR_OPEN, sizeof(SGR_OPEN) - 1);
+	char *p = dest + sizeof(SGR_OPEN) - 1;
+
+	if (at&SGR_RESET) p = sgr_put(p, 0);
+
+	if (at&SGR_ATTR_MASK) {
+		// bold on/off is a special case because code 21 is double underline
+		if (at&SGR_BOLD)      p = sgr_put(p, neg ? 22 : 1);
+		if (at&SGR_FAINT)     p = sgr_put(p, neg + 2);
+		if (at&SGR_ITALIC)    p = sgr_put(p, neg + 3);
+		if (at&SGR_UNDERLINE) p = sgr_put(p, neg + 4);
+		if (at&SGR_BLINK)     p = sgr_put(p, neg + 5);
+		if (at&SGR_REVERSE)   p = sgr_put(p, neg + 7);
+		if (at&SGR_STRIKE)    p = sgr_put(p, neg + 9);
+	}
+
+	p = sgr_put_color(p, (at&SGR_FG_MASK) >> 8, sgr.fg, neg, 30);
+	p = sgr_put_color(p, (at&SGR_BG_MASK) >> 11, sgr.bg, neg, 40);
+
+	if (p == dest + sizeof(SGR_OPEN) - 1) return 0;
 
-static void strbuf_write(void *dest, char *src, int n)
+	// the last separator becomes the SGR close: "m"
+	p[-1] = SGR_CLOSE[0];
+	return p - dest;
+}
+
+// Emit string characters for an SGR value.
+// The sequence is formatted in one pass and handed to func in a single call.
+int sgr_encode(void *p, void (*func)(void *, char *, int), struct sgr sgr)
 {
-	struct strbuf *buf = (struct strbuf*)dest;
-	memcpy(buf->str + buf->pos, src, n);
-	buf->pos += n;
+	char buf[SGR_STR_MAX];
+	int sz = sgr_fmt(buf, sgr);
+	if (sz) func(p, buf, sz);
+	return sz;
 }
 
+
 int sgr_str(char *dest, struct sgr sgr)
 {
-	struct strbuf buf = { 0, dest };
-	int sz = sgr_encode(&buf, strbuf_write, sgr);
+	int sz = sgr_fmt(dest, sgr);
 	dest[sz] = '\0';
 	return sz;
+}
+
 
+// Attributes with on and off codes. SGR_CONCEAL isn't encoded.
+#define SGR_DIFF_ATTRS (SGR_ATTR_MASK & ~SGR_CONCEAL)
+
+// Write the codes that select a color, or the default color code when the mode
+// doesn't select one.
+static inline int sgr_color_str(char *dest, unsigned mode, uint32_t color,
+                                unsigned base)
+{
+	char *p = sgr_put_color(dest, mode, color, 0, base);
+	if (p == dest) p = sgr_put(p, base + 9);
+	return p - dest;
 }
 
+int sgr_diff(char *dest, struct sgr prev, struct sgr next)
+{
+	int pa = prev.at & SGR_DIFF_ATTRS;
+	int na = next.at & SGR_DIFF_ATTRS;
+	int off = pa & ~na;
+	int on = na & ~pa;
+	int undo = off; // whether a reset could be shorter
+
+	memcpy(dest, SGR_OPEN, sizeof(SGR_OPEN) - 1);
+	char *p = dest + sizeof(SGR_OPEN) - 1;
+
+	// bold and faint are both turned off by 22
+	if (off & (SGR_BOLD|SGR_FAINT)) {
+		p = sgr_put(p, 22);
+		on |= na & (SGR_BOLD|SGR_FAINT);
+	}
+	if (off&SGR_ITALIC)    p = sgr_put(p, 23);
+	if (off&SGR_UNDERLINE) p = sgr_put(p, 24);
+	if (off&SGR_BLINK)     p = sgr_put(p, 25);
+	if (off&SGR_REVERSE)   p = sgr_put(p, 27);
+	if (off&SGR_STRIKE)    p = sgr_put(p, 29);
+
+	if (on&SGR_BOLD)      p = sgr_put(p, 1);
+	if (on&SGR_FAINT)     p = sgr_put(p, 2);
+	if (on&SGR_ITALIC)    p = sgr_put(p, 3);
+	if (on&SGR_UNDERLINE) p = sgr_put(p, 4);
+	if (on&SGR_BLINK)     p = sgr_put(p, 5);
+	if (on&SGR_REVERSE)   p = sgr_put(p, 7);
+	if (on&SGR_STRIKE)    p = sgr_put(p, 9);
+
+	// colors are compared by the codes that select them, so different
+	// values that render the same color don't produce output
+	char a[24], b[24];
+	int an = sgr_color_str(a, (prev.at&SGR_FG_MASK) >> 8, prev.fg, 30);
+	int bn = sgr_color_str(b, (next.at&SGR_FG_MASK) >> 8, next.fg, 30);
+	if (an != bn || memcmp(a, b, an) != 0) {
+		memcpy(p, b, bn);
+		p += bn;
+		undo |= (bn == 3 && b[1] == '9');
+	}
+	an = sgr_color_str(a, (prev.at&SGR_BG_MASK) >> 11, prev.bg, 40);
+	bn = sgr_color_str(b, (next.at&SGR_BG_MASK) >> 11, next.bg, 40);
+	if (an != bn || memcmp(a, b, an) != 0) {
+		memcpy(p, b, bn);
+		p += bn;
+		undo |= (bn == 3 && b[1] == '9');
+	}
 
-struct fdinfo {
-	int fd;
-	int err;
+	if (p == dest + sizeof(SGR_OPEN) - 1) {
+		dest[0] = '\0';
+		return 0;
+	}
+	p[-1] = SGR_CLOSE[0];
+	int sz = p - dest;
+
+	// starting over from a reset can only be shorter when something is
+	// turned off or back to the default color
+	if (undo) {
+		next.at = (next.at & (SGR_DIFF_ATTRS|SGR_FG_MASK|SGR_BG_MASK)) | SGR_RESET;
+		char reset[SGR_STR_MAX];
+		int rsz = sgr_fmt(reset, next);
+		if (rsz < sz) {
+			memcpy(dest, reset, rsz);
+			sz = rsz;
+		}
+	}
+
+	dest[sz] = '\0';
+	return sz;
+}
+
+
+void sgr_pen_reset(struct sgr_pen *pen)
+{
+	pen->sgr = (struct sgr){0};
+	pen->valid = 1;
+}
+
+void sgr_pen_invalidate(struct sgr_pen *pen)
+{
+	pen->valid = 0;
+}
+
+int sgr_pen_str(struct sgr_pen *pen, char *dest, struct sgr sgr)
+{
 	int sz;
-};
+	if (pen->valid && memcmp(&pen->sgr, &sgr, sizeof(sgr)) == 0) {
+		dest[0] = '\0';
+		return 0;
+	} else if (pen->valid) {
+		sz = sgr_diff(dest, pen->sgr, sgr);
+	} else {
+		// unknown state: reset everything and set the new attributes
+		struct sgr reset = sgr;
+		reset.at = (reset.at & (SGR_DIFF_ATTRS|SGR_FG_MASK|SGR_BG_MASK)) | SGR_RESET;
+		sz = sgr_str(dest, reset);
+	}
+	pen->sgr = sgr;
+	pen->valid = 1;
+	return sz;
+}
+
 
 // Note: be careful not to accidentally clear errno since that's
 // how the caller of sgr_write() will access error info.
-static void fd_write(void *dest, char *src, int n)
+int sgr_write(int fd, struct sgr sgr)
+{
+	char buf[SGR_STR_MAX];
+	int sz = sgr_fmt(buf, sgr);
+	if (sz == 0) return 0;
+	return write(fd, buf, sz);
+}
+
+
+int sgr_fwrite(FILE *stream, struct sgr sgr)
+{
+	char buf[SGR_STR_MAX];
+	int sz = sgr_fmt(buf, sgr);
+	if (sz == 0) return 0;
+
+	size_t n = fwrite(buf, 1, sz, stream);
+	if (n < (size_t)sz) {
+		return -1;
+	}
+	return n;
+}
+
+
+// Quantization tables have 32 levels per channel.
+#define SGR_QUANT_BITS 5
+#define SGR_QUANT_SIZE (1 << (3 * SGR_QUANT_BITS))
+
+struct sgr_quant {
+	int colors;             // colors value the table was built for
+	int size;               // palette size: 8, 16, or 256
+	// padded so 32-bit gathers at the last entry stay in bounds
+	uint8_t lut[SGR_QUANT_SIZE + 3];
+};
+
+// xterm default colors for the 16 ANSI colors.
+static const uint32_t sgr_ansi_rgb[16] = {
+	0x000000, 0xcd0000, 0x00cd00, 0xcdcd00, 0x0000ee, 0xcd00cd, 0x00cdcd, 0xe5e5e5,
+	0x7f7f7f, 0xff0000, 0x00ff00, 0xffff00, 0x5c5cff, 0xff00ff, 0x00ffff, 0xffffff,
+};
+
+// Channel levels of the 6x6x6 color cube in the 256-color palette.
+static const int sgr_cube_levels[6] = {0, 95, 135, 175, 215, 255};
+
+// Squared "redmean" distance: a weighted euclidean distance whose weights
+// follow the mean red of the two colors.
+static inline long sgr_rgb_dist(int r1, int g1, int b1, int r2, int g2, int b2)
 {
-	struct fdinfo *f = dest;
-	if (f->err) return;
+	long rmean = (r1 + r2) / 2;
+	long dr = r1 - r2, dg = g1 - g2, db = b1 - b2;
+	return (((512 + rmean) * dr * dr) >> 8) + 4 * dg * dg +
+	       (((767 - rmean) * db * db) >> 8);
+}
 
-	int sz = write(f->fd, src, n);
-	if (sz == -1) {
-		f->err = errno;
+// Nearest cube level index for one channel.
+static inline int sgr_cube_index(int v)
+{
+	if (v < 48) return 0;
+	if (v < 115) return 1;
+	return (v - 35) / 40;
+}
+
+// Nearest color in the cube and gray ramp of the 256-color palette.
+static int sgr_nearest_256(int r, int g, int b)
+{
+	int ri = sgr_cube_index(r), gi = sgr_cube_index(g), bi = sgr_cube_index(b);
+	int best = 16 + 36 * ri + 6 * gi + bi;
+	long dist = sgr_rgb_dist(r, g, b, sgr_cube_levels[ri],
+	                         sgr_cube_levels[gi], sgr_cube_levels[bi]);
+
+	// the gray ramp runs from 8 to 238 in steps of 10
+	for (int i = 0; i < 24; i++) {
+		int v = 8 + 10 * i;
+		long d = sgr_rgb_dist(r, g, b, v, v, v);
+		if (d < dist) {
+			dist = d;
+			best = 232 + i;
+		}
+	}
+	return best;
+}
+
+static int sgr_nearest_ansi(int r, int g, int b, int n)
+{
+	int best = 0;
+	long dist = -1;
+	for (int i = 0; i < n; i++) {
+		uint32_t c = sgr_ansi_rgb[i];
+		long d = sgr_rgb_dist(r, g, b, c >> 16, (c >> 8) & 0xff, c & 0xff);
+		if (dist < 0 || d < dist) {
+			dist = d;
+			best = i;
+		}
+	}
+	return best;
+}
+
+struct sgr_quant *sgr_quant_new(int colors)
+{
+	struct sgr_quant *q = malloc(sizeof(*q));
+	if (!q) return NULL;
+	q->colors = colors;
+	q->size = colors >= 256 ? 256 : colors >= 16 ? 16 : 8;
+
+	// each entry holds the color nearest to the center of its cell
+	const int step = 256 >> SGR_QUANT_BITS;
+	const int levels = 1 << SGR_QUANT_BITS;
+	uint8_t *p = q->lut;
+	for (int ri = 0; ri < levels; ri++)
+	for (int gi = 0; gi < levels; gi++)
+	for (int bi = 0; bi < levels; bi++) {
+		int r = ri * step + step / 2;
+		int g = gi * step + step / 2;
+		int b = bi * step + step / 2;
+		if (q->size == 256) *p++ = sgr_nearest_256(r, g, b);
+		else                *p++ = sgr_nearest_ansi(r, g, b, q->size);
+	}
+	memset(p, 0, 3);
+	return q;
+}
+
+void sgr_quant_free(struct sgr_quant *q)
+{
+	free(q);
+}
+
+static inline int sgr_quant_key(uint32_t rgb)
+{
+	return ((rgb >> 19) & 0x1f) << 10 | ((rgb >> 11) & 0x1f) << 5 |
+	       ((rgb >> 3) & 0x1f);
+}
+
+uint8_t sgr_quant_index(const struct sgr_quant *q, uint32_t rgb)
+{
+	return q->lut[sgr_quant_key(rgb)];
+}
+
+static void sgr_quant_row_scalar(const uint8_t *lut, uint8_t *dst,
+                                 const uint32_t *rgb, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		dst[i] = lut[sgr_quant_key(rgb[i])];
+	}
+}
+
+#ifdef SGR_X86
+__attribute__((target("avx2")))
+static void sgr_quant_row_avx2(const uint8_t *lut, uint8_t *dst,
+                               const uint32_t *rgb, size_t n)
+{
+	const __m256i mask = _mm256_set1_epi32(0x1f);
+	// low byte of each 32-bit lane to the front of its 128-bit half
+	const __m256i pack = _mm256_setr_epi8(
+		0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(rgb + i));
+		__m256i r = _mm256_and_si256(_mm256_srli_epi32(v, 19), mask);
+		__m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 11), mask);
+		__m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 3), mask);
+		__m256i key = _mm256_or_si256(_mm256_slli_epi32(r, 10),
+		              _mm256_or_si256(_mm256_slli_epi32(g, 5), b));
+
+		// 32-bit gathers at byte offsets, only the low byte is used
+		__m256i idx = _mm256_i32gather_epi32((const int*)lut, key, 1);
+		idx = _mm256_shuffle_epi8(idx, pack);
+		uint32_t lo = _mm256_extract_epi32(idx, 0);
+		uint32_t hi = _mm256_extract_epi32(idx, 4);
+		memcpy(dst + i, &lo, 4);
+		memcpy(dst + i + 4, &hi, 4);
+	}
+	sgr_quant_row_scalar(lut, dst + i, rgb + i, n - i);
+}
+#endif
+
+static void sgr_quant_row_path(const struct sgr_quant *q, uint8_t *dst,
+                               const uint32_t *rgb, size_t n, int path)
+{
+#ifdef SGR_X86
+	if (sgr_path(path) == SGR_PATH_AVX2) {
+		sgr_quant_row_avx2(q->lut, dst, rgb, n);
 		return;
 	}
+#else
+	(void)path;
+#endif
+	// a scalar loop is as fast as SSE2 without gathers
+	sgr_quant_row_scalar(q->lut, dst, rgb, n);
+}
 
-	f->sz += sz;
+void sgr_quant_row(const struct sgr_quant *q, uint8_t *dst,
+                   const uint32_t *rgb, size_t n)
+{
+	sgr_quant_row_path(q, dst, rgb, n, SGR_PATH_AUTO);
 }
 
-int sgr_write(int fd, struct sgr sgr)
+// Color mode and color for a palette index, shifted like the fg mode bits.
+static inline int sgr_quant_mode(const struct sgr_quant *q, uint32_t *color)
 {
-	struct fdinfo f = { fd, 0, 0 };
-	sgr_encode(&f, fd_write, sgr);
-	if (f.err) {
-		return -1;
+	*color = q->lut[sgr_quant_key(*color)];
+	if (q->size == 256) return SGR_FG256;
+	if (*color < 8) return SGR_FG;
+	*color -= 8;
+	return SGR_FG16;
+}
+
+struct sgr sgr_quant_sgr(const struct sgr_quant *q, struct sgr sgr)
+{
+	if (q->colors >= SGR_QUANT_DIRECT) return sgr;
+
+	if ((sgr.at & SGR_FG_MASK) == SGR_FG16M) {
+		uint32_t color = sgr.fg;
+		int mode = sgr_quant_mode(q, &color);
+		sgr.at = (sgr.at & ~SGR_FG_MASK) | mode;
+		sgr.fg = color;
+	}
+	if ((sgr.at & SGR_BG_MASK) == SGR_BG16M) {
+		uint32_t color = sgr.bg;
+		int mode = sgr_quant_mode(q, &color);
+		// bg modes use the same numbering three bits up
+		sgr.at = (sgr.at & ~SGR_BG_MASK) | (mode << 3);
+		sgr.bg = color;
 	}
-	return f.sz;
+	return sgr;
 }
 
 
+// Parser states.
+#define SGR_PARSE_GROUND  0  // text
+#define SGR_PARSE_UTF8    1  // inside a multibyte utf8 char
+#define SGR_PARSE_ESC     2  // after ESC
+#define SGR_PARSE_CSI     3  // after ESC [
+#define SGR_PARSE_STR     4  // OSC, DCS, and other strings up to BEL or ST
+#define SGR_PARSE_STR_ESC 5  // ESC inside a string, maybe ST
 
-struct streaminfo {
-	FILE *stream;
-	int sz;
-	int err;
-	int eof;
-};
+#define SGR_REPLACEMENT 0xfffd
+
+void sgr_parser_init(struct sgr_parser *p)
+{
+	memset(p, 0, sizeof(*p));
+}
 
-static void stream_write(void *dest, char *src, int n)
+// Length of the run of ASCII bytes other than ESC at the start of s.
+static size_t sgr_plain_run_scalar(const unsigned char *s, size_t n)
 {
-	struct streaminfo *f = dest;
-	if (f->err || f->eof) return;
+	size_t i = 0;
+	while (i < n && s[i] < 0x80 && s[i] != 0x1b) i++;
+	return i;
+}
 
-	size_t sz = fwrite(src, 1, n, f->stream);
-	f->sz += sz;
+#ifdef SGR_X86
+static size_t sgr_plain_run_sse2(const unsigned char *s, size_t n)
+{
+	const __m128i esc = _mm_set1_epi8(0x1b);
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+		// the high bit of bytes 0x80 and up is set already
+		unsigned mask = _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, esc)));
+		if (mask) return i + __builtin_ctz(mask);
+	}
+	return i + sgr_plain_run_scalar(s + i, n - i);
+}
 
-	if (sz < (size_t)n) {
-		f->eof = feof(f->stream);
-		f->err = ferror(f->stream);
+__attribute__((target("avx2")))
+static size_t sgr_plain_run_avx2(const unsigned char *s, size_t n)
+{
+	const __m256i esc = _mm256_set1_epi8(0x1b);
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+		unsigned mask = _mm256_movemask_epi8(
+			_mm256_or_si256(v, _mm256_cmpeq_epi8(v, esc)));
+		if (mask) return i + __builtin_ctz(mask);
 	}
+	return i + sgr_plain_run_sse2(s + i, n - i);
 }
+#endif
 
-int sgr_fwrite(FILE *stream, struct sgr sgr)
+static size_t sgr_plain_run(const unsigned char *s, size_t n, int path)
 {
-	struct streaminfo f = { stream, 0, 0, 0 };
-	sgr_encode(&f, stream_write, sgr);
-	if (f.err || f.eof) {
-		return -1;
+#ifdef SGR_X86
+	if (path == SGR_PATH_AVX2) return sgr_plain_run_avx2(s, n);
+	if (path == SGR_PATH_SSE2) return sgr_plain_run_sse2(s, n);
+#else
+	(void)path;
+#endif
+	return sgr_plain_run_scalar(s, n);
+}
+
+static inline void sgr_parse_set_fg(struct sgr *s, int mode, uint32_t color)
+{
+	s->at = (s->at & ~SGR_FG_MASK) | mode;
+	s->fg = mode ? color : 0;
+}
+
+static inline void sgr_parse_set_bg(struct sgr *s, int mode, uint32_t color)
+{
+	s->at = (s->at & ~SGR_BG_MASK) | mode;
+	s->bg = mode ? color : 0;
+}
+
+// Parse the color following a 38 or 48 code at v[i], in either the
+// 38;5;n / 38;2;r;g;b form or the 38:5:n / 38:2:[id]:r:g:b form. end is the
+// end of the colon separated group starting at v[i].
+// Returns the index of the last param used, or n when the color is invalid.
+static int sgr_parse_color(struct sgr *s, const uint16_t *v, int i, int end,
+                           int n, int bg)
+{
+	int mode = 0, last;
+	uint32_t color = 0;
+	const uint16_t *c;
+
+	if (end > i + 1) {
+		// colon form, the color space id of 38:2 is optional
+		c = v + i + 2;
+		last = end - 1;
+		if (v[i + 1] == 5 && end - i >= 3) {
+			mode = SGR_FG256;
+		} else if (v[i + 1] == 2 && end - i >= 5) {
+			mode = SGR_FG16M;
+			if (end - i >= 6) c++;
+		}
+	} else if (i + 2 < n && v[i + 1] == 5) {
+		c = v + i + 2;
+		last = i + 2;
+		mode = SGR_FG256;
+	} else if (i + 4 < n && v[i + 1] == 2) {
+		c = v + i + 2;
+		last = i + 4;
+		mode = SGR_FG16M;
+	} else {
+		return n;
+	}
+
+	if (mode == SGR_FG256) {
+		color = c[0] > 255 ? 255 : c[0];
+	} else if (mode == SGR_FG16M) {
+		for (int k = 0; k < 3; k++) {
+			color = color << 8 | (c[k] > 255 ? 255 : c[k]);
+		}
+	} else {
+		return last;
+	}
+
+	if (bg) sgr_parse_set_bg(s, mode << 3, color);
+	else    sgr_parse_set_fg(s, mode, color);
+	return last;
+}
+
+// Apply the params of a finished SGR sequence to the current attributes.
+static void sgr_parse_apply(struct sgr_parser *p)
+{
+	int n = p->nparams > SGR_PARSE_PARAMS_MAX ? SGR_PARSE_PARAMS_MAX : p->nparams;
+	const uint16_t *v = p->params;
+	struct sgr s = p->sgr;
+
+	for (int i = 0; i < n; i++) {
+		// params after ':' belong to the code before them
+		int end = i + 1;
+		while (end < n && (p->sub >> end & 1)) end++;
+
+		int c = v[i];
+		switch (c) {
+		case 0:  s = (struct sgr){0};    break;
+		case 1:  s.at |= SGR_BOLD;       break;
+		case 2:  s.at |= SGR_FAINT;      break;
+		case 3:  s.at |= SGR_ITALIC;     break;
+		case 5:
+		case 6:  s.at |= SGR_BLINK;      break;
+		case 7:  s.at |= SGR_REVERSE;    break;
+		case 8:  s.at |= SGR_CONCEAL;    break;
+		case 9:  s.at |= SGR_STRIKE;     break;
+		case 21: s.at |= SGR_UNDERLINE;  break; // double underline
+		case 22: s.at &= ~(SGR_BOLD|SGR_FAINT); break;
+		case 23: s.at &= ~SGR_ITALIC;    break;
+		case 24: s.at &= ~SGR_UNDERLINE; break;
+		case 25: s.at &= ~SGR_BLINK;     break;
+		case 27: s.at &= ~SGR_REVERSE;   break;
+		case 28: s.at &= ~SGR_CONCEAL;   break;
+		case 29: s.at &= ~SGR_STRIKE;    break;
+		case 39: sgr_parse_set_fg(&s, 0, 0); break;
+		case 49: sgr_parse_set_bg(&s, 0, 0); break;
+		case 4:
+			// 4:0 is no underline, 4:1 to 4:5 are underline styles
+			if (end > i + 1 && v[i + 1] == 0) s.at &= ~SGR_UNDERLINE;
+			else                              s.at |= SGR_UNDERLINE;
+			break;
+		case 38:
+		case 48:
+			i = sgr_parse_color(&s, v, i, end, n, c == 48);
+			continue;
+		default:
+			if (c >= 30 && c <= 37)   sgr_parse_set_fg(&s, SGR_FG, c - 30);
+			if (c >= 90 && c <= 97)   sgr_parse_set_fg(&s, SGR_FG16, c - 90);
+			if (c >= 40 && c <= 47)   sgr_parse_set_bg(&s, SGR_BG, c - 40);
+			if (c >= 100 && c <= 107) sgr_parse_set_bg(&s, SGR_BG16, c - 100);
+			break;
+		}
+		i = end - 1;
+	}
+
+	p->sgr = s;
+}
+
+static size_t sgr_parse_path(struct sgr_parser *p, struct sgr_cell *cells,
+                             size_t max, const char *buf, size_t len,
+                             size_t *used, int path)
+{
+	const unsigned char *s = (const unsigned char*)buf;
+	size_t i = 0, n = 0;
+	path = sgr_path(path);
+
+	while (i < len && n < max) {
+		unsigned char c = s[i];
+
+		switch (p->state) {
+		case SGR_PARSE_GROUND:
+			if (c < 0x80 && c != 0x1b) {
+				size_t room = len - i < max - n ? len - i : max - n;
+				size_t run = sgr_plain_run(s + i, room, path);
+				for (size_t k = 0; k < run; k++) {
+					cells[n + k].ch = s[i + k];
+					cells[n + k].sgr = p->sgr;
+				}
+				i += run;
+				n += run;
+				break;
+			}
+			i++;
+			if (c == 0x1b) {
+				p->state = SGR_PARSE_ESC;
+			} else if (c >= 0xc2 && c <= 0xf4) {
+				// the second byte range rules out overlongs,
+				// surrogates and codepoints past U+10FFFF
+				p->need = c < 0xe0 ? 1 : c < 0xf0 ? 2 : 3;
+				p->cp = c & (0x3f >> p->need);
+				p->lo = c == 0xe0 ? 0xa0 : c == 0xf0 ? 0x90 : 0x80;
+				p->hi = c == 0xed ? 0x9f : c == 0xf4 ? 0x8f : 0xbf;
+				p->state = SGR_PARSE_UTF8;
+			} else {
+				cells[n++] = (struct sgr_cell){SGR_REPLACEMENT, p->sgr};
+			}
+			break;
+
+		case SGR_PARSE_UTF8:
+			if (c < p->lo || c > p->hi) {
+				// truncated or malformed char, c starts over as text
+				cells[n++] = (struct sgr_cell){SGR_REPLACEMENT, p->sgr};
+				p->state = SGR_PARSE_GROUND;
+				break;
+			}
+			i++;
+			p->cp = p->cp << 6 | (c & 0x3f);
+			p->lo = 0x80;
+			p->hi = 0xbf;
+			if (--p->need == 0) {
+				cells[n++] = (struct sgr_cell){p->cp, p->sgr};
+				p->state = SGR_PARSE_GROUND;
+			}
+			break;
+
+		case SGR_PARSE_ESC:
+			i++;
+			if (c == '[') {
+				p->state = SGR_PARSE_CSI;
+				p->nparams = 1;
+				p->params[0] = 0;
+				p->sub = 0;
+				p->ignore = 0;
+			} else if (c == ']' || c == 'P' || c == 'X' || c == '^' || c == '_') {
+				p->state = SGR_PARSE_STR;
+			} else if (c != 0x1b && (c < 0x20 || c > 0x2f)) {
+				// other sequences end at the first byte that isn't
+				// an intermediate like the '(' in ESC ( B
+				p->state = SGR_PARSE_GROUND;
+			}
+			break;
+
+		case SGR_PARSE_CSI:
+			i++;
+			if (c >= '0' && c <= '9') {
+				if (p->nparams > SGR_PARSE_PARAMS_MAX) break;
+				uint16_t *v = &p->params[p->nparams - 1];
+				uint32_t x = *v * 10 + (c - '0');
+				*v = x > 0xffff ? 0xffff : x;
+			} else if (c == ';' || c == ':') {
+				if (p->nparams >= SGR_PARSE_PARAMS_MAX) {
+					p->nparams = SGR_PARSE_PARAMS_MAX + 1;
+					break;
+				}
+				if (c == ':') p->sub |= 1u << p->nparams;
+				p->params[p->nparams++] = 0;
+			} else if (c >= 0x20 && c <= 0x3f) {
+				// private markers and intermediates aren't SGR
+				p->ignore = 1;
+			} else if (c >= 0x40 && c <= 0x7e) {
+				if (c == 'm' && !p->ignore) sgr_parse_apply(p);
+				p->state = SGR_PARSE_GROUND;
+			} else if (c == 0x1b) {
+				// cancelled by a new sequence
+				p->state = SGR_PARSE_ESC;
+			}
+			break;
+
+		case SGR_PARSE_STR:
+			i++;
+			if (c == 0x07) p->state = SGR_PARSE_GROUND;
+			if (c == 0x1b) p->state = SGR_PARSE_STR_ESC;
+			break;
+
+		case SGR_PARSE_STR_ESC:
+			// ESC \ ends the string, any other ESC starts a new sequence
+			if (c == '\\') {
+				i++;
+				p->state = SGR_PARSE_GROUND;
+			} else {
+				p->state = SGR_PARSE_ESC;
+			}
+			break;
+		}
 	}
-	return f.sz;
+
+	*used = i;
+	return n;
+}
+
+size_t sgr_parse(struct sgr_parser *p, struct sgr_cell *cells, size_t max,
+                 const char *buf, size_t len, size_t *used)
+{
+	return sgr_parse_path(p, cells, max, buf, len, used, SGR_PATH_AUTO);
 }
 
 // vim: noexpandtab
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -179,9 +180,10 @@ int sgr_write(int fd, struct sgr);
 int sgr_fwrite(FILE *stream, struct sgr);
 
 /* Generic SGR value encoder. Takes a pointer to anything and a function that
- * will be called with the pointer any time chars should be emitted. This is
- * used to implement the sgr_str, sgr_write, and sgr_fwrite functions and may
- * be useful if you're writing to a unique output medium.
+ * will be called with the pointer and the whole escape sequence once it has
+ * been formatted. The sgr_str, sgr_write, and sgr_fwrite functions use the
+ * same single pass formatter; this may be useful if you're writing to a unique
+ * output medium.
  *
  * Returns the number of bytes sent to func.
  */
@@ -194,3 +196,136 @@ int sgr_encode(void *p, void (*func)(void *, char *, int), struct sgr);
  * Returns the number of formatting code ints written to the codes buffer.
  */
 int sgr_unpack(uint16_t codes[], struct sgr);
+
+/*
+ * Write the shortest escape sequence that moves the terminal from the prev
+ * state to the next state to the char buffer pointed to by dest. There must be
+ * SGR_STR_MAX bytes available after the dest pointer.
+ *
+ * Both values are complete states: unset attributes are off and unset colors
+ * are the terminal defaults. The SGR_RESET and SGR_NEGATE control bits are
+ * ignored. Attributes are turned off with their own codes (22, 23, 24, 25,
+ * 27, 29) and colors are restored with 39 and 49, unless starting over with a
+ * reset is shorter.
+ *
+ * Returns the number of bytes written, 0 when the states render the same.
+ */
+int sgr_diff(char *dest, struct sgr prev, struct sgr next);
+
+/*
+ * Pen tracking the SGR state of a terminal.
+ *
+ * A zero initialized pen is in an unknown state and the first sequence written
+ * through it resets all attributes. Call sgr_pen_reset() after sending sgr0 or
+ * anything else that restores the defaults, and sgr_pen_invalidate() when
+ * something else may have changed the terminal state.
+ */
+struct sgr_pen {
+	struct sgr sgr;         // current terminal state
+	int valid;              // sgr is known to match the terminal
+};
+
+void sgr_pen_reset(struct sgr_pen *pen);
+void sgr_pen_invalidate(struct sgr_pen *pen);
+
+/*
+ * Write the sequence that changes the pen state to sgr to the char buffer
+ * pointed to by dest, like sgr_diff(), and update the pen.
+ *
+ * Returns the number of bytes written, 0 when the terminal is already in that
+ * state.
+ */
+int sgr_pen_str(struct sgr_pen *pen, char *dest, struct sgr sgr);
+
+/*
+ * True color quantization
+ *
+ * Maps 24-bit 0xRRGGBB colors onto the palette a terminal supports with a
+ * precomputed 32x32x32 lookup table. Table entries hold the palette color
+ * nearest to the center of their cell by the "redmean" weighted distance, an
+ * approximation of perceived color difference.
+ *
+ * The colors argument is the terminal's terminfo "colors" number:
+ *
+ *     256 and up   xterm 256-color palette, cube and grays (16-255)
+ *     16 to 255    16 ANSI colors including the bright ones (0-15)
+ *     below 16     8 ANSI colors (0-7)
+ *
+ * Terminals with 0x1000000 colors or more take direct colors; the table then
+ * maps to the 256-color palette but sgr_quant_sgr() leaves colors unchanged.
+ */
+#define SGR_QUANT_DIRECT 0x1000000  // colors value of direct color terminals
+
+struct sgr_quant;
+
+/*
+ * Build a quantization table for a terminal with the given number of colors.
+ * Building takes a few milliseconds; keep the table around.
+ *
+ * Returns NULL when out of memory.
+ */
+struct sgr_quant *sgr_quant_new(int colors);
+void sgr_quant_free(struct sgr_quant *q);
+
+/* Palette index of the color nearest to rgb. */
+uint8_t sgr_quant_index(const struct sgr_quant *q, uint32_t rgb);
+
+/*
+ * Write palette indexes for n 0xRRGGBB colors to dst, using AVX2 gathers for
+ * eight colors at a time when the CPU has them.
+ */
+void sgr_quant_row(const struct sgr_quant *q, uint8_t *dst,
+                   const uint32_t *rgb, size_t n);
+
+/*
+ * Replace SGR_FG16M and SGR_BG16M colors in sgr with the nearest palette color
+ * in the matching 8, 16, or 256-color mode. Other colors are left alone.
+ */
+struct sgr sgr_quant_sgr(const struct sgr_quant *q, struct sgr sgr);
+
+/*
+ * SGR parsing
+ *
+ * The parser turns text containing SGR sequences, like the output of
+ * `ls --color` or a compiler, into cells of one codepoint and the attributes it
+ * was written with. It is the inverse of sgr_str(), except that palette colors
+ * always come back in SGR_FG256/SGR_BG256 mode.
+ *
+ * Input can be fed in pieces of any size; escape sequences and utf8 characters
+ * split across buffers are completed by the next call. Other escape sequences
+ * (cursor movement, OSC titles and hyperlinks, etc.) are skipped. Control
+ * characters like '\n' and '\t' come out as cells. Malformed utf8 comes out as
+ * U+FFFD.
+ */
+struct sgr_cell {
+	uint32_t ch;            // unicode codepoint
+	struct sgr sgr;         // attributes at the codepoint
+};
+
+#define SGR_PARSE_PARAMS_MAX 32  // params kept from one sequence
+
+struct sgr_parser {
+	struct sgr sgr;         // current attributes
+	int state;              // where the last input left off
+	uint32_t cp;            // partial utf8 codepoint
+	int need;               // utf8 continuation bytes still expected
+	unsigned char lo, hi;   // range of the next continuation byte
+	int nparams;            // params of the current sequence
+	int ignore;             // current sequence isn't SGR
+	uint32_t sub;           // bits for params that follow a ':'
+	uint16_t params[SGR_PARSE_PARAMS_MAX];
+};
+
+/* Initialize a parser with default attributes. */
+void sgr_parser_init(struct sgr_parser *p);
+
+/*
+ * Parse up to len bytes from buf and write at most max cells to cells.
+ * Plain text between escape sequences is scanned 16 or 32 bytes at a time with
+ * SSE2 or AVX2 when the CPU has them.
+ *
+ * Sets *used to the number of bytes consumed, which is less than len only when
+ * the cells array filled up. Returns the number of cells written.
+ */
+size_t sgr_parse(struct sgr_parser *p, struct sgr_cell *cells, size_t max,
+                 const char *buf, size_t len, size_t *used);
@@ -0,0 +1,157 @@
+/* stresc.inl */
+
+/*
+ * Escape-for-display kernel shared by ti_stresc() and tkbd_stresc().
+ *
+ * Printable ASCII is copied through in runs found 16 or 32 bytes at a time
+ * with SSE2 or AVX2 when the CPU has them, and byte by byte otherwise.
+ * Everything else is written as a backslash escape: a letter from the
+ * stresc_letters table for the common control characters, or three octal
+ * digits.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define STRESC_X86 1
+#endif
+
+#define STRESC_BACKSLASH 0x1  // escape '\' as "\\"
+#define STRESC_NUL       0x2  // escape NUL as "\0" instead of "\000"
+
+#define STRESC_PATH_AUTO   0  // best path the CPU supports
+#define STRESC_PATH_SCALAR 1
+#define STRESC_PATH_SSE2   2
+#define STRESC_PATH_AVX2   3
+
+// Letter escapes, zero for bytes written in octal.
+static const char stresc_letters[256] = {
+	['\033'] = 'e', ['\t'] = 't', ['\n'] = 'n', ['\r'] = 'r', ['\\'] = '\\',
+};
+
+// Length of the printable run at the start of s, up to n bytes.
+static size_t stresc_run_scalar(const unsigned char *s, size_t n, int flags) {
+	size_t i = 0;
+	for (; i < n; i++) {
+		if (s[i] < ' ' || s[i] > '~') break;
+		if (s[i] == '\\' && (flags & STRESC_BACKSLASH)) break;
+	}
+	return i;
+}
+
+#ifdef STRESC_X86
+static size_t stresc_run_sse2(const unsigned char *s, size_t n, int flags) {
+	const __m128i lo = _mm_set1_epi8(' ' - 1);
+	const __m128i hi = _mm_set1_epi8('~' + 1);
+	const __m128i bs = _mm_set1_epi8((flags & STRESC_BACKSLASH) ? '\\' : ' ');
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16) {
+		// bytes 0x80 and up are negative and fail the signed lower bound
+		__m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+		__m128i ok = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+		if (flags & STRESC_BACKSLASH) {
+			ok = _mm_andnot_si128(_mm_cmpeq_epi8(v, bs), ok);
+		}
+		unsigned int mask = _mm_movemask_epi8(ok) ^ 0xffff;
+		if (mask) return i + __builtin_ctz(mask);
+	}
+	return i + stresc_run_scalar(s + i, n - i, flags);
+}
+
+__attribute__((target("avx2")))
+static size_t stresc_run_avx2(const unsigned char *s, size_t n, int flags) {
+	const __m256i lo = _mm256_set1_epi8(' ' - 1);
+	const __m256i hi = _mm256_set1_epi8('~' + 1);
+	const __m256i bs = _mm256_set1_epi8((flags & STRESC_BACKSLASH) ? '\\' : ' ');
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+		__m256i ok = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo),
+		                              _mm256_cmpgt_epi8(hi, v));
+		if (flags & STRESC_BACKSLASH) {
+			ok = _mm256_andnot_si256(_mm256_cmpeq_epi8(v, bs), ok);
+		}
+		unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(ok);
+		if (mask) return i + __builtin_ctz(mask);
+	}
+	return i + stresc_run_sse2(s + i, n - i, flags);
+}
+#endif
+
+static int stresc_path(int path) {
+#ifdef STRESC_X86
+	if (path == STRESC_PATH_AUTO) {
+		path = __builtin_cpu_supports("avx2") ? STRESC_PATH_AVX2 : STRESC_PATH_SSE2;
+	}
+	return path;
+#else
+	(void)path;
+	return STRESC_PATH_SCALAR;
+#endif
+}
+
+static size_t stresc_run(const unsigned char *s, size_t n, int flags, int path) {
+#ifdef STRESC_X86
+	if (path == STRESC_PATH_AVX2) return stresc_run_avx2(s, n, flags);
+	if (path == STRESC_PATH_SSE2) return stresc_run_sse2(s, n, flags);
+#else
+	(void)path;
+#endif
+	return stresc_run_scalar(s, n, flags);
+}
+
+// Escape up to len bytes of str into buf, writing at most room bytes and never
+// splitting an escape. Nothing is null terminated.
+//
+// Sets *used to the number of input bytes consumed and returns the number of
+// bytes written.
+static size_t stresc_kernel(char *buf, size_t room, const char *str,
+                            size_t len, size_t *used, int flags, int path) {
+	const unsigned char *s = (const unsigned char*)str;
+	size_t i = 0, pos = 0;
+	path = stresc_path(path);
+
+	while (i < len && pos < room) {
+		size_t max = len - i < room - pos ? len - i : room - pos;
+		size_t run = stresc_run(s + i, max, flags, path);
+		memcpy(buf + pos, s + i, run);
+		i += run;
+		pos += run;
+		if (run == max) continue;
+
+		// escape bytes up to the next printable one
+		for (; i < len; i++) {
+			unsigned char c = s[i];
+			char letter = stresc_letters[c];
+			if (c == '\\') {
+				if (!(flags & STRESC_BACKSLASH)) break;
+			} else if (c >= ' ' && c <= '~') {
+				break;
+			} else if (c == 0 && (flags & STRESC_NUL)) {
+				letter = '0';
+			}
+
+			if (letter) {
+				if (room - pos < 2) goto done;
+				buf[pos++] = '\\';
+				buf[pos++] = letter;
+			} else {
+				if (room - pos < 4) goto done;
+				buf[pos++] = '\\';
+				buf[pos++] = '0' + (c >> 6);
+				buf[pos++] = '0' + ((c >> 3) & 7);
+				buf[pos++] = '0' + (c & 7);
+			}
+		}
+	}
+
+done:
+	*used = i;
+	return pos;
+}
+
+// vim: noexpandtab
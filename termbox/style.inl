@@ -0,0 +1,137 @@
+/* style.inl */
+
+/*
+ * Style pool and compact cells.
+ *
+ * Each distinct struct sgr used on screen is interned once and cells refer to
+ * it by a 16-bit id, so a cell fits in 8 bytes: a 21-bit codepoint, its display
+ * width, and the style id. Style 0 is always the all default struct sgr.
+ */
+
+#define STYLE_MAX     0x10000  // number of style ids
+#define STYLE_DEFAULT 0
+
+struct stylepool {
+	struct sgr *styles;     // sgr value by style id
+	uint32_t *slots;        // hash table of style id + 1, 0 when empty
+	int count;              // styles in use
+	int cap;                // size of the styles array
+	int mask;               // hash table size - 1
+
+	// last interned style, text is mostly written in runs of one style
+	struct sgr last;
+	int last_id;
+};
+
+static uint64_t style_key(struct sgr sgr) {
+	uint64_t key;
+	memcpy(&key, &sgr, sizeof(key));
+	return key;
+}
+
+static uint32_t style_hash(uint64_t key) {
+	key *= 0x9e3779b97f4a7c15ull;
+	return (uint32_t)(key >> 32);
+}
+
+static void stylepool_free(struct stylepool *p) {
+	free(p->styles);
+	free(p->slots);
+	memset(p, 0, sizeof(*p));
+}
+
+static void stylepool_init(struct stylepool *p) {
+	memset(p, 0, sizeof(*p));
+	p->cap = 64;
+	p->mask = 127;
+	p->styles = malloc(p->cap * sizeof(struct sgr));
+	p->slots = calloc(p->mask + 1, sizeof(uint32_t));
+	assert(p->styles && p->slots); // just assume malloc works always
+
+	// the default style is id 0, it hashes like any other
+	p->styles[STYLE_DEFAULT] = (struct sgr){0};
+	p->count = 1;
+	uint32_t i = style_hash(0) & p->mask;
+	p->slots[i] = STYLE_DEFAULT + 1;
+	p->last_id = STYLE_DEFAULT;
+}
+
+static void stylepool_grow(struct stylepool *p) {
+	int mask = p->mask * 2 + 1;
+	uint32_t *slots = calloc(mask + 1, sizeof(uint32_t));
+	assert(slots);
+	for (int id = 0; id < p->count; id++) {
+		uint32_t i = style_hash(style_key(p->styles[id])) & mask;
+		while (slots[i]) i = (i + 1) & mask;
+		slots[i] = id + 1;
+	}
+	free(p->slots);
+	p->slots = slots;
+	p->mask = mask;
+}
+
+// Returns the id of the style, adding it to the pool when it's new, or -1
+// when all STYLE_MAX ids are in use.
+static int stylepool_intern(struct stylepool *p, struct sgr sgr) {
+	uint64_t key = style_key(sgr);
+	if (key == style_key(p->last)) return p->last_id;
+
+	uint32_t i = style_hash(key) & p->mask;
+	for (; p->slots[i]; i = (i + 1) & p->mask) {
+		int id = p->slots[i] - 1;
+		if (style_key(p->styles[id]) == key) {
+			p->last = sgr;
+			p->last_id = id;
+			return id;
+		}
+	}
+
+	if (p->count == STYLE_MAX) return -1;
+	if (p->count == p->cap) {
+		p->cap *= 2;
+		p->styles = realloc(p->styles, p->cap * sizeof(struct sgr));
+		assert(p->styles);
+	}
+
+	int id = p->count++;
+	p->styles[id] = sgr;
+	p->slots[i] = id + 1;
+	if (p->count * 2 > p->mask + 1) stylepool_grow(p);
+
+	p->last = sgr;
+	p->last_id = id;
+	return id;
+}
+
+static inline struct sgr stylepool_get(const struct stylepool *p, int id) {
+	return p->styles[id];
+}
+
+
+#define CELL_CH_MASK  0x1fffff  // 21 bits, enough for any codepoint
+#define CELL_W_SHIFT  21
+
+struct cell {
+	uint32_t chw;           // codepoint and display width << CELL_W_SHIFT
+	uint16_t style;         // style id
+	uint16_t pad;           // always 0 so cells compare as 64-bit values
+};
+
+static inline struct cell cell_make(uint32_t ch, int width, int style) {
+	if (ch > CELL_CH_MASK) ch = 0xfffd;
+	return (struct cell){ch | (uint32_t)width << CELL_W_SHIFT, style, 0};
+}
+
+static inline uint32_t cell_ch(struct cell c) {
+	return c.chw & CELL_CH_MASK;
+}
+
+static inline int cell_width(struct cell c) {
+	return c.chw >> CELL_W_SHIFT;
+}
+
+static inline int cell_eq(struct cell a, struct cell b) {
+	return a.chw == b.chw && a.style == b.style;
+}
+
+// vim: noexpandtab
@@ -1,4 +1,6 @@
 /* term.inl */
+#include <ctype.h>
+
 #include "ti.h"
 
 enum {
@@ -28,42 +30,87 @@ static const char **funcs;
 
 #define TB_KEYS_NUM 22
 
-static const int16_t ti_funcs[] = {
-	ti_smcup,         // T_ENTER_CA
-	ti_rmcup,         // T_EXIT_CA
-	ti_cnorm,         // T_SHOW_CURSOR
-	ti_civis,         // T_HIDE_CURSOR
-	ti_clear,         // T_CLEAR_SCREEN
-	ti_sgr0,          // T_SGR0
-	ti_smkx,          // T_ENTER_KEYPAD
-	ti_rmkx,          // T_EXIT_KEYPAD
+// Escape sequences loaded from terminfo. The keys array is NULL terminated.
+static struct term_caps {
+	const char *funcs[T_FUNCS_NUM];
+	const char *keys[TB_KEYS_NUM+1];
+
+	// scrolling and cursor motion, NULL when the terminal doesn't have them
+	const char *csr, *ind, *ri, *il, *dl, *il1, *dl1, *cup;
+	const char *hpa, *vpa, *cuf, *cub, *cud, *cuu;
+	const char *cuf1, *cub1, *cud1, *cuu1, *cr, *home;
+	int bce;
+} caps;
+
+// Parameterized strings bound for ti_fastparm_fmt().
+static struct term_parms {
+	ti_fastparm csr, il, dl;
+} parms;
+static ti_fastcaps fast;
+
+#define FUNC(name, i) TI_CAP(TI_STR, name, struct term_caps, funcs[i])
+#define KEY(name, i)  TI_CAP(TI_STR, name, struct term_caps, keys[i])
+#define CAP(type, name) TI_CAP(type, #name, struct term_caps, name)
+
+static const struct ti_capdesc term_capdescs[] = {
+	FUNC("smcup", T_ENTER_CA),
+	FUNC("rmcup", T_EXIT_CA),
+	FUNC("cnorm", T_SHOW_CURSOR),
+	FUNC("civis", T_HIDE_CURSOR),
+	FUNC("clear", T_CLEAR_SCREEN),
+	FUNC("sgr0",  T_SGR0),
+	FUNC("smkx",  T_ENTER_KEYPAD),
+	FUNC("rmkx",  T_EXIT_KEYPAD),
+
+	KEY("kf1",    0),  // TB_KEY_F1
+	KEY("kf2",    1),  // TB_KEY_F2
+	KEY("kf3",    2),  // TB_KEY_F3
+	KEY("kf4",    3),  // TB_KEY_F4
+	KEY("kf5",    4),  // TB_KEY_F5
+	KEY("kf6",    5),  // TB_KEY_F6
+	KEY("kf7",    6),  // TB_KEY_F7
+	KEY("kf8",    7),  // TB_KEY_F8
+	KEY("kf9",    8),  // TB_KEY_F9
+	KEY("kf10",   9),  // TB_KEY_F10
+	KEY("kf11",  10),  // TB_KEY_F11
+	KEY("kf12",  11),  // TB_KEY_F12
+	KEY("kich1", 12),  // TB_KEY_INSERT
+	KEY("kdch1", 13),  // TB_KEY_DELETE
+	KEY("khome", 14),  // TB_KEY_HOME
+	KEY("kend",  15),  // TB_KEY_END
+	KEY("kpp",   16),  // TB_KEY_PGUP
+	KEY("knp",   17),  // TB_KEY_PGDN
+	KEY("kcuu1", 18),  // TB_KEY_ARROW_UP
+	KEY("kcud1", 19),  // TB_KEY_ARROW_DOWN
+	KEY("kcub1", 20),  // TB_KEY_ARROW_LEFT
+	KEY("kcuf1", 21),  // TB_KEY_ARROW_RIGHT
+
+	CAP(TI_STR,  csr),
+	CAP(TI_STR,  ind),
+	CAP(TI_STR,  ri),
+	CAP(TI_STR,  il),
+	CAP(TI_STR,  dl),
+	CAP(TI_STR,  il1),
+	CAP(TI_STR,  dl1),
+	CAP(TI_STR,  cup),
+	CAP(TI_STR,  hpa),
+	CAP(TI_STR,  vpa),
+	CAP(TI_STR,  cuf),
+	CAP(TI_STR,  cub),
+	CAP(TI_STR,  cud),
+	CAP(TI_STR,  cuu),
+	CAP(TI_STR,  cuf1),
+	CAP(TI_STR,  cub1),
+	CAP(TI_STR,  cud1),
+	CAP(TI_STR,  cuu1),
+	CAP(TI_STR,  cr),
+	CAP(TI_STR,  home),
+	CAP(TI_BOOL, bce),
 };
 
-
-static const int16_t ti_keys[] = {
-	ti_kf1,           // TB_KEY_F1
-	ti_kf2,           // TB_KEY_F2
-	ti_kf3,           // TB_KEY_F3
-	ti_kf4,           // TB_KEY_F4
-	ti_kf5,           // TB_KEY_F5
-	ti_kf6,           // TB_KEY_F6
-	ti_kf7,           // TB_KEY_F7
-	ti_kf8,           // TB_KEY_F8
-	ti_kf9,           // TB_KEY_F9
-	ti_kf10,          // TB_KEY_F10
-	ti_kf11,          // TB_KEY_F11
-	ti_kf12,          // TB_KEY_F12
-	ti_kich1,         // TB_KEY_INSERT
-	ti_kdch1,         // TB_KEY_DELETE
-	ti_khome,         // TB_KEY_HOME
-	ti_kend,          // TB_KEY_END
-	ti_kpp,           // TB_KEY_PGUP
-	ti_knp,           // TB_KEY_PGDN
-	ti_kcuu1,         // TB_KEY_ARROW_UP
-	ti_kcud1,         // TB_KEY_ARROW_DOWN
-	ti_kcub1,         // TB_KEY_ARROW_LEFT
-	ti_kcuf1,         // TB_KEY_ARROW_RIGHT
-};
+#undef FUNC
+#undef KEY
+#undef CAP
 
 // Loads terminal escape sequences from terminfo.
 static int init_term(void) {
@@ -71,29 +118,47 @@ static int init_term(void) {
 	ti = ti_load(NULL, &err);
 	if (!ti) return EUNSUPPORTED_TERM;
 
-	keys = malloc(sizeof(char*) * (TB_KEYS_NUM+1));
-	for (int i = 0; i < TB_KEYS_NUM; i++) {
-		keys[i] = ti_getstri(ti, ti_keys[i]);
-	}
-	keys[TB_KEYS_NUM] = 0;
-
-	funcs = malloc(sizeof(char*) * T_FUNCS_NUM);
-	// the last two entries are reserved for mouse extensions.
-	// because the table offset is not there, the entries have to fill in manually
-	for (int i = 0; i < T_FUNCS_NUM-2; i++) {
-		funcs[i] = ti_getstri(ti, ti_funcs[i]);
-	}
+	memset(&caps, 0, sizeof(caps));
+	ti_getcaps(ti, term_capdescs,
+	           sizeof(term_capdescs) / sizeof(term_capdescs[0]), &caps, NULL);
 
 	// TODO: load from extended format terminfo capabilities
-	funcs[T_FUNCS_NUM-2] = ENTER_MOUSE_SEQ;
-	funcs[T_FUNCS_NUM-1] = EXIT_MOUSE_SEQ;
+	caps.funcs[T_ENTER_MOUSE] = ENTER_MOUSE_SEQ;
+	caps.funcs[T_EXIT_MOUSE] = EXIT_MOUSE_SEQ;
+
+	ti_fastcaps_init(&fast, ti);
+	ti_fastparm_bind(&parms.csr, caps.csr);
+	ti_fastparm_bind(&parms.il, caps.il);
+	ti_fastparm_bind(&parms.dl, caps.dl);
 
+	keys = caps.keys;
+	funcs = caps.funcs;
 	return 0;
 }
 
+// Removes $<..> padding delays from the n bytes at s, termbox never pads.
+// Returns the new length.
+static int term_unpad(char *s, int n) {
+	int i, j = 0;
+	for (i = 0; i < n; i++) {
+		if (s[i] == '$' && i + 1 < n && s[i + 1] == '<') {
+			int k = i + 2;
+			while (k < n && (isdigit((unsigned char)s[k]) || s[k] == '.' ||
+			                 s[k] == '*' || s[k] == '/'))
+				k++;
+			if (k < n && s[k] == '>') {
+				i = k;
+				continue;
+			}
+		}
+		s[j++] = s[i];
+	}
+	return j;
+}
+
 static void shutdown_term(void) {
-	free(keys);  keys = NULL;
-	free(funcs); funcs = NULL;
+	keys = NULL;
+	funcs = NULL;
 	ti_free(ti); ti = NULL;
 }
 
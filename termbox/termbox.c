@@ -19,13 +19,27 @@
 #include "termbox.h"
 
 #include "bytebuffer.inl"
+#include "style.inl"
 #include "term.inl"
 #include "input.inl"
 
+/* Columns [x0, x1) of a row, empty when x0 >= x1. */
+struct span {
+	int x0;
+	int x1;
+};
+
+/* Cells [x0, x1) x [y0, y1). */
+struct rect {
+	int x0, y0;
+	int x1, y1;
+};
+
 struct cellbuf {
 	int width;
 	int height;
-	struct tb_cell *cells;
+	struct cell *cells;
+	struct span *dirty;     /* per row, columns written since the last present */
 };
 
 #define CELL(buf, x, y) (buf)->cells[(y) * (buf)->width + (x)]
@@ -48,24 +62,67 @@ static int outputmode = TB_OUTPUT_NORMAL;
 static int inout;
 static int winch_fds[2];
 
-static int lastx = LAST_COORD_INIT;
-static int lasty = LAST_COORD_INIT;
+/* where the terminal cursor is, LAST_COORD_INIT when it isn't known */
+static int termx = LAST_COORD_INIT;
+static int termy = LAST_COORD_INIT;
 static int cursor_x = -1;
 static int cursor_y = -1;
 
 static struct sgr default_sgr = { 0 };
+static struct sgr_pen pen;
+
+static struct stylepool styles;
+
+/* tb_cell copy of the back buffer handed out by tb_cell_buffer() */
+static struct tb_cell *cell_view;
+/* per row checksum of cell_view when it was last read back */
+static uint64_t *cell_view_sums;
+
+/* regions given to tb_damage() and not presented yet */
+#define DAMAGE_MAX 8
+static struct rect damage[DAMAGE_MAX];
+static int ndamage;
+
+/* scroll detection in tb_present() */
+#define SCROLL_MIN_ROWS 3       /* dirty rows before looking for moved rows */
+#define SCROLL_PASSES   4       /* blocks of rows moved per present at most */
+
+enum {
+	SCROLL_CSR,                 /* csr, then ind or ri */
+	SCROLL_CSR_LINES,           /* csr, then dl or il */
+	SCROLL_LINES,               /* dl and il without a scroll region */
+	SCROLL_METHODS,
+};
 
 static void write_cursor(int x, int y);
 
 static void cellbuf_init(struct cellbuf *buf, int width, int height);
 static void cellbuf_resize(struct cellbuf *buf, int width, int height);
 static void cellbuf_clear(struct cellbuf *buf);
+static void cellbuf_touch(struct cellbuf *buf);
+static void touch_span(int y, int x0, int x1);
 static void cellbuf_free(struct cellbuf *buf);
 
+static int intern_style(struct sgr sgr);
+static void put_cell(int x, int y, uint32_t ch, struct sgr sgr);
+static uint64_t row_sum(const struct tb_cell *row, int width);
+static void sync_cell_view(struct rect r);
+static void free_cell_view(void);
+
+static struct rect screen_rect(void);
+static struct rect rect_clip(struct rect a, struct rect b);
+static struct rect rect_union(struct rect a, struct rect b);
+static long rect_area(struct rect r);
+static void present_rect(struct rect r);
+static void present_span(int y, int x0, int x1);
+
+static void scroll_rows(void);
+
 static void update_size(void);
 static void update_term_size(void);
 static void send_attr(struct sgr sgr);
-static void send_char(int x, int y, uint32_t c);
+static void move_cursor(int x, int y);
+static void send_char(int x, int y, uint32_t c, int w);
 static void send_clear(void);
 static void sigwinch_handler(int xxx);
 static int wait_fill_event(struct tb_event *event, struct timeval *timeout);
@@ -115,6 +172,7 @@ int tb_init_fd(int inout_)
 
 	bytebuffer_init(&input_buffer, 128);
 	bytebuffer_init(&output_buffer, 32 * 1024);
+	sgr_pen_invalidate(&pen);
 
 	bytebuffer_puts(&output_buffer, funcs[T_ENTER_CA]);
 	bytebuffer_puts(&output_buffer, funcs[T_ENTER_KEYPAD]);
@@ -122,6 +180,7 @@ int tb_init_fd(int inout_)
 	send_clear();
 
 	update_term_size();
+	stylepool_init(&styles);
 	cellbuf_init(&back_buffer, termw, termh);
 	cellbuf_init(&front_buffer, termw, termh);
 	cellbuf_clear(&back_buffer);
@@ -160,8 +219,10 @@ void tb_shutdown(void)
 	close(winch_fds[0]);
 	close(winch_fds[1]);
 
+	free_cell_view();
 	cellbuf_free(&back_buffer);
 	cellbuf_free(&front_buffer);
+	stylepool_free(&styles);
 	bytebuffer_free(&output_buffer);
 	bytebuffer_free(&input_buffer);
 	termw = termh = -1;
@@ -169,51 +230,89 @@ void tb_shutdown(void)
 
 void tb_present(void)
 {
-	int x,y,w,i;
-	struct tb_cell *back, *front;
-
 	/* invalidate cursor position */
-	lastx = LAST_COORD_INIT;
-	lasty = LAST_COORD_INIT;
+	termx = LAST_COORD_INIT;
+	termy = LAST_COORD_INIT;
+
+	sync_cell_view(screen_rect());
 
 	if (buffer_size_change_request) {
 		update_size();
 		buffer_size_change_request = 0;
 	}
 
-	for (y = 0; y < front_buffer.height; ++y) {
-		for (x = 0; x < front_buffer.width; ) {
-			back = &CELL(&back_buffer, x, y);
-			front = &CELL(&front_buffer, x, y);
-			w = wcwidth(back->ch);
-			if (w < 1) w = 1;
-			if (memcmp(back, front, sizeof(struct tb_cell)) == 0) {
-				x += w;
-				continue;
-			}
-			memcpy(front, back, sizeof(struct tb_cell));
-			send_attr(back->sgr);
-			if (w > 1 && x >= front_buffer.width - (w - 1)) {
-				// Not enough room for wide ch, so send spaces
-				for (i = x; i < front_buffer.width; ++i) {
-					send_char(i, y, ' ');
-				}
-			} else {
-				send_char(x, y, back->ch);
-				for (i = 1; i < w; ++i) {
-					front = &CELL(&front_buffer, x + i, y);
-					front->ch = 0;
-					front->sgr = back->sgr;
-				}
-			}
-			x += w;
-		}
+	scroll_rows();
+	present_rect(screen_rect());
+	if (!IS_CURSOR_HIDDEN(cursor_x, cursor_y))
+		write_cursor(cursor_x, cursor_y);
+	bytebuffer_flush(&output_buffer, inout);
+}
+
+void tb_present_rect(int x, int y, int w, int h)
+{
+	struct rect r = { x, y, x + w, y + h };
+	if (w <= 0 || h <= 0)
+		return;
+
+	termx = LAST_COORD_INIT;
+	termy = LAST_COORD_INIT;
+
+	sync_cell_view(rect_clip(r, screen_rect()));
+
+	if (buffer_size_change_request) {
+		update_size();
+		buffer_size_change_request = 0;
 	}
+
+	present_rect(rect_clip(r, screen_rect()));
 	if (!IS_CURSOR_HIDDEN(cursor_x, cursor_y))
 		write_cursor(cursor_x, cursor_y);
 	bytebuffer_flush(&output_buffer, inout);
 }
 
+void tb_damage(int x, int y, int w, int h)
+{
+	struct rect r;
+	int i;
+	if (w <= 0 || h <= 0)
+		return;
+	r = rect_clip((struct rect){ x, y, x + w, y + h }, screen_rect());
+	if (r.x0 >= r.x1 || r.y0 >= r.y1)
+		return;
+
+	/* merge with every region it overlaps or touches */
+	for (i = 0; i < ndamage; ) {
+		struct rect d = damage[i];
+		if (r.x0 > d.x1 || d.x0 > r.x1 || r.y0 > d.y1 || d.y0 > r.y1) {
+			++i;
+			continue;
+		}
+		r = rect_union(r, d);
+		damage[i] = damage[--ndamage];
+		i = 0;
+	}
+
+	/* list full: merge into the region that grows the least, which may
+	 * now touch others */
+	if (ndamage == DAMAGE_MAX) {
+		long best = -1;
+		int b = 0;
+		for (i = 0; i < ndamage; ++i) {
+			long grow = rect_area(rect_union(r, damage[i])) -
+			            rect_area(damage[i]);
+			if (best < 0 || grow < best) {
+				best = grow;
+				b = i;
+			}
+		}
+		r = rect_union(r, damage[b]);
+		damage[b] = damage[--ndamage];
+		tb_damage(r.x0, r.y0, r.x1 - r.x0, r.y1 - r.y0);
+		return;
+	}
+	damage[ndamage++] = r;
+}
+
 void tb_set_cursor(int cx, int cy)
 {
 	if (IS_CURSOR_HIDDEN(cursor_x, cursor_y) && !IS_CURSOR_HIDDEN(cx, cy))
@@ -234,7 +333,7 @@ void tb_put_cell(int x, int y, const struct tb_cell *cell)
 		return;
 	if ((unsigned)y >= (unsigned)back_buffer.height)
 		return;
-	CELL(&back_buffer, x, y) = *cell;
+	put_cell(x, y, cell->ch, cell->sgr);
 }
 
 static void sgr_set_fg(struct sgr *sgr, uint16_t fg) {
@@ -301,8 +400,11 @@ void tb_change_cell(int x, int y, uint32_t ch, uint16_t fg, uint16_t bg)
 	sgr_set_fg(&sgr, fg);
 	sgr_set_bg(&sgr, bg);
 
-	struct tb_cell c = {ch, sgr};
-	tb_put_cell(x, y, &c);
+	if ((unsigned)x >= (unsigned)back_buffer.width)
+		return;
+	if ((unsigned)y >= (unsigned)back_buffer.height)
+		return;
+	put_cell(x, y, ch, sgr);
 }
 
 void tb_blit(int x, int y, int w, int h, const struct tb_cell *cells)
@@ -327,21 +429,37 @@ void tb_blit(int x, int y, int w, int h, const struct tb_cell *cells)
 	if (hh > back_buffer.height - y)
 		hh = back_buffer.height - y;
 
-	int sy;
-	struct tb_cell *dst = &CELL(&back_buffer, x, y);
+	int sx, sy;
 	const struct tb_cell *src = cells + yo * w + xo;
-	size_t size = sizeof(struct tb_cell) * ww;
 
 	for (sy = 0; sy < hh; ++sy) {
-		memcpy(dst, src, size);
-		dst += back_buffer.width;
+		for (sx = 0; sx < ww; ++sx) {
+			put_cell(x + sx, y + sy, src[sx].ch, src[sx].sgr);
+		}
 		src += w;
 	}
 }
 
 struct tb_cell *tb_cell_buffer(void)
 {
-	return back_buffer.cells;
+	if (cell_view)
+		return cell_view;
+
+	int i;
+	int ncells = back_buffer.width * back_buffer.height;
+	cell_view = malloc(sizeof(struct tb_cell) * (ncells ? ncells : 1));
+	cell_view_sums = malloc(sizeof(uint64_t) * (back_buffer.height ? back_buffer.height : 1));
+	assert(cell_view && cell_view_sums);
+	for (i = 0; i < ncells; ++i) {
+		struct cell c = back_buffer.cells[i];
+		cell_view[i].ch = cell_ch(c);
+		cell_view[i].sgr = stylepool_get(&styles, c.style);
+	}
+	for (i = 0; i < back_buffer.height; ++i) {
+		cell_view_sums[i] = row_sum(cell_view + i * back_buffer.width,
+		                            back_buffer.width);
+	}
+	return cell_view;
 }
 
 int tb_poll_event(struct tb_event *event)
@@ -369,6 +487,7 @@ int tb_height(void)
 
 void tb_clear(void)
 {
+	free_cell_view();
 	if (buffer_size_change_request) {
 		update_size();
 		buffer_size_change_request = 0;
@@ -439,12 +558,15 @@ static void write_cursor(int x, int y) {
 	WRITE_LITERAL(";");
 	WRITE_INT(x+1);
 	WRITE_LITERAL("H");
+	termx = x;
+	termy = y;
 }
 
 static void cellbuf_init(struct cellbuf *buf, int width, int height)
 {
-	buf->cells = (struct tb_cell*)malloc(sizeof(struct tb_cell) * width * height);
-	assert(buf->cells);
+	buf->cells = (struct cell*)malloc(sizeof(struct cell) * width * height);
+	buf->dirty = (struct span*)malloc(sizeof(struct span) * (height ? height : 1));
+	assert(buf->cells && buf->dirty);
 	buf->width = width;
 	buf->height = height;
 }
@@ -456,7 +578,8 @@ static void cellbuf_resize(struct cellbuf *buf, int width, int height)
 
 	int oldw = buf->width;
 	int oldh = buf->height;
-	struct tb_cell *oldcells = buf->cells;
+	struct cell *oldcells = buf->cells;
+	free(buf->dirty);
 
 	cellbuf_init(buf, width, height);
 	cellbuf_clear(buf);
@@ -466,9 +589,9 @@ static void cellbuf_resize(struct cellbuf *buf, int width, int height)
 	int i;
 
 	for (i = 0; i < minh; ++i) {
-		struct tb_cell *csrc = oldcells + (i * oldw);
-		struct tb_cell *cdst = buf->cells + (i * width);
-		memcpy(cdst, csrc, sizeof(struct tb_cell) * minw);
+		struct cell *csrc = oldcells + (i * oldw);
+		struct cell *cdst = buf->cells + (i * width);
+		memcpy(cdst, csrc, sizeof(struct cell) * minw);
 	}
 
 	free(oldcells);
@@ -478,16 +601,539 @@ static void cellbuf_clear(struct cellbuf *buf)
 {
 	int i;
 	int ncells = buf->width * buf->height;
+	struct cell blank = cell_make(' ', 1, intern_style(default_sgr));
 
 	for (i = 0; i < ncells; ++i) {
-		buf->cells[i].ch = ' ';
-		buf->cells[i].sgr = default_sgr;
+		buf->cells[i] = blank;
+	}
+	cellbuf_touch(buf);
+}
+
+/* Mark every cell for tb_present() to compare. */
+static void cellbuf_touch(struct cellbuf *buf)
+{
+	int i;
+	for (i = 0; i < buf->height; ++i) {
+		buf->dirty[i].x0 = 0;
+		buf->dirty[i].x1 = buf->width;
 	}
 }
 
+/* Mark columns [x0, x1) of a back buffer row for tb_present() to compare.
+ * The cell after them is included too, it shows the right half of a wide
+ * character that was written over. */
+static void touch_span(int y, int x0, int x1)
+{
+	struct span *s = &back_buffer.dirty[y];
+	if (x1 < back_buffer.width)
+		++x1;
+	if (s->x0 >= s->x1) {
+		s->x0 = x0;
+		s->x1 = x1;
+		return;
+	}
+	if (x0 < s->x0) s->x0 = x0;
+	if (x1 > s->x1) s->x1 = x1;
+}
+
 static void cellbuf_free(struct cellbuf *buf)
 {
 	free(buf->cells);
+	free(buf->dirty);
+}
+
+/* Re-intern the styles still used by the front and back buffers when every
+ * style id has been taken. */
+static void compact_styles(void)
+{
+	struct stylepool old = styles;
+	uint32_t *map = malloc(sizeof(uint32_t) * STYLE_MAX);
+	assert(map);
+	memset(map, 0xff, sizeof(uint32_t) * STYLE_MAX);
+
+	stylepool_init(&styles);
+	struct cellbuf *bufs[] = { &back_buffer, &front_buffer };
+	int b, i;
+	for (b = 0; b < 2; ++b) {
+		int ncells = bufs[b]->width * bufs[b]->height;
+		for (i = 0; i < ncells; ++i) {
+			struct cell *c = &bufs[b]->cells[i];
+			if (map[c->style] == UINT32_MAX) {
+				int id = stylepool_intern(&styles, old.styles[c->style]);
+				map[c->style] = id < 0 ? STYLE_DEFAULT : id;
+			}
+			c->style = map[c->style];
+		}
+	}
+
+	free(map);
+	stylepool_free(&old);
+}
+
+static int intern_style(struct sgr sgr)
+{
+	int id = stylepool_intern(&styles, sgr);
+	if (id < 0) {
+		compact_styles();
+		id = stylepool_intern(&styles, sgr);
+	}
+	/* more distinct styles on screen than ids: fall back to the default */
+	return id < 0 ? STYLE_DEFAULT : id;
+}
+
+static void put_cell(int x, int y, uint32_t ch, struct sgr sgr)
+{
+	int w = wcwidth(ch);
+	if (w < 1) w = 1;
+	CELL(&back_buffer, x, y) = cell_make(ch, w, intern_style(sgr));
+	touch_span(y, x, x + 1);
+
+	if (cell_view) {
+		struct tb_cell *c = &cell_view[y * back_buffer.width + x];
+		c->ch = ch;
+		c->sgr = sgr;
+	}
+}
+
+/* Checksum of a row of tb_cells, only the fields are hashed since the
+ * padding after ch is whatever the application left there. */
+static uint64_t row_sum(const struct tb_cell *row, int width)
+{
+	uint64_t h = 0;
+	int i;
+	for (i = 0; i < width; ++i) {
+		h = (h ^ row[i].ch) * 0x9e3779b97f4a7c15ull;
+		h = (h ^ style_key(row[i].sgr)) * 0x9e3779b97f4a7c15ull;
+	}
+	return h;
+}
+
+/* Take in changes made through the tb_cell_buffer() pointer in r. */
+static void sync_view_rect(struct rect r)
+{
+	int x, y;
+	for (y = r.y0; y < r.y1; ++y) {
+		const struct tb_cell *row = cell_view + y * back_buffer.width;
+		for (x = r.x0; x < r.x1; ++x) {
+			struct cell *c = &CELL(&back_buffer, x, y);
+			uint32_t ch = row[x].ch;
+			struct sgr sgr = row[x].sgr;
+			if (ch == cell_ch(*c) &&
+			    style_key(sgr) == style_key(stylepool_get(&styles, c->style)))
+				continue;
+
+			int w = wcwidth(ch);
+			if (w < 1) w = 1;
+			*c = cell_make(ch, w, intern_style(sgr));
+			touch_span(y, x, x + 1);
+		}
+	}
+}
+
+/* Take in changes made through the tb_cell_buffer() pointer for a present
+ * of r. When regions were given to tb_damage(), only those are looked at.
+ * Otherwise a whole screen present skips the rows that have the checksum
+ * they had at the last one, and a partial present compares every cell. */
+static void sync_cell_view(struct rect r)
+{
+	if (!cell_view)
+		return;
+
+	int i, y;
+	int width = back_buffer.width;
+	struct rect screen = screen_rect();
+	if (ndamage) {
+		for (i = 0; i < ndamage; ++i)
+			sync_view_rect(rect_clip(damage[i], r));
+		return;
+	}
+	if (memcmp(&r, &screen, sizeof(r)) != 0) {
+		sync_view_rect(r);
+		return;
+	}
+
+	for (y = 0; y < back_buffer.height; ++y) {
+		uint64_t sum = row_sum(cell_view + y * width, width);
+		if (sum == cell_view_sums[y])
+			continue;
+		sync_view_rect((struct rect){ 0, y, width, y + 1 });
+		cell_view_sums[y] = sum;
+	}
+}
+
+static void free_cell_view(void)
+{
+	free(cell_view);
+	free(cell_view_sums);
+	cell_view = NULL;
+	cell_view_sums = NULL;
+}
+
+static struct rect screen_rect(void)
+{
+	return (struct rect){ 0, 0, back_buffer.width, back_buffer.height };
+}
+
+static struct rect rect_clip(struct rect a, struct rect b)
+{
+	if (a.x0 < b.x0) a.x0 = b.x0;
+	if (a.y0 < b.y0) a.y0 = b.y0;
+	if (a.x1 > b.x1) a.x1 = b.x1;
+	if (a.y1 > b.y1) a.y1 = b.y1;
+	if (a.x1 < a.x0) a.x1 = a.x0;
+	if (a.y1 < a.y0) a.y1 = a.y0;
+	return a;
+}
+
+static struct rect rect_union(struct rect a, struct rect b)
+{
+	if (b.x0 < a.x0) a.x0 = b.x0;
+	if (b.y0 < a.y0) a.y0 = b.y0;
+	if (b.x1 > a.x1) a.x1 = b.x1;
+	if (b.y1 > a.y1) a.y1 = b.y1;
+	return a;
+}
+
+static long rect_area(struct rect r)
+{
+	return (long)(r.x1 - r.x0) * (r.y1 - r.y0);
+}
+
+/* Send the cells in r that differ from the front buffer. Only the dirty
+ * columns of each row and the regions given to tb_damage() are compared,
+ * what is left outside r stays dirty for the next present. */
+static void present_rect(struct rect r)
+{
+	int i, y;
+	for (i = 0; i < ndamage; ) {
+		struct rect d = rect_clip(damage[i], r);
+		for (y = d.y0; y < d.y1; ++y)
+			touch_span(y, d.x0, d.x1);
+		if (memcmp(&d, &damage[i], sizeof(d)) == 0)
+			damage[i] = damage[--ndamage];
+		else
+			++i;
+	}
+
+	for (y = r.y0; y < r.y1; ++y) {
+		struct span *s = &back_buffer.dirty[y];
+		int x0 = s->x0 > r.x0 ? s->x0 : r.x0;
+		int x1 = s->x1 < r.x1 ? s->x1 : r.x1;
+		if (x0 >= x1)
+			continue;
+		present_span(y, x0, x1);
+
+		if (x0 == s->x0 && x1 == s->x1)
+			s->x0 = s->x1 = 0;
+		else if (x0 == s->x0)
+			s->x0 = x1;
+		else if (x1 == s->x1)
+			s->x1 = x0;
+	}
+}
+
+/* Send the characters of row y that start in columns [x0, x1) and differ
+ * from the front buffer. */
+static void present_span(int y, int x0, int x1)
+{
+	int x, w, i, k;
+	struct cell *back, *front;
+
+	/* x0 may be the right half of a wide character. The first of a run of
+	 * wide cells always starts a character, so that's when an odd number of
+	 * them lead up to x0. */
+	for (k = 0; k < x0 && cell_width(CELL(&back_buffer, x0 - k - 1, y)) > 1; ++k)
+		;
+	if (k & 1)
+		--x0;
+
+	if (memcmp(&CELL(&back_buffer, x0, y), &CELL(&front_buffer, x0, y),
+	           sizeof(struct cell) * (x1 - x0)) == 0)
+		return;
+
+	for (x = x0; x < x1; ) {
+		back = &CELL(&back_buffer, x, y);
+		front = &CELL(&front_buffer, x, y);
+		w = cell_width(*back);
+		if (cell_eq(*back, *front)) {
+			x += w;
+			continue;
+		}
+		*front = *back;
+		send_attr(stylepool_get(&styles, back->style));
+		if (w > 1 && x >= front_buffer.width - (w - 1)) {
+			// Not enough room for wide ch, so send spaces
+			for (i = x; i < front_buffer.width; ++i) {
+				send_char(i, y, ' ', 1);
+			}
+		} else {
+			send_char(x, y, cell_ch(*back), w);
+			for (i = 1; i < w; ++i) {
+				front = &CELL(&front_buffer, x + i, y);
+				*front = cell_make(0, 1, back->style);
+			}
+		}
+		x += w;
+	}
+}
+
+static uint64_t cells_hash(const struct cell *c, int n)
+{
+	uint64_t h = 0, v;
+	int i;
+	for (i = 0; i < n; ++i) {
+		memcpy(&v, &c[i], sizeof(v));
+		h = (h ^ v) * 0x9e3779b97f4a7c15ull;
+	}
+	return h;
+}
+
+/* Number of cells of back buffer row y that differ from c. */
+static int cells_diff(int y, const struct cell *c)
+{
+	const struct cell *back = &CELL(&back_buffer, 0, y);
+	int i, n = 0;
+	for (i = 0; i < back_buffer.width; ++i)
+		n += !cell_eq(back[i], c[i]);
+	return n;
+}
+
+static void put_parm(const ti_fastparm *fp, int a, int b)
+{
+	int params[2] = { a, b };
+	char *p;
+	bytebuffer_reserve(&output_buffer, output_buffer.len + 4096);
+	p = output_buffer.buf + output_buffer.len;
+	output_buffer.len += term_unpad(p, ti_fastparm_fmt(fp, p, params, 2));
+}
+
+static void put_rep(const char *str, int n)
+{
+	int len = output_buffer.len, m, i;
+	if (n <= 0)
+		return;
+	bytebuffer_puts(&output_buffer, str);
+	m = term_unpad(output_buffer.buf + len, output_buffer.len - len);
+	bytebuffer_reserve(&output_buffer, len + m * n);
+	for (i = 1; i < n; ++i)
+		memcpy(output_buffer.buf + len + m * i, output_buffer.buf + len, m);
+	output_buffer.len = len + m * n;
+}
+
+/* Insert or delete n lines at the cursor with il or dl, or n il1 or dl1. */
+static int put_lines(int insert, int n)
+{
+	const char *many = insert ? caps.il : caps.dl;
+	const char *one = insert ? caps.il1 : caps.dl1;
+	if (many && (n > 1 || !one))
+		put_parm(insert ? &parms.il : &parms.dl, n, 0);
+	else if (one)
+		put_rep(one, n);
+	else
+		return 0;
+	return 1;
+}
+
+/* Append the sequence that moves the rows in [top, bot] up by s rows, or
+ * down when s is negative, with method. Returns 0 when the terminal can't do
+ * it that way, possibly after appending part of it. */
+static int put_scroll(int method, int top, int bot, int s)
+{
+	int h = back_buffer.height;
+	int n = s > 0 ? s : -s;
+
+	switch (method) {
+	case SCROLL_CSR:
+	case SCROLL_CSR_LINES:
+		if (!caps.csr)
+			return 0;
+		put_parm(&parms.csr, top, bot);
+		if (method == SCROLL_CSR) {
+			const char *str = s > 0 ? caps.ind : caps.ri;
+			if (!str)
+				return 0;
+			put_parm(&fast.cup, s > 0 ? bot : top, 0);
+			put_rep(str, n);
+		} else {
+			put_parm(&fast.cup, top, 0);
+			if (!put_lines(s < 0, n))
+				return 0;
+		}
+		put_parm(&parms.csr, 0, h - 1);
+		return 1;
+
+	case SCROLL_LINES:
+		/* make room with the opposite operation at the other end, so the
+		 * rows below bot end up where they were */
+		if (s > 0) {
+			put_parm(&fast.cup, top, 0);
+			if (!put_lines(0, n))
+				return 0;
+			if (bot < h - 1) {
+				put_parm(&fast.cup, bot - n + 1, 0);
+				return put_lines(1, n);
+			}
+		} else {
+			if (bot < h - 1) {
+				put_parm(&fast.cup, bot - n + 1, 0);
+				if (!put_lines(0, n))
+					return 0;
+			}
+			put_parm(&fast.cup, top, 0);
+			return put_lines(1, n);
+		}
+		return 1;
+	}
+	return 0;
+}
+
+/* Cheapest method to move rows [top, bot] by s, -1 when there's none. Sets
+ * *cost to the length of its sequence. */
+static int scroll_method(int top, int bot, int s, int *cost)
+{
+	int len = output_buffer.len;
+	int m, best = -1;
+	for (m = 0; m < SCROLL_METHODS; ++m) {
+		if (put_scroll(m, top, bot, s) &&
+		    (best < 0 || output_buffer.len - len < *cost)) {
+			best = m;
+			*cost = output_buffer.len - len;
+		}
+		output_buffer.len = len;
+	}
+	return best;
+}
+
+/* Whether blank lines the terminal scrolls in look like cleared cells. */
+static int can_scroll(void)
+{
+	if (!caps.cup)
+		return 0;
+	if (style_key(default_sgr) == 0)
+		return 1;
+	return caps.bce && !(default_sgr.at & SGR_ATTR_MASK);
+}
+
+/* Find blocks of rows that moved up or down on the screen, and scroll them
+ * into place on the terminal and in the front buffer before cells are
+ * compared. Rows are matched by hash: a changed back buffer row whose
+ * content is in exactly one front buffer row starts a block, and the block
+ * grows while the following rows match too. A block is moved when it saves
+ * more cells than its sequence has bytes, the biggest saving first. */
+static void scroll_rows(void)
+{
+	int w = back_buffer.width, h = back_buffer.height;
+	int y, i, n, pass, size;
+
+	for (y = 0, n = 0; y < h; ++y)
+		n += back_buffer.dirty[y].x0 < back_buffer.dirty[y].x1;
+	if (n < SCROLL_MIN_ROWS || !can_scroll())
+		return;
+
+	/* interning may compact styles, so do it before hashing */
+	struct cell blank = cell_make(' ', 1, intern_style(default_sgr));
+	struct cell *blank_row = malloc(sizeof(struct cell) * w);
+	for (size = 1; size < 2 * h; size <<= 1)
+		;
+	uint64_t *hb = malloc(sizeof(uint64_t) * (2 * h + size));
+	uint64_t *hf = hb + h, *keys = hf + h;
+	int *slots = malloc(sizeof(int) * size);
+	assert(blank_row && hb && slots);
+
+	for (i = 0; i < w; ++i)
+		blank_row[i] = blank;
+	uint64_t blank_hash = cells_hash(blank_row, w);
+	for (y = 0; y < h; ++y) {
+		hb[y] = cells_hash(&CELL(&back_buffer, 0, y), w);
+		hf[y] = cells_hash(&CELL(&front_buffer, 0, y), w);
+	}
+
+	for (pass = 0; pass < SCROLL_PASSES; ++pass) {
+		/* front rows by hash, slots hold row + 1, or -1 for a hash that
+		 * more than one row has */
+		memset(slots, 0, sizeof(int) * size);
+		for (y = 0; y < h; ++y) {
+			for (i = hf[y] & (size - 1); slots[i]; i = (i + 1) & (size - 1)) {
+				if (keys[i] == hf[y])
+					break;
+			}
+			keys[i] = hf[y];
+			slots[i] = slots[i] ? -1 : y + 1;
+		}
+
+		int best_gain = 0, best_top = 0, best_bot = 0, best_s = 0;
+		int best_method = -1;
+		for (y = 0; y < h; ) {
+			int j = -1;
+			if (hb[y] != hf[y]) {
+				for (i = hb[y] & (size - 1); slots[i]; i = (i + 1) & (size - 1)) {
+					if (keys[i] == hb[y]) {
+						j = slots[i] - 1;
+						break;
+					}
+				}
+			}
+			if (j < 0 || j == y) {
+				++y;
+				continue;
+			}
+
+			int s = j - y;
+			for (n = 1; y + n < h && j + n < h && hb[y + n] == hf[j + n]; ++n)
+				;
+			int top = s > 0 ? y : j;
+			int bot = (s > 0 ? j : y) + n - 1;
+
+			/* cells the block saves, less what the rows scrolled in
+			 * cost over redrawing them in place */
+			int gain = 0, e0 = s > 0 ? bot - s + 1 : top;
+			for (i = 0; i < n; ++i)
+				gain += cells_diff(y + i, &CELL(&front_buffer, 0, y + i));
+			for (i = e0; i < e0 + (s > 0 ? s : -s); ++i)
+				gain += cells_diff(i, &CELL(&front_buffer, 0, i)) -
+				        cells_diff(i, blank_row);
+
+			int cost = 0;
+			int method = gain > best_gain ? scroll_method(top, bot, s, &cost) : -1;
+			if (method >= 0 && gain - cost > best_gain) {
+				best_gain = gain - cost;
+				best_method = method;
+				best_top = top;
+				best_bot = bot;
+				best_s = s;
+			}
+			y += n;
+		}
+		if (best_method < 0)
+			break;
+
+		/* scrolled in lines take the current background */
+		send_attr(default_sgr);
+		put_scroll(best_method, best_top, best_bot, best_s);
+		termx = LAST_COORD_INIT;
+		termy = LAST_COORD_INIT;
+
+		int top = best_top, bot = best_bot;
+		int d = best_s > 0 ? best_s : -best_s;
+		int src = best_s > 0 ? top + d : top;
+		int dst = best_s > 0 ? top : top + d;
+		int e0 = best_s > 0 ? bot - d + 1 : top;
+		memmove(&CELL(&front_buffer, 0, dst), &CELL(&front_buffer, 0, src),
+		        sizeof(struct cell) * w * (bot - top + 1 - d));
+		memmove(&hf[dst], &hf[src], sizeof(uint64_t) * (bot - top + 1 - d));
+		for (y = e0; y < e0 + d; ++y) {
+			memcpy(&CELL(&front_buffer, 0, y), blank_row, sizeof(struct cell) * w);
+			hf[y] = blank_hash;
+		}
+		for (y = top; y <= bot; ++y) {
+			back_buffer.dirty[y].x0 = 0;
+			back_buffer.dirty[y].x1 = w;
+		}
+	}
+
+	free(slots);
+	free(hb);
+	free(blank_row);
 }
 
 static void get_term_size(int *w, int *h)
@@ -512,31 +1158,227 @@ static void update_term_size(void)
 	termh = sz.ws_row;
 }
 
+// Send only the codes that change the terminal from the last attributes sent.
 static void send_attr(struct sgr sgr)
 {
-	static struct sgr last = {0,0,0};
-	if (memcmp(&sgr, &last, sizeof(struct sgr)) == 0) {
-		return;
+	if (!pen.valid) {
+		bytebuffer_puts(&output_buffer, funcs[T_SGR0]);
+		sgr_pen_reset(&pen);
 	}
 
-	bytebuffer_append(&output_buffer, funcs[T_SGR0], strlen(funcs[T_SGR0]));
-
 	bytebuffer_reserve(&output_buffer, output_buffer.len + SGR_STR_MAX);
-	int sz = sgr_str(output_buffer.buf + output_buffer.len, sgr);
+	int sz = sgr_pen_str(&pen, output_buffer.buf + output_buffer.len, sgr);
 	output_buffer.len += sz;
+}
+
+/* Cursor motion
+ *
+ * The cursor is moved with the shortest sequence the terminal has: cup, or
+ * when the cursor position is known, a move to the row with vpa, cud1, cud,
+ * cuu1 or cuu followed by a move to the column with hpa, cuf1, cuf, cub1 or
+ * cub, possibly after cr or home. Moving right can also be done by writing
+ * the cells in between again when the terminal already shows them in the
+ * current attributes. */
+
+#define MOVE_REPEAT_MAX 16      /* cuf1 and the like sent at most this often */
+#define MOVE_COST_MAX   0x7fff  /* a move the terminal can't do */
+
+enum {
+	MOVE_NONE,
+	MOVE_PARM,                  /* fp with param */
+	MOVE_REP,                   /* str n times */
+	MOVE_CELLS,                 /* front buffer cells [param, n) of the row */
+};
+
+struct move {
+	int kind;
+	const ti_fastparm *fp;
+	const char *str;
+	int param;
+	int n;
+	int cost;
+};
 
-	last = sgr;
+static int digits(int n)
+{
+	int d = 1;
+	while (n >= 10) {
+		n /= 10;
+		++d;
+	}
+	return d;
+}
+
+static struct move move_parm(const char *ps, const ti_fastparm *fp, int param)
+{
+	struct move m = { MOVE_PARM, fp, NULL, param, 0, MOVE_COST_MAX };
+	if (ps) {
+		int len = output_buffer.len;
+		put_parm(fp, param, 0);
+		m.cost = output_buffer.len - len;
+		output_buffer.len = len;
+	}
+	return m;
+}
+
+static struct move move_rep(const char *str, int n)
+{
+	struct move m = { MOVE_REP, NULL, str, 0, n, MOVE_COST_MAX };
+	if (str && n <= MOVE_REPEAT_MAX) {
+		int len = output_buffer.len;
+		put_rep(str, 1);
+		m.cost = (output_buffer.len - len) * n;
+		output_buffer.len = len;
+	}
+	return m;
+}
+
+/* Writing cells [x0, x1) of row y again, when they're all narrow printable
+ * characters shown in the current attributes. */
+static struct move move_cells(int y, int x0, int x1)
+{
+	struct move m = { MOVE_CELLS, NULL, NULL, x0, x1, MOVE_COST_MAX };
+	uint64_t key = style_key(pen.sgr);
+	int x, cost = 0;
+	if (!pen.valid || x1 - x0 > MOVE_REPEAT_MAX)
+		return m;
+	for (x = x0; x < x1; ++x) {
+		struct cell c = CELL(&front_buffer, x, y);
+		uint32_t ch = cell_ch(c);
+		if (cell_width(c) != 1 || ch < ' ' || (ch >= 0x7f && ch < 0xa0) ||
+		    style_key(stylepool_get(&styles, c.style)) != key)
+			return m;
+		cost += ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+	}
+	m.cost = cost;
+	return m;
+}
+
+static struct move move_min(struct move a, struct move b)
+{
+	return b.cost < a.cost ? b : a;
 }
 
-static void send_char(int x, int y, uint32_t c)
+/* Cheapest move from column x0 to x1 on row y. */
+static struct move move_col(int y, int x0, int x1)
+{
+	struct move m = { MOVE_NONE, NULL, NULL, 0, 0, 0 };
+	if (x0 == x1)
+		return m;
+	m = move_parm(caps.hpa, &fast.hpa, x1);
+	if (x1 > x0) {
+		m = move_min(m, move_rep(caps.cuf1, x1 - x0));
+		m = move_min(m, move_parm(caps.cuf, &fast.cuf, x1 - x0));
+		m = move_min(m, move_cells(y, x0, x1));
+	} else {
+		m = move_min(m, move_rep(caps.cub1, x0 - x1));
+		m = move_min(m, move_parm(caps.cub, &fast.cub, x0 - x1));
+	}
+	return m;
+}
+
+/* Cheapest move from row y0 to y1 that keeps the column. */
+static struct move move_row(int y0, int y1)
+{
+	struct move m = { MOVE_NONE, NULL, NULL, 0, 0, 0 };
+	if (y0 == y1)
+		return m;
+	m = move_parm(caps.vpa, &fast.vpa, y1);
+	if (y1 > y0) {
+		m = move_min(m, move_rep(caps.cud1, y1 - y0));
+		m = move_min(m, move_parm(caps.cud, &fast.cud, y1 - y0));
+	} else {
+		m = move_min(m, move_rep(caps.cuu1, y0 - y1));
+		m = move_min(m, move_parm(caps.cuu, &fast.cuu, y0 - y1));
+	}
+	return m;
+}
+
+static void put_move(struct move m, int y)
 {
 	char buf[7];
-	int bw = tb_utf8_unicode_to_char(buf, c);
-	if (x-1 != lastx || y != lasty)
+	int x;
+	switch (m.kind) {
+	case MOVE_PARM:
+		put_parm(m.fp, m.param, 0);
+		break;
+	case MOVE_REP:
+		put_rep(m.str, m.n);
+		break;
+	case MOVE_CELLS:
+		for (x = m.param; x < m.n; ++x) {
+			uint32_t ch = cell_ch(CELL(&front_buffer, x, y));
+			bytebuffer_append(&output_buffer, buf, tb_utf8_unicode_to_char(buf, ch));
+		}
+		break;
+	}
+}
+
+static void move_cursor(int x, int y)
+{
+	if (x == termx && y == termy)
+		return;
+
+	/* a plan is a move to the start of the row, to the row, and to the
+	 * column, any of which may be MOVE_NONE */
+	struct move none = { MOVE_NONE, NULL, NULL, 0, 0, 0 };
+	struct move plan[3] = { none, none, none };
+	int cost = 4 + digits(y + 1) + digits(x + 1);
+	int absolute = 1;
+
+	if (termx != LAST_COORD_INIT && termy != LAST_COORD_INIT) {
+		struct move row = move_row(termy, y);
+		struct move col = move_col(y, termx, x);
+		struct move cr = move_rep(caps.cr, 1);
+		struct move col0 = move_col(y, 0, x);
+		if (row.cost + col.cost < cost) {
+			cost = row.cost + col.cost;
+			plan[1] = row;
+			plan[2] = col;
+			absolute = 0;
+		}
+		if (cr.cost + row.cost + col0.cost < cost) {
+			cost = cr.cost + row.cost + col0.cost;
+			plan[0] = cr;
+			plan[1] = row;
+			plan[2] = col0;
+			absolute = 0;
+		}
+	}
+	if (y == 0) {
+		struct move home = move_rep(caps.home, 1);
+		struct move col0 = move_col(y, 0, x);
+		if (home.cost + col0.cost < cost) {
+			plan[0] = home;
+			plan[1] = none;
+			plan[2] = col0;
+			absolute = 0;
+		}
+	}
+
+	if (absolute) {
 		write_cursor(x, y);
-	lastx = x; lasty = y;
+		return;
+	}
+	put_move(plan[0], y);
+	put_move(plan[1], y);
+	put_move(plan[2], y);
+	termx = x;
+	termy = y;
+}
+
+static void send_char(int x, int y, uint32_t c, int w)
+{
+	char buf[7];
+	int bw = tb_utf8_unicode_to_char(buf, c);
+	move_cursor(x, y);
 	if(!c) buf[0] = ' '; // replace 0 with whitespace
 	bytebuffer_append(&output_buffer, buf, bw);
+
+	/* past the last column the cursor waits to wrap, moves relative to it
+	 * aren't reliable */
+	termx = x + w < front_buffer.width ? x + w : LAST_COORD_INIT;
+	termy = termx == LAST_COORD_INIT ? LAST_COORD_INIT : y;
 }
 
 static void send_clear(void)
@@ -552,8 +1394,8 @@ static void send_clear(void)
 	 * actually may be in the correct place, but we simply discard
 	 * optimization once and it gives us simple solution for the case when
 	 * cursor moved */
-	lastx = LAST_COORD_INIT;
-	lasty = LAST_COORD_INIT;
+	termx = LAST_COORD_INIT;
+	termy = LAST_COORD_INIT;
 }
 
 static void sigwinch_handler(int xxx)
@@ -572,6 +1414,9 @@ static void update_size(void)
 	cellbuf_resize(&back_buffer, termw, termh);
 	cellbuf_resize(&front_buffer, termw, termh);
 	cellbuf_clear(&front_buffer);
+	cellbuf_touch(&back_buffer);
+	free_cell_view();
+	ndamage = 0;
 	send_clear();
 }
 
@@ -192,9 +192,28 @@ int tb_height(void);
 void tb_clear(void);
 void tb_set_clear_attributes(uint16_t fg, uint16_t bg);
 
-/* Synchronizes the internal back buffer with the terminal. */
+/* Synchronizes the internal back buffer with the terminal. Blocks of rows
+ * that moved up or down since the last present are scrolled on the terminal
+ * instead of being drawn again, when it can scroll.
+ */
 void tb_present(void);
 
+/* Like tb_present(), but only for the cells in the specified rectangle.
+ * Changes outside of it are kept for a later present.
+ */
+void tb_present_rect(int x, int y, int w, int h);
+
+/* Marks the cells in the specified rectangle as changed, so the next present
+ * compares them with the terminal. Cells changed with tb_put_cell(),
+ * tb_change_cell() and tb_blit() are tracked without it.
+ *
+ * Writes through the tb_cell_buffer() pointer are found by comparing the
+ * rows that changed since the last present. When any rectangle has been
+ * marked, only the marked cells are read back instead, so an application
+ * that updates a small part of the screen pays only for that part.
+ */
+void tb_damage(int x, int y, int w, int h);
+
 #define TB_HIDE_CURSOR -1
 
 /* Sets the position of the cursor. Upper-left character is (0, 0). If you pass
@@ -218,9 +237,19 @@ void tb_change_cell(int x, int y, uint32_t ch, uint16_t fg, uint16_t bg);
 void tb_blit(int x, int y, int w, int h, const struct tb_cell *cells);
 
 /* Returns a pointer to internal cell back buffer. You can get its dimensions
- * using tb_width() and tb_height() functions. The pointer stays valid as long
- * as no tb_clear() and tb_present() calls are made. The buffer is
- * one-dimensional buffer containing lines of cells starting from the top.
+ * using tb_width() and tb_height() functions. The buffer is one-dimensional
+ * buffer containing lines of cells starting from the top.
+ *
+ * Internally cells are kept in a compact form with interned styles, so this
+ * makes a tb_cell copy of the back buffer that tb_present() reads back. The
+ * copy stays valid across presents until tb_clear() is called or the buffers
+ * are resized. A resize happens inside tb_present() or tb_present_rect() when
+ * the terminal size changed, so call tb_cell_buffer() again after every
+ * present rather than keeping the pointer.
+ *
+ * See tb_damage() for limiting what is read back. While any rectangle is
+ * marked, writes outside the marked rectangles are not read back; they are
+ * picked up by a later present made with no damage pending.
  */
 struct tb_cell *tb_cell_buffer(void);
 
@@ -0,0 +1,211 @@
+#include "../sgr.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// Rendering state of a terminal that follows SGR sequences.
+struct term {
+	int attrs[10];          // on/off by SGR code 1-9
+	char fg[16];            // codes selecting the fg color, "" for default
+	char bg[16];            // codes selecting the bg color, "" for default
+};
+
+// Apply one SGR sequence to the terminal state.
+static void term_apply(struct term *t, const char *seq)
+{
+	if (*seq == '\0') return;
+	assert(strncmp(seq, SGR_OPEN, 2) == 0);
+	const char *p = seq + 2;
+
+	int codes[SGR_ELMS_MAX], n = 0;
+	for (;;) {
+		codes[n++] = strtol(p, (char**)&p, 10);
+		if (*p == 'm') break;
+		assert(*p == ';');
+		p++;
+	}
+	assert(p[1] == '\0');
+
+	// 99 and 109 are written for bright colors with the default color 9
+	for (int i = 0; i < n; i++) {
+		int c = codes[i];
+		char *color = NULL;
+		if (c == 0) {
+			memset(t, 0, sizeof(*t));
+		} else if (c >= 1 && c <= 9) {
+			t->attrs[c] = 1;
+		} else if (c == 22) {
+			t->attrs[1] = t->attrs[2] = 0;
+		} else if (c >= 23 && c <= 29) {
+			t->attrs[c - 20] = 0;
+		} else if (c == 39) {
+			t->fg[0] = '\0';
+		} else if (c == 49) {
+			t->bg[0] = '\0';
+		} else if ((c >= 30 && c <= 37) || (c >= 90 && c <= 99)) {
+			snprintf(t->fg, sizeof(t->fg), "%d", c);
+		} else if ((c >= 40 && c <= 47) || (c >= 100 && c <= 109)) {
+			snprintf(t->bg, sizeof(t->bg), "%d", c);
+		} else if (c == 38 || c == 48) {
+			color = c == 38 ? t->fg : t->bg;
+			if (codes[i + 1] == 5) {
+				snprintf(color, 16, "5;%d", codes[i + 2]);
+				i += 2;
+			} else {
+				assert(codes[i + 1] == 2);
+				snprintf(color, 16, "2;%d;%d;%d",
+				         codes[i + 2], codes[i + 3], codes[i + 4]);
+				i += 4;
+			}
+		} else {
+			printf("unexpected code %d in %s\n", c, seq + 1);
+			assert(0);
+		}
+	}
+}
+
+static int term_eq(const struct term *a, const struct term *b)
+{
+	return memcmp(a->attrs, b->attrs, sizeof(a->attrs)) == 0 &&
+	       strcmp(a->fg, b->fg) == 0 && strcmp(a->bg, b->bg) == 0;
+}
+
+// Terminal state after resetting and applying sgr.
+static struct term term_of(struct sgr sgr)
+{
+	struct term t = {0};
+	char buf[SGR_STR_MAX];
+	sgr.at = (sgr.at & ~SGR_NEGATE) | SGR_RESET;
+	sgr_str(buf, sgr);
+	term_apply(&t, buf);
+	return t;
+}
+
+static struct sgr random_sgr(void)
+{
+	static const int modes[] = {0, 1, 2, 3, 4, 5, 6};
+	static const uint32_t colors[] = {0, 1, 7, 9, 12, 23, 100, 255, 0x804020};
+	int fgm = modes[rand() % 7], bgm = modes[rand() % 7];
+	return (struct sgr){
+		.at = (rand() & SGR_ATTR_MASK) | (fgm << 8) | (bgm << 11),
+		.fg = colors[rand() % 9],
+		.bg = colors[rand() % 9],
+	};
+}
+
+// Applying the diff to the prev state always gives the next state, and the
+// diff is never longer than a full reset.
+static void test_sgr_diff_states(void)
+{
+	srand(1);
+	long diff_bytes = 0, reset_bytes = 0;
+	for (int i = 0; i < 200000; i++) {
+		struct sgr prev = random_sgr(), next = random_sgr();
+		if (i % 4 == 0) {
+			// mostly the same state with one thing changed
+			next = prev;
+			if (i % 8 == 0) next.fg = rand() % 8;
+			else next.at ^= 1 << (rand() % 8);
+		}
+
+		char diff[SGR_STR_MAX], full[SGR_STR_MAX];
+		int n = sgr_diff(diff, prev, next);
+		struct sgr reset = next;
+		reset.at |= SGR_RESET;
+		int fn = sgr_str(full, reset);
+		assert(n == (int)strlen(diff));
+		assert(n <= fn);
+
+		struct term t = term_of(prev), expect = term_of(next);
+		int same = term_eq(&t, &expect);
+		term_apply(&t, diff);
+		if (!term_eq(&t, &expect)) {
+			printf("prev at=0x%04x fg=%d bg=%d next at=0x%04x fg=%d "
+			       "bg=%d diff=%s\n", prev.at, prev.fg, prev.bg,
+			       next.at, next.fg, next.bg, diff + 1);
+		}
+		assert(term_eq(&t, &expect));
+
+		// nothing is written when the states render the same
+		assert(!same || n == 0);
+		diff_bytes += n;
+		reset_bytes += fn;
+	}
+	printf("diff bytes=%ld reset bytes=%ld\n", diff_bytes, reset_bytes);
+}
+
+static void test_sgr_diff_codes(void)
+{
+	struct {
+		struct sgr prev, next;
+		const char *expect;
+	} tests[] = {
+		{{SGR_BOLD|SGR_FG, SGR_RED}, {SGR_BOLD|SGR_FG, SGR_RED}, ""},
+		{{SGR_BOLD|SGR_FG, SGR_RED}, {SGR_BOLD|SGR_FG, SGR_GREEN}, "\033[32m"},
+		{{SGR_FG256, 202, 0}, {SGR_FG, SGR_RED}, "\033[31m"},
+		{{SGR_FG256, 202, 0}, {0}, "\033[0m"},
+		{{SGR_BOLD|SGR_FG256, 202, 0}, {SGR_BOLD}, "\033[39m"},
+		{{SGR_BOLD|SGR_BG16, 0, 3}, {SGR_BOLD}, "\033[49m"},
+		{{SGR_BOLD|SGR_FAINT|SGR_ITALIC|SGR_FG, 1}, {SGR_FAINT|SGR_ITALIC|SGR_FG, 1},
+		 "\033[22;2m"},
+		{{SGR_ITALIC|SGR_UNDERLINE|SGR_BG, 0, 4}, {SGR_UNDERLINE|SGR_REVERSE|SGR_BG, 0, 4},
+		 "\033[23;7m"},
+		{{SGR_FG24, 0}, {SGR_FG256, 232}, ""},
+		{{SGR_RESET|SGR_BLINK}, {SGR_NEGATE|SGR_BLINK}, ""},
+		{{SGR_BOLD|SGR_ITALIC|SGR_UNDERLINE|SGR_FG|SGR_BG, 1, 2}, {0}, "\033[0m"},
+		{{SGR_BOLD|SGR_ITALIC|SGR_STRIKE|SGR_FG16M, 0x102030}, {SGR_REVERSE},
+		 "\033[0;7m"},
+	};
+
+	for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+		char buf[SGR_STR_MAX];
+		int n = sgr_diff(buf, tests[i].prev, tests[i].next);
+		printf("n = %d, str = %s\n", n, buf[0] ? buf + 1 : "");
+		assert(strcmp(buf, tests[i].expect) == 0);
+		assert(n == (int)strlen(tests[i].expect));
+	}
+}
+
+static void test_sgr_pen(void)
+{
+	struct sgr_pen pen = {0};
+	char buf[SGR_STR_MAX];
+
+	// unknown state resets first
+	int n = sgr_pen_str(&pen, buf, (struct sgr){SGR_FG, SGR_RED});
+	assert(strcmp(buf, "\033[0;31m") == 0);
+	assert(n == 7);
+
+	// redundant sequences are skipped
+	n = sgr_pen_str(&pen, buf, (struct sgr){SGR_FG, SGR_RED});
+	assert(n == 0);
+
+	n = sgr_pen_str(&pen, buf, (struct sgr){SGR_BOLD|SGR_FG, SGR_RED});
+	assert(strcmp(buf, "\033[1m") == 0);
+
+	// after the caller reset the terminal
+	sgr_pen_reset(&pen);
+	n = sgr_pen_str(&pen, buf, (struct sgr){SGR_BOLD|SGR_FG, SGR_RED});
+	assert(strcmp(buf, "\033[1;31m") == 0);
+
+	sgr_pen_invalidate(&pen);
+	n = sgr_pen_str(&pen, buf, (struct sgr){SGR_BOLD|SGR_FG, SGR_RED});
+	assert(strcmp(buf, "\033[0;1;31m") == 0);
+	assert(n == 9);
+}
+
+int main(void)
+{
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	test_sgr_diff_codes();
+	test_sgr_diff_states();
+	test_sgr_pen();
+
+	return 0;
+}
+
+// vim: noexpandtab
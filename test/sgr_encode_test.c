@@ -59,6 +59,75 @@ static void test_sgr_encode(void)
 	assert(n == strlen(expect));
 }
 
+// Reference encoding built from sgr_unpack() codes one at a time.
+static int ref_str(char *dest, struct sgr sgr)
+{
+	uint16_t codes[SGR_ELMS_MAX];
+	int ncodes = sgr_unpack(codes, sgr);
+	int pos = 0;
+	dest[0] = '\0';
+	if (ncodes == 0) return 0;
+
+	pos += sprintf(dest + pos, "%s", SGR_OPEN);
+	for (int i = 0; i < ncodes; i++) {
+		if (i > 0) pos += sprintf(dest + pos, "%s", SGR_SEP);
+		pos += uitoa(codes[i], dest + pos);
+	}
+	pos += sprintf(dest + pos, "%s", SGR_CLOSE);
+	return pos;
+}
+
+static int ncalls;
+
+static void count_write(void *dest, char *src, int n)
+{
+	ncalls++;
+	testbuf_write(dest, src, n);
+}
+
+// The single pass formatter produces the same codes as sgr_unpack() for every
+// attribute, control flag, and color mode combination.
+static void test_sgr_fmt(void)
+{
+	static const uint32_t colors[] = {
+		0, 1, 7, 8, 9, 23, 24, 99, 100, 215, 216, 255, 256, 1000,
+		0x10000, 0x123456, 0xff00ff, 0xffffff,
+	};
+	int ncolors = sizeof(colors) / sizeof(colors[0]);
+	int checked = 0;
+
+	for (int ctrl = 0; ctrl < 4; ctrl++)
+	for (int attr = 0; attr < 256; attr++)
+	for (int fg = 0; fg < 8; fg++)
+	for (int bg = 0; bg < 8; bg++)
+	for (int c = 0; c < ncolors; c++) {
+		struct sgr sgr = {
+			.at = (ctrl << 14) | (bg << 11) | (fg << 8) | attr,
+			.fg = colors[c],
+			.bg = colors[(c * 7 + 3) % ncolors],
+		};
+		char expect[SGR_STR_MAX], got[SGR_STR_MAX];
+		int en = ref_str(expect, sgr);
+		int n = sgr_str(got, sgr);
+		if (n != en || strcmp(expect, got) != 0) {
+			printf("at=0x%04x fg=0x%06x bg=0x%06x expect=%s got=%s\n",
+			       sgr.at, sgr.fg, sgr.bg, expect + 1, got + 1);
+		}
+		assert(n == en);
+		assert(strcmp(expect, got) == 0);
+		checked++;
+	}
+	printf("checked %d sgr values\n", checked);
+
+	// sgr_encode() hands the whole sequence to the callback at once
+	struct testbuf buf = {0};
+	struct sgr sgr = {SGR_RESET|SGR_BOLD|SGR_FG16M|SGR_BG256, 0xff8000, 202};
+	int n = sgr_encode(&buf, count_write, sgr);
+	printf("n = %d, calls = %d, str = %s\n", n, ncalls, buf.str + 1);
+	assert(ncalls == 1);
+	assert(strcmp(buf.str, "\x1b[0;1;38;2;255;128;0;48;5;202m") == 0);
+}
+
 // Write SGR to string buffer.
 static void test_sgr_str(void)
 {
@@ -149,6 +218,7 @@ int main(void)
 
 	test_uitoa();
 	test_sgr_encode();
+	test_sgr_fmt();
 	test_sgr_str();
 	test_sgr_write();
 	test_sgr_fwrite();
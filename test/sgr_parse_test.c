@@ -0,0 +1,273 @@
+#include "../sgr.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define CELLS_MAX 4096
+
+static int paths[] = {
+	SGR_PATH_AUTO, SGR_PATH_SCALAR,
+#ifdef SGR_X86
+	SGR_PATH_SSE2, SGR_PATH_AVX2,
+#endif
+};
+#define NPATHS (int)(sizeof(paths) / sizeof(paths[0]))
+
+static int sgr_eq(struct sgr a, struct sgr b)
+{
+	return a.at == b.at && a.fg == b.fg && a.bg == b.bg;
+}
+
+// Parse all of str in one call.
+static size_t parse(struct sgr_cell *cells, const char *str, int path)
+{
+	struct sgr_parser p;
+	sgr_parser_init(&p);
+	size_t used;
+	size_t n = sgr_parse_path(&p, cells, CELLS_MAX, str, strlen(str), &used, path);
+	assert(used == strlen(str));
+	return n;
+}
+
+// Parse str in chunks of the given size with room for at most max cells per
+// call, like a reader filling and draining small buffers.
+static size_t parse_chunked(struct sgr_cell *cells, const char *str,
+                            size_t chunk, size_t max, int path)
+{
+	struct sgr_parser p;
+	sgr_parser_init(&p);
+	size_t len = strlen(str), pos = 0, n = 0;
+	while (pos < len) {
+		size_t sz = len - pos < chunk ? len - pos : chunk;
+		size_t off = 0;
+		while (off < sz) {
+			size_t used;
+			n += sgr_parse_path(&p, cells + n, max, str + pos + off,
+			                    sz - off, &used, path);
+			off += used;
+		}
+		pos += sz;
+	}
+	return n;
+}
+
+static void expect_text(struct sgr_cell *cells, size_t n, const char *text)
+{
+	assert(n == strlen(text));
+	for (size_t i = 0; i < n; i++) assert(cells[i].ch == (uint32_t)text[i]);
+}
+
+static void test_sgr_parse_codes(void)
+{
+	struct {
+		const char *in;
+		struct sgr sgr;
+	} tests[] = {
+		{"x",                              {0}},
+		{"\033[1mx",                       {SGR_BOLD}},
+		{"\033[1;3;4;5;7;9mx",             {SGR_BOLD|SGR_ITALIC|SGR_UNDERLINE|
+		                                    SGR_BLINK|SGR_REVERSE|SGR_STRIKE}},
+		{"\033[1;2;22mx",                  {0}},
+		{"\033[3;4;7;23;24;27mx",          {0}},
+		{"\033[4:3mx",                     {SGR_UNDERLINE}},
+		{"\033[4;4:0mx",                   {0}},
+		{"\033[31;42mx",                   {SGR_FG|SGR_BG, 1, 2}},
+		{"\033[91;107mx",                  {SGR_FG16|SGR_BG16, 1, 7}},
+		{"\033[31;39;42;49mx",             {0}},
+		{"\033[38;5;202mx",                {SGR_FG256, 202}},
+		{"\033[48;5;17mx",                 {SGR_BG256, 0, 17}},
+		{"\033[38;2;255;128;0mx",          {SGR_FG16M, 0xff8000}},
+		{"\033[48:2::1:2:3mx",             {SGR_BG16M, 0, 0x010203}},
+		{"\033[38:2:1:2:3;1mx",            {SGR_FG16M|SGR_BOLD, 0x010203}},
+		{"\033[38:5:99mx",                 {SGR_FG256, 99}},
+		{"\033[38;2;999;0;0mx",            {SGR_FG16M, 0xff0000}},
+		{"\033[1m\033[0mx",                {0}},
+		{"\033[1m\033[mx",                 {0}},
+		{"\033[1;;3mx",                    {SGR_ITALIC}},
+		// malformed colors end the sequence
+		{"\033[1;38;5mx",                  {SGR_BOLD}},
+		{"\033[38;7;1mx",                  {0}},
+		// other sequences are skipped
+		{"\033[1m\033[2J\033[?25l\033[>4;1mx", {SGR_BOLD}},
+		{"\033]0;title\007x",              {0}},
+		{"\033]8;;http://x.org\033\\x",    {0}},
+		{"\033(Bx",                        {0}},
+		{"\033[1\033[3mx",                 {SGR_ITALIC}},
+	};
+
+	for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+		struct sgr_cell cells[CELLS_MAX];
+		size_t n = parse(cells, tests[i].in, SGR_PATH_AUTO);
+		printf("in=%s n=%zu at=0x%04x fg=0x%x bg=0x%x\n", tests[i].in + 1,
+		       n, cells[0].sgr.at, cells[0].sgr.fg, cells[0].sgr.bg);
+		assert(n == 1);
+		assert(cells[0].ch == 'x');
+		assert(sgr_eq(cells[0].sgr, tests[i].sgr));
+	}
+}
+
+// Encoded attributes parse back to the same attributes.
+static void test_sgr_parse_roundtrip(void)
+{
+	static const int modes[] = {0, 1, 2, 5, 6};
+	srand(1);
+	for (int i = 0; i < 20000; i++) {
+		int fgm = modes[rand() % 5], bgm = modes[rand() % 5];
+		struct sgr sgr = {
+			.at = (rand() & (SGR_ATTR_MASK & ~SGR_CONCEAL)) | fgm << 8 | bgm << 11,
+			.fg = fgm == 6 ? rand() & 0xffffff : fgm == 5 ? rand() & 0xff : rand() & 7,
+			.bg = bgm == 6 ? rand() & 0xffffff : bgm == 5 ? rand() & 0xff : rand() & 7,
+		};
+		if (!fgm) sgr.fg = 0;
+		if (!bgm) sgr.bg = 0;
+
+		char buf[2 * SGR_STR_MAX];
+		struct sgr reset = sgr;
+		reset.at |= SGR_RESET;
+		int len = sgr_str(buf, reset);
+		strcpy(buf + len, "ab");
+
+		struct sgr_cell cells[CELLS_MAX];
+		size_t n = parse(cells, buf, SGR_PATH_AUTO);
+		assert(n == 2);
+		if (!sgr_eq(cells[1].sgr, sgr)) {
+			printf("in=%s at=0x%04x fg=0x%x bg=0x%x\n", buf + 1,
+			       cells[1].sgr.at, cells[1].sgr.fg, cells[1].sgr.bg);
+		}
+		assert(sgr_eq(cells[1].sgr, sgr));
+	}
+}
+
+static void test_sgr_parse_utf8(void)
+{
+	struct sgr_cell cells[CELLS_MAX];
+	// 2, 3, and 4 byte chars, a stray continuation byte, a truncated char,
+	// and bytes that never start a char
+	const char *in = "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\x80\xe2\x82x\xff\xc0";
+	uint32_t expect[] = {0xe9, 0x20ac, 0x1f600, SGR_REPLACEMENT,
+	                     SGR_REPLACEMENT, 'x', SGR_REPLACEMENT, SGR_REPLACEMENT};
+	size_t n = parse(cells, in, SGR_PATH_AUTO);
+	assert(n == sizeof(expect) / sizeof(expect[0]));
+	for (size_t i = 0; i < n; i++) {
+		printf("cell %zu: U+%04X\n", i, cells[i].ch);
+		assert(cells[i].ch == expect[i]);
+	}
+
+	// the lowest and highest codepoints of each range, and the overlongs,
+	// surrogates, and codepoints past U+10FFFF right next to them, where
+	// each byte not part of a valid char is one U+FFFD
+	struct {
+		const char *in;
+		uint32_t ch;
+		size_t n;
+	} tests[] = {
+		{"\xe0\xa0\x80",     0x800,           1},
+		{"\xed\x9f\xbf",     0xd7ff,          1},
+		{"\xee\x80\x80",     0xe000,          1},
+		{"\xf0\x90\x80\x80", 0x10000,         1},
+		{"\xf4\x8f\xbf\xbf", 0x10ffff,        1},
+		{"\xe0\x80\x80",     SGR_REPLACEMENT, 3},
+		{"\xe0\x9f\xbf",     SGR_REPLACEMENT, 3},
+		{"\xed\xa0\x80",     SGR_REPLACEMENT, 3},
+		{"\xed\xbf\xbf",     SGR_REPLACEMENT, 3},
+		{"\xf0\x80\x80\x80", SGR_REPLACEMENT, 4},
+		{"\xf0\x8f\xbf\xbf", SGR_REPLACEMENT, 4},
+		{"\xf4\x90\x80\x80", SGR_REPLACEMENT, 4},
+		{"\xf4\xbf\xbf\xbf", SGR_REPLACEMENT, 4},
+	};
+	for (size_t t = 0; t < sizeof(tests) / sizeof(tests[0]); t++) {
+		n = parse(cells, tests[t].in, SGR_PATH_AUTO);
+		printf("test %zu: %zu cells, U+%04X\n", t, n, cells[0].ch);
+		assert(n == tests[t].n);
+		for (size_t i = 0; i < n; i++)
+			assert(cells[i].ch == tests[t].ch);
+	}
+
+	// an escape sequence cuts a char short
+	n = parse(cells, "\xe2\x82\033[1mx", SGR_PATH_AUTO);
+	assert(n == 2);
+	assert(cells[0].ch == SGR_REPLACEMENT && cells[0].sgr.at == 0);
+	assert(cells[1].ch == 'x' && cells[1].sgr.at == SGR_BOLD);
+}
+
+// Parsing in pieces, with small output arrays, and on every code path gives
+// the same cells as parsing everything at once.
+static void test_sgr_parse_stream(void)
+{
+	static char log[8192];
+	size_t len = 0;
+	srand(2);
+	while (len < sizeof(log) - 64) {
+		switch (rand() % 8) {
+		case 0: len += sprintf(log + len, "\033[%d;1m", 30 + rand() % 8); break;
+		case 1: len += sprintf(log + len, "\033[38;2;%d;%d;%dm",
+		                       rand() % 256, rand() % 256, rand() % 256); break;
+		case 2: len += sprintf(log + len, "\033[0m"); break;
+		case 3: len += sprintf(log + len, "\033]0;t\007\xe2\x94\x80\n"); break;
+		case 4: len += sprintf(log + len, "\033[K\033[48:5:%dm\t", rand() % 256); break;
+		default:
+			len += sprintf(log + len, "plain text run %d with more words ", rand());
+			break;
+		}
+	}
+
+	static struct sgr_cell expect[CELLS_MAX * 2], got[CELLS_MAX * 2];
+	size_t n = parse_chunked(expect, log, len, CELLS_MAX * 2, SGR_PATH_SCALAR);
+
+	size_t chunks[] = {1, 2, 3, 7, 16, 31, 33, 100, 4096};
+	size_t maxes[] = {1, 5, 64, CELLS_MAX * 2};
+	for (int p = 0; p < NPATHS; p++)
+	for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+	for (size_t m = 0; m < sizeof(maxes) / sizeof(maxes[0]); m++) {
+		memset(got, 0, sizeof(got));
+		size_t gn = parse_chunked(got, log, chunks[c], maxes[m], paths[p]);
+		if (gn != n) printf("path=%d chunk=%zu max=%zu n=%zu expect=%zu\n",
+		                    paths[p], chunks[c], maxes[m], gn, n);
+		assert(gn == n);
+		for (size_t i = 0; i < n; i++) {
+			assert(got[i].ch == expect[i].ch);
+			assert(sgr_eq(got[i].sgr, expect[i].sgr));
+		}
+	}
+	printf("log bytes=%zu cells=%zu\n", len, n);
+}
+
+static void test_sgr_parse_plain(void)
+{
+	// runs of every length around the vector sizes
+	char buf[200];
+	for (int p = 0; p < NPATHS; p++) {
+		for (int len = 0; len < 100; len++) {
+			for (int i = 0; i < len; i++) buf[i] = 'a' + i % 26;
+			strcpy(buf + len, "\033[1mZ\x7f");
+			struct sgr_cell cells[CELLS_MAX];
+			size_t n = parse(cells, buf, paths[p]);
+			assert(n == (size_t)len + 2);
+			assert(cells[len].ch == 'Z' && cells[len].sgr.at == SGR_BOLD);
+			assert(cells[len + 1].ch == 0x7f);
+			if (len) assert(cells[len - 1].sgr.at == 0);
+		}
+	}
+
+	struct sgr_cell cells[CELLS_MAX];
+	size_t n = parse(cells, "a\tb\r\n", SGR_PATH_AUTO);
+	expect_text(cells, n, "a\tb\r\n");
+}
+
+int main(void)
+{
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	test_sgr_parse_codes();
+	test_sgr_parse_roundtrip();
+	test_sgr_parse_utf8();
+	test_sgr_parse_plain();
+	test_sgr_parse_stream();
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,162 @@
+#include "../sgr.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// RGB values of the 256-color palette entries from 16 up.
+static uint32_t palette_rgb(int i)
+{
+	if (i >= 232) {
+		int v = 8 + 10 * (i - 232);
+		return v << 16 | v << 8 | v;
+	}
+	i -= 16;
+	return sgr_cube_levels[i / 36] << 16 | sgr_cube_levels[i / 6 % 6] << 8 |
+	       sgr_cube_levels[i % 6];
+}
+
+// Nearest color by searching the whole palette.
+static int nearest(uint32_t rgb, int size)
+{
+	int r = rgb >> 16, g = (rgb >> 8) & 0xff, b = rgb & 0xff;
+	int best = -1;
+	long dist = 0;
+	for (int i = size == 256 ? 16 : 0; i < size; i++) {
+		uint32_t c = size == 256 ? palette_rgb(i) : sgr_ansi_rgb[i];
+		long d = sgr_rgb_dist(r, g, b, c >> 16, (c >> 8) & 0xff, c & 0xff);
+		if (best < 0 || d < dist) {
+			dist = d;
+			best = i;
+		}
+	}
+	return best;
+}
+
+// Center of the table cell a color falls in.
+static uint32_t cell_center(uint32_t rgb)
+{
+	return (rgb & 0xf8f8f8) | 0x040404;
+}
+
+static void test_sgr_quant_table(int colors, int size)
+{
+	struct sgr_quant *q = sgr_quant_new(colors);
+	assert(q != NULL);
+	assert(q->size == size);
+
+	// every entry holds the nearest color to its cell, and the cube search
+	// shortcut agrees with searching the whole palette
+	srand(colors);
+	for (int i = 0; i < 20000; i++) {
+		uint32_t rgb = rand() & 0xffffff;
+		int idx = sgr_quant_index(q, rgb);
+		int expect = nearest(cell_center(rgb), size);
+		if (idx != expect) {
+			printf("colors=%d rgb=%06x idx=%d expect=%d\n",
+			       colors, rgb, idx, expect);
+		}
+		assert(idx == expect);
+	}
+
+	if (size == 256) {
+		// cube colors map to themselves; grays can be closer to a cube
+		// color than to themselves at the cell center
+		for (int i = 16; i < 232; i++) {
+			int idx = sgr_quant_index(q, palette_rgb(i));
+			if (idx != i) printf("palette %d -> %d\n", i, idx);
+			assert(idx == i);
+		}
+	} else {
+		assert(sgr_quant_index(q, 0x000000) == 0);
+		assert(sgr_quant_index(q, 0xffffff) == (size == 16 ? 15 : 7));
+		assert(sgr_quant_index(q, 0xff0000) == (size == 16 ? 9 : 1));
+		assert(sgr_quant_index(q, 0x0000c0) == 4);
+	}
+
+	sgr_quant_free(q);
+}
+
+// Every row path gives the same indexes as single lookups.
+static void test_sgr_quant_row(void)
+{
+	struct sgr_quant *q = sgr_quant_new(256);
+	uint32_t rgb[67];
+	uint8_t expect[67], got[67 + 1];
+	srand(1);
+	for (int i = 0; i < 67; i++) {
+		rgb[i] = rand() & 0xffffff;
+		expect[i] = sgr_quant_index(q, rgb[i]);
+	}
+	// colors above 24 bits are ignored
+	rgb[5] |= 0xff000000;
+
+	int paths[] = {SGR_PATH_AUTO, SGR_PATH_SCALAR,
+#ifdef SGR_X86
+		SGR_PATH_AVX2,
+#endif
+	};
+	for (size_t p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+		for (size_t n = 0; n <= 67; n++) {
+			memset(got, 0xee, sizeof(got));
+			sgr_quant_row_path(q, got, rgb, n, paths[p]);
+			assert(memcmp(got, expect, n) == 0);
+			assert(got[n] == 0xee);
+		}
+	}
+	sgr_quant_free(q);
+}
+
+static void test_sgr_quant_sgr(void)
+{
+	struct sgr_quant *q256 = sgr_quant_new(256);
+	struct sgr_quant *q16 = sgr_quant_new(16);
+	struct sgr_quant *q8 = sgr_quant_new(8);
+	struct sgr_quant *qd = sgr_quant_new(SGR_QUANT_DIRECT);
+
+	struct sgr in = {SGR_BOLD|SGR_FG16M|SGR_BG16M, 0xff0000, 0x000000};
+	struct sgr out = sgr_quant_sgr(q256, in);
+	assert(out.at == (SGR_BOLD|SGR_FG256|SGR_BG256));
+	assert(out.fg == 196 && out.bg == 16);
+
+	out = sgr_quant_sgr(q16, in);
+	assert(out.at == (SGR_BOLD|SGR_FG16|SGR_BG));
+	assert(out.fg == 1 && out.bg == 0);
+
+	out = sgr_quant_sgr(q8, in);
+	assert(out.at == (SGR_BOLD|SGR_FG|SGR_BG));
+	assert(out.fg == 1 && out.bg == 0);
+
+	out = sgr_quant_sgr(qd, in);
+	assert(memcmp(&out, &in, sizeof(in)) == 0);
+
+	// palette colors are left alone
+	in = (struct sgr){SGR_FG256|SGR_BG16M, 202, 0xffffff};
+	out = sgr_quant_sgr(q8, in);
+	assert(out.at == (SGR_FG256|SGR_BG));
+	assert(out.fg == 202 && out.bg == 7);
+
+	sgr_quant_free(q256);
+	sgr_quant_free(q16);
+	sgr_quant_free(q8);
+	sgr_quant_free(qd);
+}
+
+int main(void)
+{
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	test_sgr_quant_table(256, 256);
+	test_sgr_quant_table(SGR_QUANT_DIRECT, 256);
+	test_sgr_quant_table(88, 16);
+	test_sgr_quant_table(16, 16);
+	test_sgr_quant_table(8, 8);
+	test_sgr_quant_row();
+	test_sgr_quant_sgr();
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,2807 @@
+/*
+ * Builtin terminfo entries generated by tools/gencap-builtin:
+ * xterm-color xterm-new xterm-kitty minitel1
+ *
+ */
+
+#define TI_BI_STR(idx, off) ((char *)ti_bi##idx##_data + off)
+
+// xterm-color|generic "ANSI" color xterm (X Window System)
+static const char ti_bi0_data[] = {
+	0x1a, 0x01, 0x39, 0x00, 0x26, 0x00, 0x10, 0x00, 0x9d, 0x01, 0x5b, 0x02,
+	0x78, 0x74, 0x65, 0x72, 0x6d, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x7c,
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x22, 0x41, 0x4e, 0x53,
+	0x49, 0x22, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x78, 0x74, 0x65,
+	0x72, 0x6d, 0x20, 0x28, 0x58, 0x20, 0x57, 0x69, 0x6e, 0x64, 0x6f, 0x77,
+	0x20, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x29, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x50, 0x00, 0x08, 0x00, 0x18, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x08, 0x00, 0x40, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x02, 0x00, 0x04, 0x00, 0x15, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x26, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0xff, 0xff,
+	0x41, 0x00, 0xff, 0xff, 0xff, 0xff, 0x43, 0x00, 0xff, 0xff, 0x47, 0x00,
+	0xff, 0xff, 0x4b, 0x00, 0x4f, 0x00, 0xff, 0xff, 0xff, 0xff, 0x53, 0x00,
+	0xff, 0xff, 0x55, 0x00, 0x5a, 0x00, 0xff, 0xff, 0xff, 0xff, 0x63, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x68, 0x00, 0x6d, 0x00, 0x72, 0x00, 0xff, 0xff,
+	0x77, 0x00, 0x79, 0x00, 0x7d, 0x00, 0xff, 0xff, 0x8a, 0x00, 0x8f, 0x00,
+	0x93, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x00, 0xff, 0xff, 0xbc, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0xff, 0xff, 0xc3, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x00, 0xcd, 0x00,
+	0xd3, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0xe5, 0x00, 0xeb, 0x00, 0xf1, 0x00,
+	0xf7, 0x00, 0xfd, 0x00, 0xff, 0xff, 0x03, 0x01, 0xff, 0xff, 0x08, 0x01,
+	0xff, 0xff, 0x0c, 0x01, 0x11, 0x01, 0x16, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x1a, 0x01, 0x1e, 0x01, 0x26, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x2e, 0x01, 0x37, 0x01, 0x40, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0x49, 0x01, 0x52, 0x01, 0x5b, 0x01, 0xff, 0xff, 0x64, 0x01, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x6d, 0x01, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x01, 0xff, 0xff,
+	0x91, 0x01, 0x94, 0x01, 0x96, 0x01, 0xff, 0xff, 0x99, 0x01, 0xff, 0xff,
+	0x9c, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x9e, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x01,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x01, 0xe7, 0x01,
+	0xed, 0x01, 0xf3, 0x01, 0xf9, 0x01, 0xff, 0x01, 0x05, 0x02, 0x0b, 0x02,
+	0x11, 0x02, 0x17, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x02, 0x28, 0x02, 0x2d, 0x02,
+	0x35, 0x02, 0x39, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x02,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x02, 0x4b, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x55, 0x02, 0x58, 0x02, 0x07, 0x00, 0x0d, 0x00, 0x1b, 0x5b,
+	0x25, 0x69, 0x25, 0x70, 0x31, 0x25, 0x64, 0x3b, 0x25, 0x70, 0x32, 0x25,
+	0x64, 0x72, 0x00, 0x1b, 0x5b, 0x33, 0x67, 0x00, 0x1b, 0x5b, 0x48, 0x1b,
+	0x5b, 0x32, 0x4a, 0x00, 0x1b, 0x5b, 0x4b, 0x00, 0x1b, 0x5b, 0x4a, 0x00,
+	0x1b, 0x5b, 0x25, 0x69, 0x25, 0x70, 0x31, 0x25, 0x64, 0x3b, 0x25, 0x70,
+	0x32, 0x25, 0x64, 0x48, 0x00, 0x0a, 0x00, 0x1b, 0x5b, 0x48, 0x00, 0x08,
+	0x00, 0x1b, 0x5b, 0x43, 0x00, 0x1b, 0x5b, 0x41, 0x00, 0x1b, 0x5b, 0x50,
+	0x00, 0x1b, 0x5b, 0x4d, 0x00, 0x0e, 0x00, 0x1b, 0x5b, 0x31, 0x6d, 0x00,
+	0x1b, 0x37, 0x1b, 0x5b, 0x3f, 0x34, 0x37, 0x68, 0x00, 0x1b, 0x5b, 0x34,
+	0x68, 0x00, 0x1b, 0x5b, 0x37, 0x6d, 0x00, 0x1b, 0x5b, 0x37, 0x6d, 0x00,
+	0x1b, 0x5b, 0x34, 0x6d, 0x00, 0x0f, 0x00, 0x1b, 0x5b, 0x6d, 0x00, 0x1b,
+	0x5b, 0x32, 0x4a, 0x1b, 0x5b, 0x3f, 0x34, 0x37, 0x6c, 0x1b, 0x38, 0x00,
+	0x1b, 0x5b, 0x34, 0x6c, 0x00, 0x1b, 0x5b, 0x6d, 0x00, 0x1b, 0x5b, 0x6d,
+	0x00, 0x1b, 0x5b, 0x6d, 0x1b, 0x5b, 0x3f, 0x37, 0x68, 0x1b, 0x5b, 0x34,
+	0x6c, 0x1b, 0x3e, 0x1b, 0x37, 0x1b, 0x5b, 0x72, 0x1b, 0x5b, 0x3f, 0x31,
+	0x3b, 0x33, 0x3b, 0x34, 0x3b, 0x36, 0x6c, 0x1b, 0x38, 0x00, 0x1b, 0x5b,
+	0x4c, 0x00, 0x7f, 0x00, 0x1b, 0x5b, 0x33, 0x7e, 0x00, 0x1b, 0x4f, 0x42,
+	0x00, 0x1b, 0x5b, 0x31, 0x31, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x31, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x39, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x7e, 0x00, 0x1b, 0x4f, 0x44, 0x00, 0x1b, 0x5b,
+	0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x7e, 0x00, 0x1b, 0x4f, 0x43, 0x00,
+	0x1b, 0x4f, 0x41, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x6c, 0x1b, 0x3e, 0x00,
+	0x1b, 0x5b, 0x3f, 0x31, 0x68, 0x1b, 0x3d, 0x00, 0x1b, 0x5b, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x50, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x4d, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x42, 0x00, 0x1b,
+	0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x4c, 0x00, 0x1b, 0x5b, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x44, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x43, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x41, 0x00, 0x1b,
+	0x5b, 0x6d, 0x1b, 0x5b, 0x3f, 0x37, 0x68, 0x1b, 0x5b, 0x34, 0x6c, 0x1b,
+	0x3e, 0x1b, 0x37, 0x1b, 0x5b, 0x72, 0x1b, 0x5b, 0x3f, 0x31, 0x3b, 0x33,
+	0x3b, 0x34, 0x3b, 0x36, 0x6c, 0x1b, 0x38, 0x00, 0x1b, 0x38, 0x00, 0x1b,
+	0x37, 0x00, 0x0a, 0x00, 0x1b, 0x4d, 0x00, 0x1b, 0x48, 0x00, 0x09, 0x00,
+	0x60, 0x60, 0x61, 0x61, 0x66, 0x66, 0x67, 0x67, 0x69, 0x69, 0x6a, 0x6a,
+	0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6e, 0x6e, 0x6f, 0x6f, 0x70, 0x70,
+	0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
+	0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
+	0x7d, 0x7d, 0x7e, 0x7e, 0x00, 0x1b, 0x29, 0x30, 0x00, 0x1b, 0x5b, 0x31,
+	0x7e, 0x00, 0x1b, 0x5b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x35, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x38, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x39, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x31, 0x7e,
+	0x00, 0x1b, 0x5b, 0x33, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x33, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x25, 0x69, 0x25,
+	0x64, 0x3b, 0x25, 0x64, 0x52, 0x00, 0x1b, 0x5b, 0x36, 0x6e, 0x00, 0x1b,
+	0x5b, 0x3f, 0x31, 0x3b, 0x32, 0x63, 0x00, 0x1b, 0x5b, 0x63, 0x00, 0x1b,
+	0x5b, 0x6d, 0x00, 0x1b, 0x5b, 0x4d, 0x00, 0x1b, 0x5b, 0x33, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x6d, 0x00, 0x1b, 0x5b, 0x34, 0x25, 0x70, 0x31, 0x25,
+	0x64, 0x6d, 0x00, 0x1b, 0x6c, 0x00, 0x1b, 0x6d, 0x00,
+};
+static const int32_t ti_bi0_nums[] = {
+	80, 8, 24, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8, 64, -2,
+};
+static char * const ti_bi0_strs[] = {
+	NULL,
+	TI_BI_STR(0, 966),
+	TI_BI_STR(0, 968),
+	TI_BI_STR(0, 970),
+	TI_BI_STR(0, 987),
+	TI_BI_STR(0, 992),
+	TI_BI_STR(0, 1000),
+	TI_BI_STR(0, 1004),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1008),
+	TI_BI_STR(0, 1025),
+	TI_BI_STR(0, 1027),
+	NULL,
+	TI_BI_STR(0, 1031),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1033),
+	NULL,
+	TI_BI_STR(0, 1037),
+	NULL,
+	TI_BI_STR(0, 1041),
+	TI_BI_STR(0, 1045),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1049),
+	NULL,
+	TI_BI_STR(0, 1051),
+	TI_BI_STR(0, 1056),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1065),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1070),
+	TI_BI_STR(0, 1075),
+	TI_BI_STR(0, 1080),
+	NULL,
+	TI_BI_STR(0, 1085),
+	TI_BI_STR(0, 1087),
+	TI_BI_STR(0, 1091),
+	NULL,
+	TI_BI_STR(0, 1104),
+	TI_BI_STR(0, 1109),
+	TI_BI_STR(0, 1113),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1117),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1150),
+	NULL,
+	TI_BI_STR(0, 1154),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1156),
+	NULL,
+	TI_BI_STR(0, 1161),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1165),
+	TI_BI_STR(0, 1171),
+	TI_BI_STR(0, 1177),
+	TI_BI_STR(0, 1183),
+	TI_BI_STR(0, 1189),
+	TI_BI_STR(0, 1195),
+	TI_BI_STR(0, 1201),
+	TI_BI_STR(0, 1207),
+	TI_BI_STR(0, 1213),
+	TI_BI_STR(0, 1219),
+	NULL,
+	TI_BI_STR(0, 1225),
+	NULL,
+	TI_BI_STR(0, 1230),
+	NULL,
+	TI_BI_STR(0, 1234),
+	TI_BI_STR(0, 1239),
+	TI_BI_STR(0, 1244),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1248),
+	TI_BI_STR(0, 1252),
+	TI_BI_STR(0, 1260),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1268),
+	TI_BI_STR(0, 1277),
+	TI_BI_STR(0, 1286),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1295),
+	TI_BI_STR(0, 1304),
+	TI_BI_STR(0, 1313),
+	NULL,
+	TI_BI_STR(0, 1322),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1331),
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1364),
+	NULL,
+	TI_BI_STR(0, 1367),
+	TI_BI_STR(0, 1370),
+	TI_BI_STR(0, 1372),
+	NULL,
+	TI_BI_STR(0, 1375),
+	NULL,
+	TI_BI_STR(0, 1378),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1380),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1433),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1437),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1442),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1447),
+	TI_BI_STR(0, 1453),
+	TI_BI_STR(0, 1459),
+	TI_BI_STR(0, 1465),
+	TI_BI_STR(0, 1471),
+	TI_BI_STR(0, 1477),
+	TI_BI_STR(0, 1483),
+	TI_BI_STR(0, 1489),
+	TI_BI_STR(0, 1495),
+	TI_BI_STR(0, 1501),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1507),
+	TI_BI_STR(0, 1518),
+	TI_BI_STR(0, 1523),
+	TI_BI_STR(0, 1531),
+	TI_BI_STR(0, 1535),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1539),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1543),
+	TI_BI_STR(0, 1553),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(0, 1563),
+	TI_BI_STR(0, 1566),
+};
+static const ti_terminfo ti_bi0 = {
+	.term_names      = TI_BI_STR(0, 12),
+	.bools           = (int8_t *)TI_BI_STR(0, 69),
+	.nums            = (int32_t *)ti_bi0_nums,
+	.strs            = (char **)ti_bi0_strs,
+	.bools_count     = 38,
+	.nums_count      = 16,
+	.strs_count      = 413,
+	.data            = (char *)ti_bi0_data,
+	.len             = 1569,
+	.numsz           = 2,
+	.flags           = TI_F_STATIC,
+};
+
+// xterm-new|modern xterm terminal emulator
+static const char ti_bi1_data[] = {
+	0x1a, 0x01, 0x29, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x9d, 0x01, 0xa4, 0x05,
+	0x78, 0x74, 0x65, 0x72, 0x6d, 0x2d, 0x6e, 0x65, 0x77, 0x7c, 0x6d, 0x6f,
+	0x64, 0x65, 0x72, 0x6e, 0x20, 0x78, 0x74, 0x65, 0x72, 0x6d, 0x20, 0x74,
+	0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x65, 0x6d, 0x75, 0x6c,
+	0x61, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x08, 0x00,
+	0x18, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x19, 0x00,
+	0x1e, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x2e, 0x00, 0xff, 0xff, 0x39, 0x00,
+	0x4a, 0x00, 0x4c, 0x00, 0x50, 0x00, 0x57, 0x00, 0xff, 0xff, 0x59, 0x00,
+	0x66, 0x00, 0xff, 0xff, 0x6a, 0x00, 0x6e, 0x00, 0x78, 0x00, 0x7c, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x84, 0x00, 0x89, 0x00, 0x8e, 0x00,
+	0xff, 0xff, 0xa0, 0x00, 0xa5, 0x00, 0xaa, 0x00, 0xff, 0xff, 0xaf, 0x00,
+	0xb4, 0x00, 0xb9, 0x00, 0xbe, 0x00, 0xc7, 0x00, 0xcb, 0x00, 0xd2, 0x00,
+	0xff, 0xff, 0xe4, 0x00, 0xe9, 0x00, 0xef, 0x00, 0xf5, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x07, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x19, 0x01, 0xff, 0xff, 0x1d, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x1f, 0x01, 0xff, 0xff, 0x24, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x28, 0x01, 0x2c, 0x01, 0x32, 0x01, 0x36, 0x01, 0x3a, 0x01,
+	0x3e, 0x01, 0x44, 0x01, 0x4a, 0x01, 0x50, 0x01, 0x56, 0x01, 0x5c, 0x01,
+	0x60, 0x01, 0xff, 0xff, 0x65, 0x01, 0xff, 0xff, 0x69, 0x01, 0x6e, 0x01,
+	0x73, 0x01, 0x77, 0x01, 0x7e, 0x01, 0xff, 0xff, 0x85, 0x01, 0x89, 0x01,
+	0x91, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x99, 0x01, 0xa2, 0x01, 0xff, 0xff, 0xff, 0xff, 0xab, 0x01, 0xb4, 0x01,
+	0xbd, 0x01, 0xc6, 0x01, 0xcf, 0x01, 0xd8, 0x01, 0xe1, 0x01, 0xea, 0x01,
+	0xf3, 0x01, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x02,
+	0x09, 0x02, 0x0e, 0x02, 0xff, 0xff, 0x13, 0x02, 0x16, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0x28, 0x02, 0x2b, 0x02, 0x36, 0x02, 0x39, 0x02, 0x3b, 0x02,
+	0x3e, 0x02, 0x9b, 0x02, 0xff, 0xff, 0x9e, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x02, 0xff, 0xff, 0xd9, 0x02,
+	0xff, 0xff, 0xff, 0xff, 0xdd, 0x02, 0xe3, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x02, 0xed, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xf1, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x06, 0x03, 0x0d, 0x03, 0xff, 0xff,
+	0xff, 0xff, 0x14, 0x03, 0xff, 0xff, 0x1b, 0x03, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x22, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x29, 0x03, 0x2f, 0x03, 0x35, 0x03, 0x3c, 0x03, 0x43, 0x03,
+	0x4a, 0x03, 0x51, 0x03, 0x59, 0x03, 0x61, 0x03, 0x69, 0x03, 0x71, 0x03,
+	0x79, 0x03, 0x81, 0x03, 0x89, 0x03, 0x91, 0x03, 0x98, 0x03, 0x9f, 0x03,
+	0xa6, 0x03, 0xad, 0x03, 0xb5, 0x03, 0xbd, 0x03, 0xc5, 0x03, 0xcd, 0x03,
+	0xd5, 0x03, 0xdd, 0x03, 0xe5, 0x03, 0xed, 0x03, 0xf4, 0x03, 0xfb, 0x03,
+	0x02, 0x04, 0x09, 0x04, 0x11, 0x04, 0x19, 0x04, 0x21, 0x04, 0x29, 0x04,
+	0x31, 0x04, 0x39, 0x04, 0x41, 0x04, 0x49, 0x04, 0x50, 0x04, 0x57, 0x04,
+	0x5e, 0x04, 0x65, 0x04, 0x6d, 0x04, 0x75, 0x04, 0x7d, 0x04, 0x85, 0x04,
+	0x8d, 0x04, 0x95, 0x04, 0x9d, 0x04, 0xa5, 0x04, 0xac, 0x04, 0xb3, 0x04,
+	0xba, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xbf, 0x04, 0xca, 0x04, 0xcf, 0x04, 0xe2, 0x04, 0xe6, 0x04, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x04, 0x35, 0x05, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x7b, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x05, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x86, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x8a, 0x05, 0x94, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x05, 0xa1, 0x05,
+	0x1b, 0x5b, 0x5a, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x1b, 0x5b, 0x25, 0x69,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x3b, 0x25, 0x70, 0x32, 0x25, 0x64, 0x72,
+	0x00, 0x1b, 0x5b, 0x33, 0x67, 0x00, 0x1b, 0x5b, 0x48, 0x1b, 0x5b, 0x32,
+	0x4a, 0x00, 0x1b, 0x5b, 0x4b, 0x00, 0x1b, 0x5b, 0x4a, 0x00, 0x1b, 0x5b,
+	0x25, 0x69, 0x25, 0x70, 0x31, 0x25, 0x64, 0x47, 0x00, 0x1b, 0x5b, 0x25,
+	0x69, 0x25, 0x70, 0x31, 0x25, 0x64, 0x3b, 0x25, 0x70, 0x32, 0x25, 0x64,
+	0x48, 0x00, 0x0a, 0x00, 0x1b, 0x5b, 0x48, 0x00, 0x1b, 0x5b, 0x3f, 0x32,
+	0x35, 0x6c, 0x00, 0x08, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x32, 0x6c, 0x1b,
+	0x5b, 0x3f, 0x32, 0x35, 0x68, 0x00, 0x1b, 0x5b, 0x43, 0x00, 0x1b, 0x5b,
+	0x41, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x32, 0x3b, 0x32, 0x35, 0x68, 0x00,
+	0x1b, 0x5b, 0x50, 0x00, 0x1b, 0x5b, 0x4d, 0x00, 0x1b, 0x28, 0x30, 0x00,
+	0x1b, 0x5b, 0x35, 0x6d, 0x00, 0x1b, 0x5b, 0x31, 0x6d, 0x00, 0x1b, 0x5b,
+	0x3f, 0x31, 0x30, 0x34, 0x39, 0x68, 0x1b, 0x5b, 0x32, 0x32, 0x3b, 0x30,
+	0x3b, 0x30, 0x74, 0x00, 0x1b, 0x5b, 0x32, 0x6d, 0x00, 0x1b, 0x5b, 0x34,
+	0x68, 0x00, 0x1b, 0x5b, 0x38, 0x6d, 0x00, 0x1b, 0x5b, 0x37, 0x6d, 0x00,
+	0x1b, 0x5b, 0x37, 0x6d, 0x00, 0x1b, 0x5b, 0x34, 0x6d, 0x00, 0x1b, 0x5b,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x58, 0x00, 0x1b, 0x28, 0x42, 0x00, 0x1b,
+	0x28, 0x42, 0x1b, 0x5b, 0x6d, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x30, 0x34,
+	0x39, 0x6c, 0x1b, 0x5b, 0x32, 0x33, 0x3b, 0x30, 0x3b, 0x30, 0x74, 0x00,
+	0x1b, 0x5b, 0x34, 0x6c, 0x00, 0x1b, 0x5b, 0x32, 0x37, 0x6d, 0x00, 0x1b,
+	0x5b, 0x32, 0x34, 0x6d, 0x00, 0x1b, 0x5b, 0x3f, 0x35, 0x68, 0x24, 0x3c,
+	0x31, 0x30, 0x30, 0x2f, 0x3e, 0x1b, 0x5b, 0x3f, 0x35, 0x6c, 0x00, 0x1b,
+	0x5b, 0x21, 0x70, 0x1b, 0x5b, 0x3f, 0x33, 0x3b, 0x34, 0x6c, 0x1b, 0x5b,
+	0x34, 0x6c, 0x1b, 0x3e, 0x00, 0x1b, 0x5b, 0x4c, 0x00, 0x7f, 0x00, 0x1b,
+	0x5b, 0x33, 0x7e, 0x00, 0x1b, 0x4f, 0x42, 0x00, 0x1b, 0x4f, 0x50, 0x00,
+	0x1b, 0x5b, 0x32, 0x31, 0x7e, 0x00, 0x1b, 0x4f, 0x51, 0x00, 0x1b, 0x4f,
+	0x52, 0x00, 0x1b, 0x4f, 0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x7e, 0x00,
+	0x1b, 0x5b, 0x31, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x7e, 0x00,
+	0x1b, 0x5b, 0x31, 0x39, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x7e, 0x00,
+	0x1b, 0x4f, 0x48, 0x00, 0x1b, 0x5b, 0x32, 0x7e, 0x00, 0x1b, 0x4f, 0x44,
+	0x00, 0x1b, 0x5b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x7e, 0x00, 0x1b,
+	0x4f, 0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x42, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x32, 0x41, 0x00, 0x1b, 0x4f, 0x41, 0x00, 0x1b, 0x5b, 0x3f,
+	0x31, 0x6c, 0x1b, 0x3e, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x68, 0x1b, 0x3d,
+	0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x30, 0x33, 0x34, 0x6c, 0x00, 0x1b, 0x5b,
+	0x3f, 0x31, 0x30, 0x33, 0x34, 0x68, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31,
+	0x25, 0x64, 0x50, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x4d,
+	0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x42, 0x00, 0x1b, 0x5b,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x40, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31,
+	0x25, 0x64, 0x53, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x4c,
+	0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x44, 0x00, 0x1b, 0x5b,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x43, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31,
+	0x25, 0x64, 0x54, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x41,
+	0x00, 0x1b, 0x5b, 0x69, 0x00, 0x1b, 0x5b, 0x34, 0x69, 0x00, 0x1b, 0x5b,
+	0x35, 0x69, 0x00, 0x1b, 0x63, 0x00, 0x1b, 0x5b, 0x21, 0x70, 0x1b, 0x5b,
+	0x3f, 0x33, 0x3b, 0x34, 0x6c, 0x1b, 0x5b, 0x34, 0x6c, 0x1b, 0x3e, 0x00,
+	0x1b, 0x38, 0x00, 0x1b, 0x5b, 0x25, 0x69, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x64, 0x00, 0x1b, 0x37, 0x00, 0x0a, 0x00, 0x1b, 0x4d, 0x00, 0x25, 0x3f,
+	0x25, 0x70, 0x39, 0x25, 0x74, 0x1b, 0x28, 0x30, 0x25, 0x65, 0x1b, 0x28,
+	0x42, 0x25, 0x3b, 0x1b, 0x5b, 0x30, 0x25, 0x3f, 0x25, 0x70, 0x36, 0x25,
+	0x74, 0x3b, 0x31, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x35, 0x25, 0x74,
+	0x3b, 0x32, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x32, 0x25, 0x74, 0x3b,
+	0x34, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x31, 0x25, 0x70, 0x33, 0x25,
+	0x7c, 0x25, 0x74, 0x3b, 0x37, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x34,
+	0x25, 0x74, 0x3b, 0x35, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x37, 0x25,
+	0x74, 0x3b, 0x38, 0x25, 0x3b, 0x6d, 0x00, 0x1b, 0x48, 0x00, 0x09, 0x00,
+	0x1b, 0x4f, 0x45, 0x00, 0x60, 0x60, 0x61, 0x61, 0x66, 0x66, 0x67, 0x67,
+	0x69, 0x69, 0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6e, 0x6e,
+	0x6f, 0x6f, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74,
+	0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7a,
+	0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x00, 0x1b, 0x5b, 0x5a,
+	0x00, 0x1b, 0x5b, 0x3f, 0x37, 0x68, 0x00, 0x1b, 0x5b, 0x3f, 0x37, 0x6c,
+	0x00, 0x1b, 0x4f, 0x46, 0x00, 0x1b, 0x4f, 0x4d, 0x00, 0x1b, 0x5b, 0x33,
+	0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x46, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x32, 0x48, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x32, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x44, 0x00, 0x1b, 0x5b, 0x36, 0x3b,
+	0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x32, 0x43, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x50, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32,
+	0x52, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x53, 0x00, 0x1b, 0x5b, 0x31,
+	0x35, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b, 0x32, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x38, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31,
+	0x39, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b, 0x32, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x31, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x33, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b, 0x32, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x35, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x52, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x35, 0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x3b, 0x35, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31,
+	0x38, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x39, 0x3b, 0x35, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x31, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x3b, 0x35, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x36, 0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x51, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x36, 0x52, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x53,
+	0x00, 0x1b, 0x5b, 0x31, 0x35, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31,
+	0x37, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x3b, 0x36, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x39, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x30, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x31, 0x3b, 0x36, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x33, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x34, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x50, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33,
+	0x52, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x53, 0x00, 0x1b, 0x5b, 0x31,
+	0x35, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x38, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x31,
+	0x39, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x31, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x33, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x34, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x52, 0x00, 0x1b, 0x5b,
+	0x31, 0x4b, 0x00, 0x1b, 0x5b, 0x25, 0x69, 0x25, 0x64, 0x3b, 0x25, 0x64,
+	0x52, 0x00, 0x1b, 0x5b, 0x36, 0x6e, 0x00, 0x1b, 0x5b, 0x3f, 0x25, 0x5b,
+	0x3b, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5d,
+	0x63, 0x00, 0x1b, 0x5b, 0x63, 0x00, 0x1b, 0x5b, 0x33, 0x39, 0x3b, 0x34,
+	0x39, 0x6d, 0x00, 0x1b, 0x5b, 0x33, 0x25, 0x3f, 0x25, 0x70, 0x31, 0x25,
+	0x7b, 0x31, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x34, 0x25, 0x65, 0x25, 0x70,
+	0x31, 0x25, 0x7b, 0x33, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x36, 0x25, 0x65,
+	0x25, 0x70, 0x31, 0x25, 0x7b, 0x34, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x31,
+	0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x36, 0x7d, 0x25, 0x3d, 0x25,
+	0x74, 0x33, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x64, 0x25, 0x3b, 0x6d,
+	0x00, 0x1b, 0x5b, 0x34, 0x25, 0x3f, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x31,
+	0x7d, 0x25, 0x3d, 0x25, 0x74, 0x34, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25,
+	0x7b, 0x33, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x36, 0x25, 0x65, 0x25, 0x70,
+	0x31, 0x25, 0x7b, 0x34, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x31, 0x25, 0x65,
+	0x25, 0x70, 0x31, 0x25, 0x7b, 0x36, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x33,
+	0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x64, 0x25, 0x3b, 0x6d, 0x00, 0x1b,
+	0x5b, 0x33, 0x6d, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x6d, 0x00, 0x1b, 0x5b,
+	0x4d, 0x00, 0x1b, 0x5b, 0x33, 0x25, 0x70, 0x31, 0x25, 0x64, 0x6d, 0x00,
+	0x1b, 0x5b, 0x34, 0x25, 0x70, 0x31, 0x25, 0x64, 0x6d, 0x00, 0x1b, 0x6c,
+	0x00, 0x1b, 0x6d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x7a, 0x00,
+	0xf3, 0x02, 0x01, 0x01, 0x00, 0x00, 0x07, 0x00, 0x13, 0x00, 0x18, 0x00,
+	0x2a, 0x00, 0x30, 0x00, 0x3a, 0x00, 0x41, 0x00, 0x48, 0x00, 0x4f, 0x00,
+	0x56, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x72, 0x00, 0x79, 0x00,
+	0x80, 0x00, 0x87, 0x00, 0x8e, 0x00, 0x95, 0x00, 0x9c, 0x00, 0xa3, 0x00,
+	0xaa, 0x00, 0xb1, 0x00, 0xb8, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0xcd, 0x00,
+	0xd4, 0x00, 0xdb, 0x00, 0xe2, 0x00, 0xe9, 0x00, 0xf0, 0x00, 0xf7, 0x00,
+	0xfe, 0x00, 0x05, 0x01, 0x0c, 0x01, 0x13, 0x01, 0x1a, 0x01, 0x21, 0x01,
+	0x28, 0x01, 0x2f, 0x01, 0x36, 0x01, 0x3d, 0x01, 0x44, 0x01, 0x4b, 0x01,
+	0x52, 0x01, 0x59, 0x01, 0x60, 0x01, 0x67, 0x01, 0x6e, 0x01, 0x75, 0x01,
+	0x7c, 0x01, 0x83, 0x01, 0x8a, 0x01, 0x91, 0x01, 0x98, 0x01, 0x9f, 0x01,
+	0xa6, 0x01, 0xac, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x09, 0x00,
+	0x0c, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x15, 0x00, 0x18, 0x00, 0x1d, 0x00,
+	0x22, 0x00, 0x27, 0x00, 0x2c, 0x00, 0x31, 0x00, 0x35, 0x00, 0x3a, 0x00,
+	0x3f, 0x00, 0x44, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x5a, 0x00,
+	0x60, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x78, 0x00, 0x7e, 0x00,
+	0x84, 0x00, 0x8a, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x99, 0x00, 0x9e, 0x00,
+	0xa3, 0x00, 0xa9, 0x00, 0xaf, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0xc1, 0x00,
+	0xc7, 0x00, 0xcd, 0x00, 0xd3, 0x00, 0xd9, 0x00, 0xdf, 0x00, 0xe5, 0x00,
+	0xeb, 0x00, 0xf1, 0x00, 0xf7, 0x00, 0xfd, 0x00, 0x03, 0x01, 0x09, 0x01,
+	0x0f, 0x01, 0x15, 0x01, 0x1b, 0x01, 0x1f, 0x01, 0x24, 0x01, 0x29, 0x01,
+	0x2e, 0x01, 0x33, 0x01, 0x38, 0x01, 0x3d, 0x01, 0x1b, 0x5d, 0x31, 0x31,
+	0x32, 0x07, 0x00, 0x1b, 0x5d, 0x31, 0x32, 0x3b, 0x25, 0x70, 0x31, 0x25,
+	0x73, 0x07, 0x00, 0x1b, 0x5b, 0x33, 0x4a, 0x00, 0x1b, 0x5d, 0x35, 0x32,
+	0x3b, 0x25, 0x70, 0x31, 0x25, 0x73, 0x3b, 0x25, 0x70, 0x32, 0x25, 0x73,
+	0x07, 0x00, 0x1b, 0x5b, 0x32, 0x20, 0x71, 0x00, 0x1b, 0x5b, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x20, 0x71, 0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b,
+	0x33, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x42, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34,
+	0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x42, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x36, 0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x42, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x33, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x46,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x36, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x46, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x33, 0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x48, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36,
+	0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x48, 0x00, 0x1b, 0x5b, 0x32,
+	0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x34, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x36, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x33, 0x44, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x44, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x35, 0x44, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x44, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x44, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x33,
+	0x7e, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x36,
+	0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x36, 0x7e, 0x00, 0x1b,
+	0x5b, 0x36, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b,
+	0x35, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x43, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35,
+	0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x43, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x37, 0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x41, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x33, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x41,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x36, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x41, 0x00, 0x1b, 0x5b,
+	0x32, 0x39, 0x6d, 0x00, 0x1b, 0x5b, 0x39, 0x6d, 0x00, 0x41, 0x58, 0x00,
+	0x58, 0x54, 0x00, 0x43, 0x72, 0x00, 0x43, 0x73, 0x00, 0x45, 0x33, 0x00,
+	0x4d, 0x73, 0x00, 0x53, 0x65, 0x00, 0x53, 0x73, 0x00, 0x6b, 0x44, 0x43,
+	0x33, 0x00, 0x6b, 0x44, 0x43, 0x34, 0x00, 0x6b, 0x44, 0x43, 0x35, 0x00,
+	0x6b, 0x44, 0x43, 0x36, 0x00, 0x6b, 0x44, 0x43, 0x37, 0x00, 0x6b, 0x44,
+	0x4e, 0x00, 0x6b, 0x44, 0x4e, 0x33, 0x00, 0x6b, 0x44, 0x4e, 0x34, 0x00,
+	0x6b, 0x44, 0x4e, 0x35, 0x00, 0x6b, 0x44, 0x4e, 0x36, 0x00, 0x6b, 0x44,
+	0x4e, 0x37, 0x00, 0x6b, 0x45, 0x4e, 0x44, 0x33, 0x00, 0x6b, 0x45, 0x4e,
+	0x44, 0x34, 0x00, 0x6b, 0x45, 0x4e, 0x44, 0x35, 0x00, 0x6b, 0x45, 0x4e,
+	0x44, 0x36, 0x00, 0x6b, 0x45, 0x4e, 0x44, 0x37, 0x00, 0x6b, 0x48, 0x4f,
+	0x4d, 0x33, 0x00, 0x6b, 0x48, 0x4f, 0x4d, 0x34, 0x00, 0x6b, 0x48, 0x4f,
+	0x4d, 0x35, 0x00, 0x6b, 0x48, 0x4f, 0x4d, 0x36, 0x00, 0x6b, 0x48, 0x4f,
+	0x4d, 0x37, 0x00, 0x6b, 0x49, 0x43, 0x33, 0x00, 0x6b, 0x49, 0x43, 0x34,
+	0x00, 0x6b, 0x49, 0x43, 0x35, 0x00, 0x6b, 0x49, 0x43, 0x36, 0x00, 0x6b,
+	0x49, 0x43, 0x37, 0x00, 0x6b, 0x4c, 0x46, 0x54, 0x33, 0x00, 0x6b, 0x4c,
+	0x46, 0x54, 0x34, 0x00, 0x6b, 0x4c, 0x46, 0x54, 0x35, 0x00, 0x6b, 0x4c,
+	0x46, 0x54, 0x36, 0x00, 0x6b, 0x4c, 0x46, 0x54, 0x37, 0x00, 0x6b, 0x4e,
+	0x58, 0x54, 0x33, 0x00, 0x6b, 0x4e, 0x58, 0x54, 0x34, 0x00, 0x6b, 0x4e,
+	0x58, 0x54, 0x35, 0x00, 0x6b, 0x4e, 0x58, 0x54, 0x36, 0x00, 0x6b, 0x4e,
+	0x58, 0x54, 0x37, 0x00, 0x6b, 0x50, 0x52, 0x56, 0x33, 0x00, 0x6b, 0x50,
+	0x52, 0x56, 0x34, 0x00, 0x6b, 0x50, 0x52, 0x56, 0x35, 0x00, 0x6b, 0x50,
+	0x52, 0x56, 0x36, 0x00, 0x6b, 0x50, 0x52, 0x56, 0x37, 0x00, 0x6b, 0x52,
+	0x49, 0x54, 0x33, 0x00, 0x6b, 0x52, 0x49, 0x54, 0x34, 0x00, 0x6b, 0x52,
+	0x49, 0x54, 0x35, 0x00, 0x6b, 0x52, 0x49, 0x54, 0x36, 0x00, 0x6b, 0x52,
+	0x49, 0x54, 0x37, 0x00, 0x6b, 0x55, 0x50, 0x00, 0x6b, 0x55, 0x50, 0x33,
+	0x00, 0x6b, 0x55, 0x50, 0x34, 0x00, 0x6b, 0x55, 0x50, 0x35, 0x00, 0x6b,
+	0x55, 0x50, 0x36, 0x00, 0x6b, 0x55, 0x50, 0x37, 0x00, 0x72, 0x6d, 0x78,
+	0x78, 0x00, 0x73, 0x6d, 0x78, 0x78, 0x00,
+};
+static const int32_t ti_bi1_nums[] = {
+	80, 8, 24, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8, 64,
+};
+static char * const ti_bi1_strs[] = {
+	TI_BI_STR(1, 948),
+	TI_BI_STR(1, 952),
+	TI_BI_STR(1, 954),
+	TI_BI_STR(1, 956),
+	TI_BI_STR(1, 973),
+	TI_BI_STR(1, 978),
+	TI_BI_STR(1, 986),
+	TI_BI_STR(1, 990),
+	TI_BI_STR(1, 994),
+	NULL,
+	TI_BI_STR(1, 1005),
+	TI_BI_STR(1, 1022),
+	TI_BI_STR(1, 1024),
+	TI_BI_STR(1, 1028),
+	TI_BI_STR(1, 1035),
+	NULL,
+	TI_BI_STR(1, 1037),
+	TI_BI_STR(1, 1050),
+	NULL,
+	TI_BI_STR(1, 1054),
+	TI_BI_STR(1, 1058),
+	TI_BI_STR(1, 1068),
+	TI_BI_STR(1, 1072),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1076),
+	TI_BI_STR(1, 1080),
+	TI_BI_STR(1, 1085),
+	TI_BI_STR(1, 1090),
+	NULL,
+	TI_BI_STR(1, 1108),
+	TI_BI_STR(1, 1113),
+	TI_BI_STR(1, 1118),
+	NULL,
+	TI_BI_STR(1, 1123),
+	TI_BI_STR(1, 1128),
+	TI_BI_STR(1, 1133),
+	TI_BI_STR(1, 1138),
+	TI_BI_STR(1, 1147),
+	TI_BI_STR(1, 1151),
+	TI_BI_STR(1, 1158),
+	NULL,
+	TI_BI_STR(1, 1176),
+	TI_BI_STR(1, 1181),
+	TI_BI_STR(1, 1187),
+	TI_BI_STR(1, 1193),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1211),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1229),
+	NULL,
+	TI_BI_STR(1, 1233),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1235),
+	NULL,
+	TI_BI_STR(1, 1240),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1244),
+	TI_BI_STR(1, 1248),
+	TI_BI_STR(1, 1254),
+	TI_BI_STR(1, 1258),
+	TI_BI_STR(1, 1262),
+	TI_BI_STR(1, 1266),
+	TI_BI_STR(1, 1272),
+	TI_BI_STR(1, 1278),
+	TI_BI_STR(1, 1284),
+	TI_BI_STR(1, 1290),
+	TI_BI_STR(1, 1296),
+	TI_BI_STR(1, 1300),
+	NULL,
+	TI_BI_STR(1, 1305),
+	NULL,
+	TI_BI_STR(1, 1309),
+	TI_BI_STR(1, 1314),
+	TI_BI_STR(1, 1319),
+	TI_BI_STR(1, 1323),
+	TI_BI_STR(1, 1330),
+	NULL,
+	TI_BI_STR(1, 1337),
+	TI_BI_STR(1, 1341),
+	TI_BI_STR(1, 1349),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1357),
+	TI_BI_STR(1, 1366),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1375),
+	TI_BI_STR(1, 1384),
+	TI_BI_STR(1, 1393),
+	TI_BI_STR(1, 1402),
+	TI_BI_STR(1, 1411),
+	TI_BI_STR(1, 1420),
+	TI_BI_STR(1, 1429),
+	TI_BI_STR(1, 1438),
+	TI_BI_STR(1, 1447),
+	TI_BI_STR(1, 1456),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1465),
+	TI_BI_STR(1, 1469),
+	TI_BI_STR(1, 1474),
+	NULL,
+	TI_BI_STR(1, 1479),
+	TI_BI_STR(1, 1482),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1500),
+	TI_BI_STR(1, 1503),
+	TI_BI_STR(1, 1514),
+	TI_BI_STR(1, 1517),
+	TI_BI_STR(1, 1519),
+	TI_BI_STR(1, 1522),
+	TI_BI_STR(1, 1615),
+	NULL,
+	TI_BI_STR(1, 1618),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1620),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1624),
+	NULL,
+	TI_BI_STR(1, 1677),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1681),
+	TI_BI_STR(1, 1687),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1693),
+	TI_BI_STR(1, 1697),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1701),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1708),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1715),
+	TI_BI_STR(1, 1722),
+	TI_BI_STR(1, 1729),
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1736),
+	NULL,
+	TI_BI_STR(1, 1743),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1750),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 1757),
+	TI_BI_STR(1, 1763),
+	TI_BI_STR(1, 1769),
+	TI_BI_STR(1, 1776),
+	TI_BI_STR(1, 1783),
+	TI_BI_STR(1, 1790),
+	TI_BI_STR(1, 1797),
+	TI_BI_STR(1, 1805),
+	TI_BI_STR(1, 1813),
+	TI_BI_STR(1, 1821),
+	TI_BI_STR(1, 1829),
+	TI_BI_STR(1, 1837),
+	TI_BI_STR(1, 1845),
+	TI_BI_STR(1, 1853),
+	TI_BI_STR(1, 1861),
+	TI_BI_STR(1, 1868),
+	TI_BI_STR(1, 1875),
+	TI_BI_STR(1, 1882),
+	TI_BI_STR(1, 1889),
+	TI_BI_STR(1, 1897),
+	TI_BI_STR(1, 1905),
+	TI_BI_STR(1, 1913),
+	TI_BI_STR(1, 1921),
+	TI_BI_STR(1, 1929),
+	TI_BI_STR(1, 1937),
+	TI_BI_STR(1, 1945),
+	TI_BI_STR(1, 1953),
+	TI_BI_STR(1, 1960),
+	TI_BI_STR(1, 1967),
+	TI_BI_STR(1, 1974),
+	TI_BI_STR(1, 1981),
+	TI_BI_STR(1, 1989),
+	TI_BI_STR(1, 1997),
+	TI_BI_STR(1, 2005),
+	TI_BI_STR(1, 2013),
+	TI_BI_STR(1, 2021),
+	TI_BI_STR(1, 2029),
+	TI_BI_STR(1, 2037),
+	TI_BI_STR(1, 2045),
+	TI_BI_STR(1, 2052),
+	TI_BI_STR(1, 2059),
+	TI_BI_STR(1, 2066),
+	TI_BI_STR(1, 2073),
+	TI_BI_STR(1, 2081),
+	TI_BI_STR(1, 2089),
+	TI_BI_STR(1, 2097),
+	TI_BI_STR(1, 2105),
+	TI_BI_STR(1, 2113),
+	TI_BI_STR(1, 2121),
+	TI_BI_STR(1, 2129),
+	TI_BI_STR(1, 2137),
+	TI_BI_STR(1, 2144),
+	TI_BI_STR(1, 2151),
+	TI_BI_STR(1, 2158),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2163),
+	TI_BI_STR(1, 2174),
+	TI_BI_STR(1, 2179),
+	TI_BI_STR(1, 2198),
+	TI_BI_STR(1, 2202),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2211),
+	TI_BI_STR(1, 2281),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2351),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2356),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2362),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2366),
+	TI_BI_STR(1, 2376),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(1, 2386),
+	TI_BI_STR(1, 2389),
+};
+static char * const ti_bi1_ext_strs[] = {
+	TI_BI_STR(1, 2648),
+	TI_BI_STR(1, 2655),
+	TI_BI_STR(1, 2667),
+	TI_BI_STR(1, 2672),
+	TI_BI_STR(1, 2690),
+	TI_BI_STR(1, 2696),
+	TI_BI_STR(1, 2706),
+	TI_BI_STR(1, 2713),
+	TI_BI_STR(1, 2720),
+	TI_BI_STR(1, 2727),
+	TI_BI_STR(1, 2734),
+	TI_BI_STR(1, 2741),
+	TI_BI_STR(1, 2748),
+	TI_BI_STR(1, 2755),
+	TI_BI_STR(1, 2762),
+	TI_BI_STR(1, 2769),
+	TI_BI_STR(1, 2776),
+	TI_BI_STR(1, 2783),
+	TI_BI_STR(1, 2790),
+	TI_BI_STR(1, 2797),
+	TI_BI_STR(1, 2804),
+	TI_BI_STR(1, 2811),
+	TI_BI_STR(1, 2818),
+	TI_BI_STR(1, 2825),
+	TI_BI_STR(1, 2832),
+	TI_BI_STR(1, 2839),
+	TI_BI_STR(1, 2846),
+	TI_BI_STR(1, 2853),
+	TI_BI_STR(1, 2860),
+	TI_BI_STR(1, 2867),
+	TI_BI_STR(1, 2874),
+	TI_BI_STR(1, 2881),
+	TI_BI_STR(1, 2888),
+	TI_BI_STR(1, 2895),
+	TI_BI_STR(1, 2902),
+	TI_BI_STR(1, 2909),
+	TI_BI_STR(1, 2916),
+	TI_BI_STR(1, 2923),
+	TI_BI_STR(1, 2930),
+	TI_BI_STR(1, 2937),
+	TI_BI_STR(1, 2944),
+	TI_BI_STR(1, 2951),
+	TI_BI_STR(1, 2958),
+	TI_BI_STR(1, 2965),
+	TI_BI_STR(1, 2972),
+	TI_BI_STR(1, 2979),
+	TI_BI_STR(1, 2986),
+	TI_BI_STR(1, 2993),
+	TI_BI_STR(1, 3000),
+	TI_BI_STR(1, 3007),
+	TI_BI_STR(1, 3014),
+	TI_BI_STR(1, 3021),
+	TI_BI_STR(1, 3028),
+	TI_BI_STR(1, 3035),
+	TI_BI_STR(1, 3042),
+	TI_BI_STR(1, 3049),
+	TI_BI_STR(1, 3056),
+	TI_BI_STR(1, 3063),
+	TI_BI_STR(1, 3070),
+	TI_BI_STR(1, 3076),
+};
+static char * const ti_bi1_ext_names[] = {
+	TI_BI_STR(1, 3081),
+	TI_BI_STR(1, 3084),
+	TI_BI_STR(1, 3087),
+	TI_BI_STR(1, 3090),
+	TI_BI_STR(1, 3093),
+	TI_BI_STR(1, 3096),
+	TI_BI_STR(1, 3099),
+	TI_BI_STR(1, 3102),
+	TI_BI_STR(1, 3105),
+	TI_BI_STR(1, 3110),
+	TI_BI_STR(1, 3115),
+	TI_BI_STR(1, 3120),
+	TI_BI_STR(1, 3125),
+	TI_BI_STR(1, 3130),
+	TI_BI_STR(1, 3134),
+	TI_BI_STR(1, 3139),
+	TI_BI_STR(1, 3144),
+	TI_BI_STR(1, 3149),
+	TI_BI_STR(1, 3154),
+	TI_BI_STR(1, 3159),
+	TI_BI_STR(1, 3165),
+	TI_BI_STR(1, 3171),
+	TI_BI_STR(1, 3177),
+	TI_BI_STR(1, 3183),
+	TI_BI_STR(1, 3189),
+	TI_BI_STR(1, 3195),
+	TI_BI_STR(1, 3201),
+	TI_BI_STR(1, 3207),
+	TI_BI_STR(1, 3213),
+	TI_BI_STR(1, 3219),
+	TI_BI_STR(1, 3224),
+	TI_BI_STR(1, 3229),
+	TI_BI_STR(1, 3234),
+	TI_BI_STR(1, 3239),
+	TI_BI_STR(1, 3244),
+	TI_BI_STR(1, 3250),
+	TI_BI_STR(1, 3256),
+	TI_BI_STR(1, 3262),
+	TI_BI_STR(1, 3268),
+	TI_BI_STR(1, 3274),
+	TI_BI_STR(1, 3280),
+	TI_BI_STR(1, 3286),
+	TI_BI_STR(1, 3292),
+	TI_BI_STR(1, 3298),
+	TI_BI_STR(1, 3304),
+	TI_BI_STR(1, 3310),
+	TI_BI_STR(1, 3316),
+	TI_BI_STR(1, 3322),
+	TI_BI_STR(1, 3328),
+	TI_BI_STR(1, 3334),
+	TI_BI_STR(1, 3340),
+	TI_BI_STR(1, 3346),
+	TI_BI_STR(1, 3352),
+	TI_BI_STR(1, 3358),
+	TI_BI_STR(1, 3364),
+	TI_BI_STR(1, 3368),
+	TI_BI_STR(1, 3373),
+	TI_BI_STR(1, 3378),
+	TI_BI_STR(1, 3383),
+	TI_BI_STR(1, 3388),
+	TI_BI_STR(1, 3393),
+	TI_BI_STR(1, 3398),
+};
+static const uint16_t ti_bi1_ext_hash[] = {
+	3, 19, 32, 8, 41, 49, 0, 12, 0, 2,
+	57, 0, 20, 0, 0, 0, 0, 35, 26, 4,
+	0, 0, 46, 42, 0, 0, 11, 0, 56, 0,
+	0, 0, 0, 0, 50, 0, 36, 27, 62, 30,
+	9, 47, 43, 0, 14, 10, 0, 0, 52, 0,
+	0, 25, 0, 0, 0, 37, 0, 0, 0, 0,
+	0, 44, 0, 0, 24, 0, 0, 51, 0, 7,
+	0, 55, 16, 5, 33, 38, 0, 15, 0, 45,
+	60, 0, 0, 23, 0, 0, 54, 0, 61, 0,
+	0, 17, 34, 39, 0, 0, 0, 0, 0, 59,
+	0, 0, 22, 0, 0, 53, 0, 0, 28, 0,
+	18, 31, 48, 6, 40, 0, 13, 0, 58, 0,
+	0, 21, 0, 0, 1, 0, 0, 29,
+};
+static const ti_terminfo ti_bi1 = {
+	.term_names      = TI_BI_STR(1, 12),
+	.bools           = (int8_t *)TI_BI_STR(1, 53),
+	.nums            = (int32_t *)ti_bi1_nums,
+	.strs            = (char **)ti_bi1_strs,
+	.bools_count     = 38,
+	.nums_count      = 15,
+	.strs_count      = 413,
+	.ext_bools       = (int8_t *)TI_BI_STR(1, 2402),
+	.ext_strs        = (char **)ti_bi1_ext_strs,
+	.ext_bool_names  = (char **)ti_bi1_ext_names,
+	.ext_num_names   = (char **)ti_bi1_ext_names + 2,
+	.ext_str_names   = (char **)ti_bi1_ext_names + 2,
+	.ext_bools_count = 2,
+	.ext_nums_count  = 0,
+	.ext_strs_count  = 60,
+	.ext_names       = (char **)ti_bi1_ext_names,
+	.ext_names_count = 62,
+	.ext_hash        = (uint16_t *)ti_bi1_ext_hash,
+	.ext_hash_mask   = 127,
+	.data            = (char *)ti_bi1_data,
+	.len             = 3403,
+	.numsz           = 2,
+	.flags           = TI_F_STATIC,
+};
+
+// xterm-kitty|KovIdTTY
+static const char ti_bi2_data[] = {
+	0x1a, 0x01, 0x15, 0x00, 0x1c, 0x00, 0x0f, 0x00, 0x69, 0x01, 0x67, 0x05,
+	0x78, 0x74, 0x65, 0x72, 0x6d, 0x2d, 0x6b, 0x69, 0x74, 0x74, 0x79, 0x7c,
+	0x4b, 0x6f, 0x76, 0x49, 0x64, 0x54, 0x54, 0x59, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x50, 0x00, 0x08, 0x00, 0x18, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x7f, 0x00, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x08, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2a, 0x00,
+	0x2e, 0x00, 0xff, 0xff, 0x39, 0x00, 0x4a, 0x00, 0x4c, 0x00, 0x50, 0x00,
+	0x57, 0x00, 0xff, 0xff, 0x59, 0x00, 0x66, 0x00, 0xff, 0xff, 0x6a, 0x00,
+	0x6e, 0x00, 0x78, 0x00, 0x7c, 0x00, 0x80, 0x00, 0xff, 0xff, 0x86, 0x00,
+	0xff, 0xff, 0x8a, 0x00, 0x8f, 0x00, 0xff, 0xff, 0x98, 0x00, 0x9d, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0xa7, 0x00, 0xac, 0x00, 0xb1, 0x00,
+	0xba, 0x00, 0xbe, 0x00, 0xc5, 0x00, 0xff, 0xff, 0xce, 0x00, 0xd3, 0x00,
+	0xd9, 0x00, 0xdf, 0x00, 0xff, 0xff, 0xf1, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0xff, 0xff, 0xf7, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfe, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x01, 0x06, 0x01,
+	0x0c, 0x01, 0x10, 0x01, 0x14, 0x01, 0x18, 0x01, 0x1e, 0x01, 0x24, 0x01,
+	0x2a, 0x01, 0x30, 0x01, 0x36, 0x01, 0x3a, 0x01, 0xff, 0xff, 0x3f, 0x01,
+	0xff, 0xff, 0x43, 0x01, 0x48, 0x01, 0x4d, 0x01, 0x51, 0x01, 0x58, 0x01,
+	0xff, 0xff, 0x5f, 0x01, 0x63, 0x01, 0x69, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x6f, 0x01, 0x78, 0x01, 0x81, 0x01, 0x8a, 0x01, 0x93, 0x01,
+	0x9c, 0x01, 0xa5, 0x01, 0xae, 0x01, 0xb7, 0x01, 0xc0, 0x01, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xc9, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x01, 0xd3, 0x01,
+	0xde, 0x01, 0xe1, 0x01, 0xe3, 0x01, 0xe6, 0x01, 0x38, 0x02, 0xff, 0xff,
+	0x3b, 0x02, 0x3d, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x02,
+	0x43, 0x02, 0xff, 0xff, 0x44, 0x02, 0x45, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0x46, 0x02, 0xff, 0xff, 0x87, 0x02, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x02,
+	0x91, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x97, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x02, 0xff, 0xff, 0xff, 0xff,
+	0xa4, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x02,
+	0xb2, 0x02, 0xb9, 0x02, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x02, 0xff, 0xff,
+	0xc7, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x02, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x02, 0xdb, 0x02,
+	0xe1, 0x02, 0xe8, 0x02, 0xef, 0x02, 0xf6, 0x02, 0xfd, 0x02, 0x05, 0x03,
+	0x0d, 0x03, 0x15, 0x03, 0x1d, 0x03, 0x25, 0x03, 0x2d, 0x03, 0x35, 0x03,
+	0x3d, 0x03, 0x44, 0x03, 0x4b, 0x03, 0x52, 0x03, 0x59, 0x03, 0x61, 0x03,
+	0x69, 0x03, 0x71, 0x03, 0x79, 0x03, 0x81, 0x03, 0x89, 0x03, 0x91, 0x03,
+	0x99, 0x03, 0xa0, 0x03, 0xa7, 0x03, 0xae, 0x03, 0xb5, 0x03, 0xbd, 0x03,
+	0xc5, 0x03, 0xcd, 0x03, 0xd5, 0x03, 0xdd, 0x03, 0xe5, 0x03, 0xed, 0x03,
+	0xf5, 0x03, 0xfc, 0x03, 0x03, 0x04, 0x0a, 0x04, 0x11, 0x04, 0x19, 0x04,
+	0x21, 0x04, 0x29, 0x04, 0x31, 0x04, 0x39, 0x04, 0x41, 0x04, 0x49, 0x04,
+	0x51, 0x04, 0x58, 0x04, 0x5f, 0x04, 0x66, 0x04, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x6b, 0x04, 0x74, 0x04, 0x7b, 0x04, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x04, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xde, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x04,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x04, 0x27, 0x05, 0x1b, 0x5b,
+	0x5a, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x1b, 0x5b, 0x25, 0x69, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x3b, 0x25, 0x70, 0x32, 0x25, 0x64, 0x72, 0x00, 0x1b,
+	0x5b, 0x33, 0x67, 0x00, 0x1b, 0x5b, 0x48, 0x1b, 0x5b, 0x32, 0x4a, 0x00,
+	0x1b, 0x5b, 0x4b, 0x00, 0x1b, 0x5b, 0x4a, 0x00, 0x1b, 0x5b, 0x25, 0x69,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x47, 0x00, 0x1b, 0x5b, 0x25, 0x69, 0x25,
+	0x70, 0x31, 0x25, 0x64, 0x3b, 0x25, 0x70, 0x32, 0x25, 0x64, 0x48, 0x00,
+	0x0a, 0x00, 0x1b, 0x5b, 0x48, 0x00, 0x1b, 0x5b, 0x3f, 0x32, 0x35, 0x6c,
+	0x00, 0x08, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x32, 0x6c, 0x1b, 0x5b, 0x3f,
+	0x32, 0x35, 0x68, 0x00, 0x1b, 0x5b, 0x43, 0x00, 0x1b, 0x5b, 0x41, 0x00,
+	0x1b, 0x5b, 0x3f, 0x31, 0x32, 0x3b, 0x32, 0x35, 0x68, 0x00, 0x1b, 0x5b,
+	0x50, 0x00, 0x1b, 0x5b, 0x4d, 0x00, 0x1b, 0x5d, 0x32, 0x3b, 0x07, 0x00,
+	0x1b, 0x28, 0x30, 0x00, 0x1b, 0x5b, 0x31, 0x6d, 0x00, 0x1b, 0x5b, 0x3f,
+	0x31, 0x30, 0x34, 0x39, 0x68, 0x00, 0x1b, 0x5b, 0x32, 0x6d, 0x00, 0x1b,
+	0x5b, 0x34, 0x68, 0x00, 0x1b, 0x5b, 0x37, 0x6d, 0x00, 0x1b, 0x5b, 0x37,
+	0x6d, 0x00, 0x1b, 0x5b, 0x34, 0x6d, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31,
+	0x25, 0x64, 0x58, 0x00, 0x1b, 0x28, 0x42, 0x00, 0x1b, 0x28, 0x42, 0x1b,
+	0x5b, 0x6d, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x30, 0x34, 0x39, 0x6c, 0x00,
+	0x1b, 0x5b, 0x34, 0x6c, 0x00, 0x1b, 0x5b, 0x32, 0x37, 0x6d, 0x00, 0x1b,
+	0x5b, 0x32, 0x34, 0x6d, 0x00, 0x1b, 0x5b, 0x3f, 0x35, 0x68, 0x24, 0x3c,
+	0x31, 0x30, 0x30, 0x2f, 0x3e, 0x1b, 0x5b, 0x3f, 0x35, 0x6c, 0x00, 0x07,
+	0x00, 0x1b, 0x5b, 0x4c, 0x00, 0x7f, 0x00, 0x1b, 0x5b, 0x33, 0x7e, 0x00,
+	0x1b, 0x4f, 0x42, 0x00, 0x1b, 0x4f, 0x50, 0x00, 0x1b, 0x5b, 0x32, 0x31,
+	0x7e, 0x00, 0x1b, 0x4f, 0x51, 0x00, 0x1b, 0x4f, 0x52, 0x00, 0x1b, 0x4f,
+	0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37,
+	0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x39,
+	0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x7e, 0x00, 0x1b, 0x4f, 0x48, 0x00,
+	0x1b, 0x5b, 0x32, 0x7e, 0x00, 0x1b, 0x4f, 0x44, 0x00, 0x1b, 0x5b, 0x36,
+	0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x7e, 0x00, 0x1b, 0x4f, 0x43, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x32, 0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x41,
+	0x00, 0x1b, 0x4f, 0x41, 0x00, 0x1b, 0x5b, 0x3f, 0x31, 0x6c, 0x00, 0x1b,
+	0x5b, 0x3f, 0x31, 0x68, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x50, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x4d, 0x00, 0x1b,
+	0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x42, 0x00, 0x1b, 0x5b, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x40, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x53, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x4c, 0x00, 0x1b,
+	0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x44, 0x00, 0x1b, 0x5b, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x43, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64,
+	0x54, 0x00, 0x1b, 0x5b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x41, 0x00, 0x1b,
+	0x5d, 0x1b, 0x5c, 0x1b, 0x63, 0x00, 0x1b, 0x38, 0x00, 0x1b, 0x5b, 0x25,
+	0x69, 0x25, 0x70, 0x31, 0x25, 0x64, 0x64, 0x00, 0x1b, 0x37, 0x00, 0x0a,
+	0x00, 0x1b, 0x4d, 0x00, 0x25, 0x3f, 0x25, 0x70, 0x39, 0x25, 0x74, 0x1b,
+	0x28, 0x30, 0x25, 0x65, 0x1b, 0x28, 0x42, 0x25, 0x3b, 0x1b, 0x5b, 0x30,
+	0x25, 0x3f, 0x25, 0x70, 0x36, 0x25, 0x74, 0x3b, 0x31, 0x25, 0x3b, 0x25,
+	0x3f, 0x25, 0x70, 0x32, 0x25, 0x74, 0x3b, 0x34, 0x25, 0x3b, 0x25, 0x3f,
+	0x25, 0x70, 0x31, 0x25, 0x70, 0x33, 0x25, 0x7c, 0x25, 0x74, 0x3b, 0x37,
+	0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x34, 0x25, 0x74, 0x3b, 0x35, 0x25,
+	0x3b, 0x25, 0x3f, 0x25, 0x70, 0x37, 0x25, 0x74, 0x3b, 0x38, 0x25, 0x3b,
+	0x6d, 0x00, 0x1b, 0x48, 0x00, 0x09, 0x00, 0x1b, 0x5d, 0x32, 0x3b, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x2c, 0x2c, 0x2d, 0x2d, 0x2e, 0x2e,
+	0x30, 0x30, 0x60, 0x60, 0x61, 0x61, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68,
+	0x69, 0x69, 0x6a, 0x6a, 0x6b, 0x6b, 0x6c, 0x6c, 0x6d, 0x6d, 0x6e, 0x6e,
+	0x6f, 0x6f, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74,
+	0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7a,
+	0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x00, 0x1b, 0x5b, 0x5a,
+	0x00, 0x1b, 0x5b, 0x3f, 0x37, 0x68, 0x00, 0x1b, 0x5b, 0x3f, 0x37, 0x6c,
+	0x00, 0x1b, 0x4f, 0x46, 0x00, 0x00, 0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x32,
+	0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x46, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x32, 0x48, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x32, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x32, 0x44, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x32, 0x7e,
+	0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x32, 0x43, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32,
+	0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x50, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x32, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x52, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x3b,
+	0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b, 0x32, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x38, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x39, 0x3b,
+	0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b, 0x32, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x31, 0x3b, 0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x3b,
+	0x32, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b, 0x32, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x35, 0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x51,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x52, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x35, 0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x3b, 0x35, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x37, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x39, 0x3b, 0x35, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x30, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x31, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x3b, 0x35, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x34, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36,
+	0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x51, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x36, 0x52, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x53, 0x00, 0x1b,
+	0x5b, 0x31, 0x35, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b,
+	0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x38, 0x3b, 0x36, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x39, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b,
+	0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x31, 0x3b, 0x36, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x33, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b,
+	0x36, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x50, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x33, 0x51, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x52, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x53, 0x00, 0x1b, 0x5b, 0x31, 0x35, 0x3b,
+	0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x37, 0x3b, 0x33, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x38, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x39, 0x3b,
+	0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x30, 0x3b, 0x33, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x31, 0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x33, 0x3b,
+	0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x34, 0x3b, 0x33, 0x7e, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x34, 0x50, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x51,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x52, 0x00, 0x1b, 0x5b, 0x31, 0x4b,
+	0x00, 0x1b, 0x5b, 0x33, 0x39, 0x3b, 0x34, 0x39, 0x6d, 0x00, 0x1b, 0x5d,
+	0x31, 0x30, 0x34, 0x07, 0x00, 0x1b, 0x5d, 0x34, 0x3b, 0x25, 0x70, 0x31,
+	0x25, 0x64, 0x3b, 0x72, 0x67, 0x62, 0x3a, 0x25, 0x70, 0x32, 0x25, 0x7b,
+	0x32, 0x35, 0x35, 0x7d, 0x25, 0x2a, 0x25, 0x7b, 0x31, 0x30, 0x30, 0x30,
+	0x7d, 0x25, 0x2f, 0x25, 0x32, 0x2e, 0x32, 0x58, 0x2f, 0x25, 0x70, 0x33,
+	0x25, 0x7b, 0x32, 0x35, 0x35, 0x7d, 0x25, 0x2a, 0x25, 0x7b, 0x31, 0x30,
+	0x30, 0x30, 0x7d, 0x25, 0x2f, 0x25, 0x32, 0x2e, 0x32, 0x58, 0x2f, 0x25,
+	0x70, 0x34, 0x25, 0x7b, 0x32, 0x35, 0x35, 0x7d, 0x25, 0x2a, 0x25, 0x7b,
+	0x31, 0x30, 0x30, 0x30, 0x7d, 0x25, 0x2f, 0x25, 0x32, 0x2e, 0x32, 0x58,
+	0x1b, 0x5c, 0x00, 0x1b, 0x5b, 0x33, 0x6d, 0x00, 0x1b, 0x5b, 0x32, 0x33,
+	0x6d, 0x00, 0x1b, 0x5b, 0x4d, 0x00, 0x1b, 0x5b, 0x25, 0x3f, 0x25, 0x70,
+	0x31, 0x25, 0x7b, 0x38, 0x7d, 0x25, 0x3c, 0x25, 0x74, 0x33, 0x25, 0x70,
+	0x31, 0x25, 0x64, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x31, 0x36,
+	0x7d, 0x25, 0x3c, 0x25, 0x74, 0x39, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x38,
+	0x7d, 0x25, 0x2d, 0x25, 0x64, 0x25, 0x65, 0x33, 0x38, 0x3b, 0x35, 0x3b,
+	0x25, 0x70, 0x31, 0x25, 0x64, 0x25, 0x3b, 0x6d, 0x00, 0x1b, 0x5b, 0x25,
+	0x3f, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x38, 0x7d, 0x25, 0x3c, 0x25, 0x74,
+	0x34, 0x25, 0x70, 0x31, 0x25, 0x64, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25,
+	0x7b, 0x31, 0x36, 0x7d, 0x25, 0x3c, 0x25, 0x74, 0x31, 0x30, 0x25, 0x70,
+	0x31, 0x25, 0x7b, 0x38, 0x7d, 0x25, 0x2d, 0x25, 0x64, 0x25, 0x65, 0x34,
+	0x38, 0x3b, 0x35, 0x3b, 0x25, 0x70, 0x31, 0x25, 0x64, 0x25, 0x3b, 0x6d,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x73, 0x00, 0xf3, 0x02,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x15, 0x00,
+	0x1c, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x38, 0x00, 0x3f, 0x00,
+	0x46, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x69, 0x00,
+	0x70, 0x00, 0x77, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x8c, 0x00, 0x93, 0x00,
+	0x9a, 0x00, 0xa1, 0x00, 0xa8, 0x00, 0xaf, 0x00, 0xb6, 0x00, 0xbd, 0x00,
+	0xc4, 0x00, 0xcb, 0x00, 0xd2, 0x00, 0xd9, 0x00, 0xe0, 0x00, 0xe7, 0x00,
+	0xee, 0x00, 0xf5, 0x00, 0xfc, 0x00, 0x03, 0x01, 0x0a, 0x01, 0x11, 0x01,
+	0x18, 0x01, 0x1f, 0x01, 0x26, 0x01, 0x2d, 0x01, 0x34, 0x01, 0x3b, 0x01,
+	0x42, 0x01, 0x49, 0x01, 0x50, 0x01, 0x57, 0x01, 0x5e, 0x01, 0x65, 0x01,
+	0x6c, 0x01, 0x72, 0x01, 0x8c, 0x01, 0xa6, 0x01, 0x00, 0x00, 0x03, 0x00,
+	0x06, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00,
+	0x27, 0x00, 0x2b, 0x00, 0x30, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x3f, 0x00,
+	0x44, 0x00, 0x4a, 0x00, 0x50, 0x00, 0x56, 0x00, 0x5c, 0x00, 0x62, 0x00,
+	0x68, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x7a, 0x00, 0x80, 0x00, 0x85, 0x00,
+	0x8a, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x99, 0x00, 0x9f, 0x00, 0xa5, 0x00,
+	0xab, 0x00, 0xb1, 0x00, 0xb7, 0x00, 0xbd, 0x00, 0xc3, 0x00, 0xc9, 0x00,
+	0xcf, 0x00, 0xd5, 0x00, 0xdb, 0x00, 0xe1, 0x00, 0xe7, 0x00, 0xed, 0x00,
+	0xf3, 0x00, 0xf9, 0x00, 0xff, 0x00, 0x05, 0x01, 0x0b, 0x01, 0x11, 0x01,
+	0x15, 0x01, 0x1a, 0x01, 0x1f, 0x01, 0x24, 0x01, 0x29, 0x01, 0x2e, 0x01,
+	0x33, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x1b, 0x5b, 0x33, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x33, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b,
+	0x33, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x42, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34,
+	0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x42, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x36, 0x42, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x42, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x33, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x46,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x36, 0x46, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x46, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x33, 0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x48, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36,
+	0x48, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x48, 0x00, 0x1b, 0x5b, 0x32,
+	0x3b, 0x33, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x34, 0x7e, 0x00, 0x1b,
+	0x5b, 0x32, 0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x36, 0x7e,
+	0x00, 0x1b, 0x5b, 0x32, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x33, 0x44, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x44, 0x00, 0x1b, 0x5b,
+	0x31, 0x3b, 0x35, 0x44, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x44, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x44, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x33,
+	0x7e, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x36,
+	0x3b, 0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x36, 0x3b, 0x36, 0x7e, 0x00, 0x1b,
+	0x5b, 0x36, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x33, 0x7e,
+	0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x34, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b,
+	0x35, 0x7e, 0x00, 0x1b, 0x5b, 0x35, 0x3b, 0x36, 0x7e, 0x00, 0x1b, 0x5b,
+	0x35, 0x3b, 0x37, 0x7e, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x33, 0x43, 0x00,
+	0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35,
+	0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x36, 0x43, 0x00, 0x1b, 0x5b, 0x31,
+	0x3b, 0x37, 0x43, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x32, 0x41, 0x00, 0x1b,
+	0x5b, 0x31, 0x3b, 0x33, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x34, 0x41,
+	0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b,
+	0x36, 0x41, 0x00, 0x1b, 0x5b, 0x31, 0x3b, 0x37, 0x41, 0x00, 0x1b, 0x5b,
+	0x32, 0x39, 0x6d, 0x00, 0x1b, 0x5b, 0x34, 0x38, 0x3a, 0x32, 0x3a, 0x25,
+	0x70, 0x31, 0x25, 0x64, 0x3a, 0x25, 0x70, 0x32, 0x25, 0x64, 0x3a, 0x25,
+	0x70, 0x33, 0x25, 0x64, 0x6d, 0x00, 0x1b, 0x5b, 0x33, 0x38, 0x3a, 0x32,
+	0x3a, 0x25, 0x70, 0x31, 0x25, 0x64, 0x3a, 0x25, 0x70, 0x32, 0x25, 0x64,
+	0x3a, 0x25, 0x70, 0x33, 0x25, 0x64, 0x6d, 0x00, 0x1b, 0x5b, 0x39, 0x6d,
+	0x00, 0x53, 0x75, 0x00, 0x54, 0x63, 0x00, 0x66, 0x75, 0x6c, 0x6c, 0x6b,
+	0x62, 0x64, 0x00, 0x6b, 0x44, 0x43, 0x33, 0x00, 0x6b, 0x44, 0x43, 0x34,
+	0x00, 0x6b, 0x44, 0x43, 0x35, 0x00, 0x6b, 0x44, 0x43, 0x36, 0x00, 0x6b,
+	0x44, 0x43, 0x37, 0x00, 0x6b, 0x44, 0x4e, 0x00, 0x6b, 0x44, 0x4e, 0x33,
+	0x00, 0x6b, 0x44, 0x4e, 0x34, 0x00, 0x6b, 0x44, 0x4e, 0x35, 0x00, 0x6b,
+	0x44, 0x4e, 0x36, 0x00, 0x6b, 0x44, 0x4e, 0x37, 0x00, 0x6b, 0x45, 0x4e,
+	0x44, 0x33, 0x00, 0x6b, 0x45, 0x4e, 0x44, 0x34, 0x00, 0x6b, 0x45, 0x4e,
+	0x44, 0x35, 0x00, 0x6b, 0x45, 0x4e, 0x44, 0x36, 0x00, 0x6b, 0x45, 0x4e,
+	0x44, 0x37, 0x00, 0x6b, 0x48, 0x4f, 0x4d, 0x33, 0x00, 0x6b, 0x48, 0x4f,
+	0x4d, 0x34, 0x00, 0x6b, 0x48, 0x4f, 0x4d, 0x35, 0x00, 0x6b, 0x48, 0x4f,
+	0x4d, 0x36, 0x00, 0x6b, 0x48, 0x4f, 0x4d, 0x37, 0x00, 0x6b, 0x49, 0x43,
+	0x33, 0x00, 0x6b, 0x49, 0x43, 0x34, 0x00, 0x6b, 0x49, 0x43, 0x35, 0x00,
+	0x6b, 0x49, 0x43, 0x36, 0x00, 0x6b, 0x49, 0x43, 0x37, 0x00, 0x6b, 0x4c,
+	0x46, 0x54, 0x33, 0x00, 0x6b, 0x4c, 0x46, 0x54, 0x34, 0x00, 0x6b, 0x4c,
+	0x46, 0x54, 0x35, 0x00, 0x6b, 0x4c, 0x46, 0x54, 0x36, 0x00, 0x6b, 0x4c,
+	0x46, 0x54, 0x37, 0x00, 0x6b, 0x4e, 0x58, 0x54, 0x33, 0x00, 0x6b, 0x4e,
+	0x58, 0x54, 0x34, 0x00, 0x6b, 0x4e, 0x58, 0x54, 0x35, 0x00, 0x6b, 0x4e,
+	0x58, 0x54, 0x36, 0x00, 0x6b, 0x4e, 0x58, 0x54, 0x37, 0x00, 0x6b, 0x50,
+	0x52, 0x56, 0x33, 0x00, 0x6b, 0x50, 0x52, 0x56, 0x34, 0x00, 0x6b, 0x50,
+	0x52, 0x56, 0x35, 0x00, 0x6b, 0x50, 0x52, 0x56, 0x36, 0x00, 0x6b, 0x50,
+	0x52, 0x56, 0x37, 0x00, 0x6b, 0x52, 0x49, 0x54, 0x33, 0x00, 0x6b, 0x52,
+	0x49, 0x54, 0x34, 0x00, 0x6b, 0x52, 0x49, 0x54, 0x35, 0x00, 0x6b, 0x52,
+	0x49, 0x54, 0x36, 0x00, 0x6b, 0x52, 0x49, 0x54, 0x37, 0x00, 0x6b, 0x55,
+	0x50, 0x00, 0x6b, 0x55, 0x50, 0x33, 0x00, 0x6b, 0x55, 0x50, 0x34, 0x00,
+	0x6b, 0x55, 0x50, 0x35, 0x00, 0x6b, 0x55, 0x50, 0x36, 0x00, 0x6b, 0x55,
+	0x50, 0x37, 0x00, 0x72, 0x6d, 0x78, 0x78, 0x00, 0x73, 0x65, 0x74, 0x72,
+	0x67, 0x62, 0x62, 0x00, 0x73, 0x65, 0x74, 0x72, 0x67, 0x62, 0x66, 0x00,
+	0x73, 0x6d, 0x78, 0x78, 0x00,
+};
+static const int32_t ti_bi2_nums[] = {
+	80, 8, 24, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 256, 32767,
+};
+static char * const ti_bi2_strs[] = {
+	TI_BI_STR(2, 814),
+	TI_BI_STR(2, 818),
+	TI_BI_STR(2, 820),
+	TI_BI_STR(2, 822),
+	TI_BI_STR(2, 839),
+	TI_BI_STR(2, 844),
+	TI_BI_STR(2, 852),
+	TI_BI_STR(2, 856),
+	TI_BI_STR(2, 860),
+	NULL,
+	TI_BI_STR(2, 871),
+	TI_BI_STR(2, 888),
+	TI_BI_STR(2, 890),
+	TI_BI_STR(2, 894),
+	TI_BI_STR(2, 901),
+	NULL,
+	TI_BI_STR(2, 903),
+	TI_BI_STR(2, 916),
+	NULL,
+	TI_BI_STR(2, 920),
+	TI_BI_STR(2, 924),
+	TI_BI_STR(2, 934),
+	TI_BI_STR(2, 938),
+	TI_BI_STR(2, 942),
+	NULL,
+	TI_BI_STR(2, 948),
+	NULL,
+	TI_BI_STR(2, 952),
+	TI_BI_STR(2, 957),
+	NULL,
+	TI_BI_STR(2, 966),
+	TI_BI_STR(2, 971),
+	NULL,
+	NULL,
+	TI_BI_STR(2, 976),
+	TI_BI_STR(2, 981),
+	TI_BI_STR(2, 986),
+	TI_BI_STR(2, 991),
+	TI_BI_STR(2, 1000),
+	TI_BI_STR(2, 1004),
+	TI_BI_STR(2, 1011),
+	NULL,
+	TI_BI_STR(2, 1020),
+	TI_BI_STR(2, 1025),
+	TI_BI_STR(2, 1031),
+	TI_BI_STR(2, 1037),
+	NULL,
+	TI_BI_STR(2, 1055),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1057),
+	NULL,
+	TI_BI_STR(2, 1061),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1063),
+	NULL,
+	TI_BI_STR(2, 1068),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1072),
+	TI_BI_STR(2, 1076),
+	TI_BI_STR(2, 1082),
+	TI_BI_STR(2, 1086),
+	TI_BI_STR(2, 1090),
+	TI_BI_STR(2, 1094),
+	TI_BI_STR(2, 1100),
+	TI_BI_STR(2, 1106),
+	TI_BI_STR(2, 1112),
+	TI_BI_STR(2, 1118),
+	TI_BI_STR(2, 1124),
+	TI_BI_STR(2, 1128),
+	NULL,
+	TI_BI_STR(2, 1133),
+	NULL,
+	TI_BI_STR(2, 1137),
+	TI_BI_STR(2, 1142),
+	TI_BI_STR(2, 1147),
+	TI_BI_STR(2, 1151),
+	TI_BI_STR(2, 1158),
+	NULL,
+	TI_BI_STR(2, 1165),
+	TI_BI_STR(2, 1169),
+	TI_BI_STR(2, 1175),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1181),
+	TI_BI_STR(2, 1190),
+	TI_BI_STR(2, 1199),
+	TI_BI_STR(2, 1208),
+	TI_BI_STR(2, 1217),
+	TI_BI_STR(2, 1226),
+	TI_BI_STR(2, 1235),
+	TI_BI_STR(2, 1244),
+	TI_BI_STR(2, 1253),
+	TI_BI_STR(2, 1262),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1271),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1278),
+	TI_BI_STR(2, 1281),
+	TI_BI_STR(2, 1292),
+	TI_BI_STR(2, 1295),
+	TI_BI_STR(2, 1297),
+	TI_BI_STR(2, 1300),
+	TI_BI_STR(2, 1382),
+	NULL,
+	TI_BI_STR(2, 1385),
+	TI_BI_STR(2, 1387),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1392),
+	TI_BI_STR(2, 1393),
+	NULL,
+	TI_BI_STR(2, 1394),
+	TI_BI_STR(2, 1395),
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1396),
+	NULL,
+	TI_BI_STR(2, 1461),
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1465),
+	TI_BI_STR(2, 1471),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1477),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1481),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1482),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1483),
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1490),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1497),
+	TI_BI_STR(2, 1504),
+	TI_BI_STR(2, 1511),
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1518),
+	NULL,
+	TI_BI_STR(2, 1525),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1532),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1539),
+	TI_BI_STR(2, 1545),
+	TI_BI_STR(2, 1551),
+	TI_BI_STR(2, 1558),
+	TI_BI_STR(2, 1565),
+	TI_BI_STR(2, 1572),
+	TI_BI_STR(2, 1579),
+	TI_BI_STR(2, 1587),
+	TI_BI_STR(2, 1595),
+	TI_BI_STR(2, 1603),
+	TI_BI_STR(2, 1611),
+	TI_BI_STR(2, 1619),
+	TI_BI_STR(2, 1627),
+	TI_BI_STR(2, 1635),
+	TI_BI_STR(2, 1643),
+	TI_BI_STR(2, 1650),
+	TI_BI_STR(2, 1657),
+	TI_BI_STR(2, 1664),
+	TI_BI_STR(2, 1671),
+	TI_BI_STR(2, 1679),
+	TI_BI_STR(2, 1687),
+	TI_BI_STR(2, 1695),
+	TI_BI_STR(2, 1703),
+	TI_BI_STR(2, 1711),
+	TI_BI_STR(2, 1719),
+	TI_BI_STR(2, 1727),
+	TI_BI_STR(2, 1735),
+	TI_BI_STR(2, 1742),
+	TI_BI_STR(2, 1749),
+	TI_BI_STR(2, 1756),
+	TI_BI_STR(2, 1763),
+	TI_BI_STR(2, 1771),
+	TI_BI_STR(2, 1779),
+	TI_BI_STR(2, 1787),
+	TI_BI_STR(2, 1795),
+	TI_BI_STR(2, 1803),
+	TI_BI_STR(2, 1811),
+	TI_BI_STR(2, 1819),
+	TI_BI_STR(2, 1827),
+	TI_BI_STR(2, 1834),
+	TI_BI_STR(2, 1841),
+	TI_BI_STR(2, 1848),
+	TI_BI_STR(2, 1855),
+	TI_BI_STR(2, 1863),
+	TI_BI_STR(2, 1871),
+	TI_BI_STR(2, 1879),
+	TI_BI_STR(2, 1887),
+	TI_BI_STR(2, 1895),
+	TI_BI_STR(2, 1903),
+	TI_BI_STR(2, 1911),
+	TI_BI_STR(2, 1919),
+	TI_BI_STR(2, 1926),
+	TI_BI_STR(2, 1933),
+	TI_BI_STR(2, 1940),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 1945),
+	TI_BI_STR(2, 1954),
+	TI_BI_STR(2, 1961),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 2055),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 2060),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 2066),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(2, 2070),
+	TI_BI_STR(2, 2133),
+};
+static char * const ti_bi2_ext_strs[] = {
+	TI_BI_STR(2, 2442),
+	TI_BI_STR(2, 2449),
+	TI_BI_STR(2, 2456),
+	TI_BI_STR(2, 2463),
+	TI_BI_STR(2, 2470),
+	TI_BI_STR(2, 2477),
+	TI_BI_STR(2, 2484),
+	TI_BI_STR(2, 2491),
+	TI_BI_STR(2, 2498),
+	TI_BI_STR(2, 2505),
+	TI_BI_STR(2, 2512),
+	TI_BI_STR(2, 2519),
+	TI_BI_STR(2, 2526),
+	TI_BI_STR(2, 2533),
+	TI_BI_STR(2, 2540),
+	TI_BI_STR(2, 2547),
+	TI_BI_STR(2, 2554),
+	TI_BI_STR(2, 2561),
+	TI_BI_STR(2, 2568),
+	TI_BI_STR(2, 2575),
+	TI_BI_STR(2, 2582),
+	TI_BI_STR(2, 2589),
+	TI_BI_STR(2, 2596),
+	TI_BI_STR(2, 2603),
+	TI_BI_STR(2, 2610),
+	TI_BI_STR(2, 2617),
+	TI_BI_STR(2, 2624),
+	TI_BI_STR(2, 2631),
+	TI_BI_STR(2, 2638),
+	TI_BI_STR(2, 2645),
+	TI_BI_STR(2, 2652),
+	TI_BI_STR(2, 2659),
+	TI_BI_STR(2, 2666),
+	TI_BI_STR(2, 2673),
+	TI_BI_STR(2, 2680),
+	TI_BI_STR(2, 2687),
+	TI_BI_STR(2, 2694),
+	TI_BI_STR(2, 2701),
+	TI_BI_STR(2, 2708),
+	TI_BI_STR(2, 2715),
+	TI_BI_STR(2, 2722),
+	TI_BI_STR(2, 2729),
+	TI_BI_STR(2, 2736),
+	TI_BI_STR(2, 2743),
+	TI_BI_STR(2, 2750),
+	TI_BI_STR(2, 2757),
+	TI_BI_STR(2, 2764),
+	TI_BI_STR(2, 2771),
+	TI_BI_STR(2, 2778),
+	TI_BI_STR(2, 2785),
+	TI_BI_STR(2, 2792),
+	TI_BI_STR(2, 2799),
+	TI_BI_STR(2, 2806),
+	TI_BI_STR(2, 2812),
+	TI_BI_STR(2, 2838),
+	TI_BI_STR(2, 2864),
+};
+static char * const ti_bi2_ext_names[] = {
+	TI_BI_STR(2, 2869),
+	TI_BI_STR(2, 2872),
+	TI_BI_STR(2, 2875),
+	TI_BI_STR(2, 2883),
+	TI_BI_STR(2, 2888),
+	TI_BI_STR(2, 2893),
+	TI_BI_STR(2, 2898),
+	TI_BI_STR(2, 2903),
+	TI_BI_STR(2, 2908),
+	TI_BI_STR(2, 2912),
+	TI_BI_STR(2, 2917),
+	TI_BI_STR(2, 2922),
+	TI_BI_STR(2, 2927),
+	TI_BI_STR(2, 2932),
+	TI_BI_STR(2, 2937),
+	TI_BI_STR(2, 2943),
+	TI_BI_STR(2, 2949),
+	TI_BI_STR(2, 2955),
+	TI_BI_STR(2, 2961),
+	TI_BI_STR(2, 2967),
+	TI_BI_STR(2, 2973),
+	TI_BI_STR(2, 2979),
+	TI_BI_STR(2, 2985),
+	TI_BI_STR(2, 2991),
+	TI_BI_STR(2, 2997),
+	TI_BI_STR(2, 3002),
+	TI_BI_STR(2, 3007),
+	TI_BI_STR(2, 3012),
+	TI_BI_STR(2, 3017),
+	TI_BI_STR(2, 3022),
+	TI_BI_STR(2, 3028),
+	TI_BI_STR(2, 3034),
+	TI_BI_STR(2, 3040),
+	TI_BI_STR(2, 3046),
+	TI_BI_STR(2, 3052),
+	TI_BI_STR(2, 3058),
+	TI_BI_STR(2, 3064),
+	TI_BI_STR(2, 3070),
+	TI_BI_STR(2, 3076),
+	TI_BI_STR(2, 3082),
+	TI_BI_STR(2, 3088),
+	TI_BI_STR(2, 3094),
+	TI_BI_STR(2, 3100),
+	TI_BI_STR(2, 3106),
+	TI_BI_STR(2, 3112),
+	TI_BI_STR(2, 3118),
+	TI_BI_STR(2, 3124),
+	TI_BI_STR(2, 3130),
+	TI_BI_STR(2, 3136),
+	TI_BI_STR(2, 3142),
+	TI_BI_STR(2, 3146),
+	TI_BI_STR(2, 3151),
+	TI_BI_STR(2, 3156),
+	TI_BI_STR(2, 3161),
+	TI_BI_STR(2, 3166),
+	TI_BI_STR(2, 3171),
+	TI_BI_STR(2, 3176),
+	TI_BI_STR(2, 3184),
+	TI_BI_STR(2, 3192),
+};
+static const uint16_t ti_bi2_ext_hash[] = {
+	0, 14, 27, 3, 36, 44, 0, 7, 0, 52,
+	0, 0, 15, 0, 0, 0, 0, 30, 21, 0,
+	0, 0, 41, 37, 57, 0, 6, 0, 51, 0,
+	0, 0, 0, 0, 45, 0, 31, 22, 59, 25,
+	4, 42, 38, 0, 9, 5, 0, 0, 47, 0,
+	0, 20, 0, 0, 0, 32, 0, 0, 0, 0,
+	0, 39, 0, 0, 19, 0, 0, 46, 0, 0,
+	0, 50, 11, 28, 33, 0, 0, 10, 0, 40,
+	55, 0, 0, 18, 0, 0, 49, 0, 56, 0,
+	0, 12, 29, 34, 0, 0, 2, 0, 0, 54,
+	58, 0, 17, 0, 0, 48, 0, 0, 23, 0,
+	13, 26, 43, 35, 0, 0, 8, 1, 53, 0,
+	0, 16, 0, 0, 0, 0, 0, 24,
+};
+static const ti_terminfo ti_bi2 = {
+	.term_names      = TI_BI_STR(2, 12),
+	.bools           = (int8_t *)TI_BI_STR(2, 33),
+	.nums            = (int32_t *)ti_bi2_nums,
+	.strs            = (char **)ti_bi2_strs,
+	.bools_count     = 28,
+	.nums_count      = 15,
+	.strs_count      = 361,
+	.ext_bools       = (int8_t *)TI_BI_STR(2, 2208),
+	.ext_strs        = (char **)ti_bi2_ext_strs,
+	.ext_bool_names  = (char **)ti_bi2_ext_names,
+	.ext_num_names   = (char **)ti_bi2_ext_names + 3,
+	.ext_str_names   = (char **)ti_bi2_ext_names + 3,
+	.ext_bools_count = 3,
+	.ext_nums_count  = 0,
+	.ext_strs_count  = 56,
+	.ext_names       = (char **)ti_bi2_ext_names,
+	.ext_names_count = 59,
+	.ext_hash        = (uint16_t *)ti_bi2_ext_hash,
+	.ext_hash_mask   = 127,
+	.data            = (char *)ti_bi2_data,
+	.len             = 3197,
+	.numsz           = 2,
+	.flags           = TI_F_STATIC,
+};
+
+// minitel1|minitel 1
+static const char ti_bi3_data[] = {
+	0x1a, 0x01, 0x13, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x69, 0x01, 0xb2, 0x01,
+	0x6d, 0x69, 0x6e, 0x69, 0x74, 0x65, 0x6c, 0x31, 0x7c, 0x6d, 0x69, 0x6e,
+	0x69, 0x74, 0x65, 0x6c, 0x20, 0x31, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x28, 0x00, 0xff, 0xff, 0x18, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x08, 0x00, 0xff, 0xff, 0x00, 0x00,
+	0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x06, 0x00, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x20, 0x00, 0x22, 0x00, 0x24, 0x00,
+	0x26, 0x00, 0xff, 0xff, 0x28, 0x00, 0x2a, 0x00, 0xff, 0xff, 0x2c, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x34, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x37, 0x00, 0x3a, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x3d, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00,
+	0xff, 0xff, 0x47, 0x00, 0xff, 0xff, 0x56, 0x00, 0xff, 0xff, 0x58, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x6a, 0x00, 0x6d, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00,
+	0xff, 0xff, 0x85, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xbb, 0x00, 0xbd, 0x00, 0xbf, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xe1, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xef, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0x0a, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x0d, 0x01, 0x10, 0x01, 0xff, 0xff, 0xff, 0xff, 0x13, 0x01, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x01, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x01, 0x2b, 0x01, 0x2e, 0x01,
+	0x51, 0x01, 0x55, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x58, 0x01, 0xa1, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x01, 0xb0, 0x01, 0x07, 0x00,
+	0x0d, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x1f, 0x25, 0x70, 0x31, 0x25, 0x27,
+	0x41, 0x27, 0x25, 0x2b, 0x25, 0x63, 0x25, 0x70, 0x32, 0x25, 0x27, 0x41,
+	0x27, 0x25, 0x2b, 0x25, 0x63, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x14, 0x00,
+	0x08, 0x00, 0x11, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x41, 0x18,
+	0x0a, 0x00, 0x1b, 0x48, 0x00, 0x1b, 0x5d, 0x00, 0x1b, 0x5d, 0x00, 0x1b,
+	0x49, 0x1b, 0x5c, 0x1b, 0x47, 0x00, 0x1b, 0x5c, 0x00, 0x1f, 0x40, 0x41,
+	0x1b, 0x57, 0x20, 0x7f, 0x12, 0x7f, 0x12, 0x50, 0x0d, 0x18, 0x0a, 0x00,
+	0x0a, 0x00, 0x1b, 0x3b, 0x60, 0x5a, 0x51, 0x1b, 0x3a, 0x69, 0x43, 0x1b,
+	0x3a, 0x69, 0x45, 0x11, 0x00, 0x13, 0x47, 0x00, 0x13, 0x48, 0x00, 0x13,
+	0x42, 0x00, 0x0d, 0x0a, 0x00, 0x25, 0x70, 0x31, 0x25, 0x63, 0x12, 0x25,
+	0x70, 0x32, 0x25, 0x27, 0x3f, 0x27, 0x25, 0x2b, 0x25, 0x63, 0x00, 0x14,
+	0x1f, 0x58, 0x41, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18,
+	0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18,
+	0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18,
+	0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18, 0x0a, 0x18,
+	0x0a, 0x18, 0x0c, 0x11, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x25, 0x3f, 0x25,
+	0x70, 0x31, 0x25, 0x74, 0x1b, 0x5d, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70,
+	0x33, 0x25, 0x74, 0x1b, 0x5d, 0x25, 0x3b, 0x25, 0x3f, 0x25, 0x70, 0x34,
+	0x25, 0x74, 0x1b, 0x48, 0x25, 0x3b, 0x00, 0x1f, 0x40, 0x25, 0x70, 0x31,
+	0x25, 0x27, 0x41, 0x27, 0x25, 0x2b, 0x25, 0x63, 0x00, 0x6a, 0x2b, 0x6b,
+	0x2b, 0x6c, 0x2b, 0x6d, 0x2b, 0x6e, 0x2b, 0x6f, 0x7e, 0x71, 0x60, 0x73,
+	0x5f, 0x74, 0x2b, 0x75, 0x2b, 0x76, 0x2b, 0x77, 0x2b, 0x78, 0x7c, 0x00,
+	0x13, 0x45, 0x00, 0x13, 0x49, 0x00, 0x13, 0x41, 0x00, 0x13, 0x44, 0x00,
+	0x13, 0x43, 0x00, 0x1f, 0x25, 0x63, 0x25, 0x27, 0x41, 0x27, 0x25, 0x2d,
+	0x25, 0x63, 0x25, 0x27, 0x41, 0x27, 0x25, 0x2d, 0x00, 0x1b, 0x61, 0x00,
+	0x01, 0x25, 0x5b, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+	0x4b, 0x4c, 0x62, 0x63, 0x72, 0x65, 0x73, 0x64, 0x66, 0x67, 0x30, 0x31,
+	0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5d, 0x04, 0x00, 0x1b,
+	0x39, 0x7b, 0x00, 0x1b, 0x47, 0x00, 0x1b, 0x25, 0x3f, 0x25, 0x70, 0x31,
+	0x25, 0x7b, 0x31, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x44, 0x25, 0x65, 0x25,
+	0x70, 0x31, 0x25, 0x7b, 0x33, 0x7d, 0x25, 0x3d, 0x25, 0x74, 0x46, 0x25,
+	0x65, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x34, 0x7d, 0x25, 0x3d, 0x25, 0x74,
+	0x41, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x7b, 0x36, 0x7d, 0x25, 0x3d,
+	0x25, 0x74, 0x43, 0x25, 0x65, 0x25, 0x70, 0x31, 0x25, 0x27, 0x40, 0x27,
+	0x25, 0x2b, 0x25, 0x63, 0x25, 0x3b, 0x00, 0x80, 0x00, 0x1b, 0x25, 0x70,
+	0x31, 0x25, 0x27, 0x40, 0x27, 0x25, 0x2b, 0x25, 0x63, 0x00, 0x80, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09, 0x00, 0x9b, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x29, 0x00, 0x2b, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x06, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x60, 0x3e, 0x61, 0x39, 0x66, 0x21,
+	0x6a, 0x25, 0x6b, 0x34, 0x6c, 0x3c, 0x6d, 0x2d, 0x6e, 0x3d, 0x70, 0x23,
+	0x71, 0x2c, 0x72, 0x70, 0x74, 0x3d, 0x75, 0x35, 0x76, 0x2d, 0x77, 0x3c,
+	0x78, 0x35, 0x79, 0x76, 0x7a, 0x79, 0x7c, 0x6c, 0x7e, 0x24, 0x00, 0x0f,
+	0x00, 0x0e, 0x00, 0x42, 0x19, 0x25, 0x2c, 0xa1, 0x21, 0x2c, 0xa2, 0x22,
+	0x2c, 0xa3, 0x23, 0x2c, 0xa4, 0x24, 0x2c, 0xa5, 0x25, 0x2c, 0xa6, 0x26,
+	0x2c, 0xa7, 0x27, 0x2c, 0xa8, 0x28, 0x2c, 0xab, 0x2b, 0x2c, 0xaf, 0x50,
+	0x2c, 0xb0, 0x30, 0x2c, 0xb1, 0x31, 0x2c, 0xb2, 0x32, 0x2c, 0xb3, 0x33,
+	0x2c, 0xb5, 0x35, 0x2c, 0xb7, 0x37, 0x2c, 0xba, 0x6b, 0x2c, 0xbb, 0x3b,
+	0x2c, 0xbc, 0x3c, 0x2c, 0xbd, 0x3d, 0x2c, 0xbe, 0x3e, 0x2c, 0xbf, 0x3f,
+	0x2c, 0xc0, 0x41, 0x41, 0x2c, 0xc1, 0x42, 0x41, 0x2c, 0xc2, 0x43, 0x41,
+	0x2c, 0xc3, 0x44, 0x41, 0x2c, 0xc4, 0x48, 0x41, 0x2c, 0xc5, 0x4a, 0x41,
+	0x2c, 0xc6, 0x61, 0x2c, 0xc7, 0x4b, 0x43, 0x2c, 0xc8, 0x41, 0x45, 0x2c,
+	0xc9, 0x42, 0x45, 0x2c, 0xca, 0x43, 0x45, 0x2c, 0xcb, 0x48, 0x45, 0x2c,
+	0xcc, 0x41, 0x49, 0x2c, 0xcd, 0x42, 0x49, 0x2c, 0xce, 0x43, 0x49, 0x2c,
+	0xcf, 0x48, 0x49, 0x2c, 0xd0, 0x62, 0x2c, 0xd1, 0x44, 0x4e, 0x2c, 0xd2,
+	0x41, 0x4f, 0x2c, 0xd3, 0x42, 0x4f, 0x2c, 0xd4, 0x43, 0x4f, 0x2c, 0xd5,
+	0x44, 0x4f, 0x2c, 0xd6, 0x48, 0x4f, 0x2c, 0xd7, 0x34, 0x2c, 0xd8, 0x69,
+	0x2c, 0xd9, 0x41, 0x55, 0x2c, 0xda, 0x42, 0x55, 0x2c, 0xdb, 0x43, 0x55,
+	0x2c, 0xdc, 0x48, 0x55, 0x2c, 0xdd, 0x42, 0x59, 0x2c, 0xde, 0x6c, 0x2c,
+	0xdf, 0x7b, 0x2c, 0xe0, 0x41, 0x61, 0x2c, 0xe1, 0x42, 0x61, 0x2c, 0xe2,
+	0x43, 0x61, 0x2c, 0xe3, 0x44, 0x61, 0x2c, 0xe4, 0x48, 0x61, 0x2c, 0xe5,
+	0x4a, 0x61, 0x2c, 0xe6, 0x71, 0x2c, 0xe7, 0x4b, 0x63, 0x2c, 0xe8, 0x41,
+	0x65, 0x2c, 0xe9, 0x42, 0x65, 0x2c, 0xea, 0x43, 0x65, 0x2c, 0xeb, 0x48,
+	0x65, 0x2c, 0xec, 0x41, 0x69, 0x2c, 0xed, 0x42, 0x69, 0x2c, 0xee, 0x43,
+	0x69, 0x2c, 0xef, 0x48, 0x69, 0x2c, 0xf0, 0x72, 0x2c, 0xf1, 0x44, 0x6e,
+	0x2c, 0xf2, 0x41, 0x6f, 0x2c, 0xf3, 0x42, 0x6f, 0x2c, 0xf4, 0x43, 0x6f,
+	0x2c, 0xf5, 0x44, 0x6f, 0x2c, 0xf6, 0x48, 0x6f, 0x2c, 0xf7, 0x38, 0x2c,
+	0xf8, 0x79, 0x2c, 0xf9, 0x41, 0x75, 0x2c, 0xfa, 0x42, 0x75, 0x2c, 0xfb,
+	0x43, 0x75, 0x2c, 0xfc, 0x48, 0x75, 0x2c, 0xfd, 0x42, 0x79, 0x2c, 0xfe,
+	0x7c, 0x2c, 0xff, 0x48, 0x79, 0x2c, 0xaa, 0x63, 0x2c, 0x2c, 0x30, 0x0f,
+	0x19, 0x25, 0x0e, 0x2c, 0x7d, 0x23, 0x2c, 0x66, 0x30, 0x2c, 0x67, 0x31,
+	0x2c, 0x5c, 0x2c, 0x5c, 0x2c, 0x2c, 0x2b, 0x2e, 0x2c, 0x2e, 0x2f, 0x2c,
+	0x30, 0x7f, 0x2c, 0x2d, 0x2d, 0x00, 0x47, 0x30, 0x00, 0x43, 0x30, 0x00,
+	0x45, 0x30, 0x00, 0x53, 0x30, 0x00, 0x58, 0x43, 0x00,
+};
+static const int32_t ti_bi3_nums[] = {
+	40, -1, 24, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8, 8,
+};
+static char * const ti_bi3_strs[] = {
+	NULL,
+	TI_BI_STR(3, 802),
+	TI_BI_STR(3, 804),
+	NULL,
+	NULL,
+	TI_BI_STR(3, 806),
+	TI_BI_STR(3, 808),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 810),
+	TI_BI_STR(3, 834),
+	TI_BI_STR(3, 836),
+	TI_BI_STR(3, 838),
+	TI_BI_STR(3, 840),
+	NULL,
+	TI_BI_STR(3, 842),
+	TI_BI_STR(3, 844),
+	NULL,
+	TI_BI_STR(3, 846),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 848),
+	NULL,
+	NULL,
+	TI_BI_STR(3, 854),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 857),
+	TI_BI_STR(3, 860),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 863),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 870),
+	NULL,
+	TI_BI_STR(3, 873),
+	NULL,
+	TI_BI_STR(3, 888),
+	NULL,
+	TI_BI_STR(3, 890),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 905),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 908),
+	TI_BI_STR(3, 911),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 914),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 917),
+	NULL,
+	TI_BI_STR(3, 935),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 989),
+	TI_BI_STR(3, 991),
+	TI_BI_STR(3, 993),
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1027),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1041),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1068),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1071),
+	TI_BI_STR(3, 1074),
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1077),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1080),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1083),
+	TI_BI_STR(3, 1101),
+	TI_BI_STR(3, 1104),
+	TI_BI_STR(3, 1139),
+	TI_BI_STR(3, 1143),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1146),
+	TI_BI_STR(3, 1219),
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	TI_BI_STR(3, 1221),
+	TI_BI_STR(3, 1234),
+};
+static char * const ti_bi3_ext_strs[] = {
+	TI_BI_STR(3, 1266),
+	TI_BI_STR(3, 1307),
+	TI_BI_STR(3, 1309),
+	TI_BI_STR(3, 1311),
+};
+static char * const ti_bi3_ext_names[] = {
+	TI_BI_STR(3, 1662),
+	TI_BI_STR(3, 1665),
+	TI_BI_STR(3, 1668),
+	TI_BI_STR(3, 1671),
+	TI_BI_STR(3, 1674),
+};
+static const uint16_t ti_bi3_ext_hash[] = {
+	3, 0, 1, 0, 0, 0, 2, 4, 0, 0,
+	0, 0, 5, 0, 0, 0,
+};
+static const ti_terminfo ti_bi3 = {
+	.term_names      = TI_BI_STR(3, 12),
+	.bools           = (int8_t *)TI_BI_STR(3, 31),
+	.nums            = (int32_t *)ti_bi3_nums,
+	.strs            = (char **)ti_bi3_strs,
+	.bools_count     = 19,
+	.nums_count      = 15,
+	.strs_count      = 361,
+	.ext_bools       = (int8_t *)TI_BI_STR(3, 1246),
+	.ext_strs        = (char **)ti_bi3_ext_strs,
+	.ext_bool_names  = (char **)ti_bi3_ext_names,
+	.ext_num_names   = (char **)ti_bi3_ext_names + 1,
+	.ext_str_names   = (char **)ti_bi3_ext_names + 1,
+	.ext_bools_count = 1,
+	.ext_nums_count  = 0,
+	.ext_strs_count  = 4,
+	.ext_names       = (char **)ti_bi3_ext_names,
+	.ext_names_count = 5,
+	.ext_hash        = (uint16_t *)ti_bi3_ext_hash,
+	.ext_hash_mask   = 15,
+	.data            = (char *)ti_bi3_data,
+	.len             = 1677,
+	.numsz           = 2,
+	.flags           = TI_F_STATIC,
+};
+
+static const ti_terminfo * const ti_builtins[] = {
+	&ti_bi0,
+	&ti_bi1,
+	&ti_bi2,
+	&ti_bi3,
+	NULL
+};
+
+#undef TI_BI_STR
@@ -0,0 +1,130 @@
+#define _XOPEN_SOURCE 700    // setenv, unsetenv
+
+// compile in the entries generated by the Makefile from test/terminfo
+#define TI_BUILTIN "test/ti_builtin.inl"
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "ti_same_caps.inl"
+
+// Every builtin entry has the same capabilities as the file it came from.
+void test_builtin_matches_load(const char *term) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(err == 0);
+	assert(ti != NULL);
+	assert(!(ti->flags & TI_F_STATIC));
+
+	ti_terminfo *bti = ti_load_builtin(term, &err);
+	printf("term=%s err=%d\n", term, err);
+	assert(err == 0);
+	assert(bti != NULL);
+	assert(bti->flags & TI_F_STATIC);
+
+	assert_same_caps(ti, bti);
+
+	// extended strings are found by name
+	for (int i = 0; i < ti->ext_strs_count; i++) {
+		const char *name = ti_extname(ti, TI_STR, i);
+		assert(ti_getstr(bti, name) == ti_getextstri(bti, i));
+	}
+
+	// freeing a builtin entry does nothing
+	ti_free(bti);
+	ti_release(bti);
+	assert(ti_load_builtin(term, NULL) == bti);
+
+	ti_free(ti);
+}
+
+// Builtin entries are found by any of their names but not the description.
+void test_builtin_names() {
+	int err = 0;
+	ti_terminfo *ti = ti_load_builtin("xterm-new", &err);
+	assert(err == 0);
+	assert(ti != NULL);
+
+	ti = ti_load_builtin("modern xterm terminal emulator", &err);
+	assert(ti == NULL);
+	assert(err == ENOENT);
+
+	ti = ti_load_builtin("xterm", &err);
+	assert(ti == NULL);
+	assert(err == ENOENT);
+
+	ti = ti_load_builtin("xterm-missing", &err);
+	assert(ti == NULL);
+	assert(err == ENOENT);
+}
+
+// The other loaders use builtin entries first unless TERMINFO is set, and
+// fall back to them when no file is found.
+void test_builtin_precedence() {
+	int err = 0;
+	ti_terminfo *bti = ti_load_builtin("xterm-color", NULL);
+	assert(bti != NULL);
+
+	// TERMINFO is set: the file wins
+	ti_terminfo *ti = ti_load("xterm-color", &err);
+	assert(err == 0);
+	assert(ti != bti);
+	ti_free(ti);
+
+	// TERMINFO is unset: the builtin wins without searching the database
+	unsetenv("TERMINFO");
+	setenv("TERMINFO_DIRS", "/nonexistent", 1);
+	ti_resolve_reset();
+	ti = ti_load("xterm-color", &err);
+	assert(err == 0);
+	assert(ti == bti);
+	struct ti_resolve_stats stats;
+	ti_resolve_stats(&stats);
+	assert(stats.resolves == 0);
+	ti_free(ti);
+
+	ti = ti_load_mmap("minitel1", &err);
+	assert(err == 0);
+	assert(ti->flags & TI_F_STATIC);
+
+	ti = ti_load_shared("xterm-kitty", &err);
+	assert(err == 0);
+	assert(ti->flags & TI_F_STATIC);
+	ti_release(ti);
+
+	ti = ti_load("xterm-missing", &err);
+	assert(ti == NULL);
+	assert(err == ENOENT);
+
+	// TERMINFO points at a directory without the file: builtin fallback
+	setenv("TERMINFO", "/nonexistent", 1);
+	ti = ti_load("xterm-new", &err);
+	assert(err == 0);
+	assert(ti->flags & TI_F_STATIC);
+	ti = ti_load_shared("xterm-new", &err);
+	assert(err == 0);
+	assert(ti->flags & TI_F_STATIC);
+
+	setenv("TERMINFO", "./terminfo", 1);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// load terminfo data from our test directory only
+	setenv("TERMINFO", "./terminfo", 1);
+
+	test_builtin_matches_load("xterm-color");
+	test_builtin_matches_load("xterm-new");
+	test_builtin_matches_load("xterm-kitty");
+	test_builtin_matches_load("minitel1");
+	test_builtin_names();
+	test_builtin_precedence();
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,205 @@
+#define _XOPEN_SOURCE 700    // setenv, mkdtemp
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <assert.h>
+#include <pthread.h>
+
+static char tmpdir[] = "/tmp/ti_cache_test.XXXXXX";
+static char fn[TI_FN_MAX];
+
+// Copy a test terminfo file into the temp terminfo dir.
+static void copy_file(const char *src, const char *dst) {
+	FILE *in = fopen(src, "rb"), *out = fopen(dst, "wb");
+	assert(in && out);
+	char buf[4096];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+		assert(fwrite(buf, 1, n, out) == n);
+	fclose(in);
+	fclose(out);
+}
+
+// Force the next load of ti to check the file's mtime.
+static void expire(ti_terminfo *ti) {
+	((struct ti_shared *)ti)->checked = 0;
+}
+
+void test_same_name_same_struct() {
+	int err = 0;
+	ti_terminfo *a = ti_load_shared("xterm-color", &err);
+	assert(err == 0);
+	assert(a != NULL);
+	assert(a->flags & TI_F_SHARED);
+	assert(a->flags & TI_F_MMAP);
+	assert(ti_getnumi(a, ti_colors) == 8);
+
+	ti_terminfo *b = ti_load_shared("xterm-color", &err);
+	assert(err == 0);
+	assert(a == b);
+
+	ti_terminfo *c = ti_load_shared("xterm-new", &err);
+	assert(err == 0);
+	assert(c != a);
+
+	ti_release(a);
+	ti_release(b);
+	ti_release(c);
+}
+
+// Names resolving to the same file share one struct.
+void test_names_share_file() {
+	int err = 0;
+	ti_terminfo *a = ti_load_shared("xterm-color", &err);
+	ti_terminfo *b = ti_load_shared("xterm-alias", &err);
+	printf("err=%d\n", err);
+	assert(err == 0);
+	assert(a == b);
+	ti_release(a);
+	ti_release(b);
+}
+
+// Cached names don't touch the filesystem until the entry expires.
+void test_mtime_invalidation() {
+	int err = 0;
+	ti_terminfo *a = ti_load_shared("xterm-color", &err);
+	assert(a != NULL);
+
+	// touch the file with a new mtime; cached entry is still used
+	struct timespec ts[2] = {{0, UTIME_OMIT}, {12345, 0}};
+	assert(utimensat(AT_FDCWD, fn, ts, 0) == 0);
+	ti_terminfo *b = ti_load_shared("xterm-color", &err);
+	assert(a == b);
+	ti_release(b);
+
+	// once expired the mtime change is noticed and the file reloaded
+	expire(a);
+	b = ti_load_shared("xterm-color", &err);
+	assert(err == 0);
+	assert(b != NULL);
+	assert(a != b);
+
+	// the old struct stays valid until released
+	assert(ti_getnumi(a, ti_colors) == 8);
+	assert(strcmp(ti_getstri(a, ti_el), "\x1b[K") == 0);
+	ti_release(a);
+	ti_release(b);
+
+	// removing the file is also noticed after expiry
+	b = ti_load_shared("xterm-color", &err);
+	assert(unlink(fn) == 0);
+	expire(b);
+	ti_terminfo *c = ti_load_shared("xterm-color", &err);
+	printf("err=%d\n", err);
+	assert(c == NULL);
+	assert(err == ENOENT);
+	ti_release(b);
+}
+
+// Changing TERMINFO drops the cache.
+void test_env_invalidation() {
+	int err = 0;
+	ti_terminfo *a = ti_load_shared("xterm-new", &err);
+	assert(a != NULL);
+
+	setenv("TERMINFO", tmpdir, 1);
+	ti_terminfo *b = ti_load_shared("xterm-new", &err);
+	printf("err=%d\n", err);
+	assert(b == NULL);
+	assert(err == ENOENT);
+
+	setenv("TERMINFO", "./terminfo", 1);
+	b = ti_load_shared("xterm-new", &err);
+	assert(b != NULL);
+	assert(a != b);
+	ti_release(a);
+	ti_release(b);
+}
+
+// err is set on success when the name wasn't cached yet.
+void test_first_load_err() {
+	ti_cache_flush();
+	int err = -1;
+	ti_terminfo *a = ti_load_shared("xterm-color", &err);
+	assert(a != NULL);
+	assert(err == 0);
+
+	// a new name for an already loaded file
+	err = -1;
+	ti_terminfo *b = ti_load_shared("xterm-alias", &err);
+	assert(b == a);
+	assert(err == 0);
+	ti_release(a);
+	ti_release(b);
+}
+
+static ti_terminfo *first;
+
+static void *load_loop(void *arg) {
+	(void)arg;
+	for (int i = 0; i < 1000; i++) {
+		int err;
+		ti_terminfo *ti = ti_load_shared("xterm-kitty", &err);
+		assert(ti == first);
+		assert(ti_getnumi(ti, ti_colors) == 256);
+		ti_release(ti);
+	}
+	return NULL;
+}
+
+void test_threads() {
+	int err;
+	first = ti_load_shared("xterm-kitty", &err);
+	assert(first != NULL);
+
+	pthread_t th[4];
+	for (int i = 0; i < 4; i++)
+		assert(pthread_create(&th[i], NULL, load_loop, NULL) == 0);
+	for (int i = 0; i < 4; i++)
+		pthread_join(th[i], NULL);
+
+	assert(((struct ti_shared *)first)->refs == 1);
+	ti_release(first);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// set up a private terminfo dir with a file we can modify and a symlink
+	assert(mkdtemp(tmpdir));
+	snprintf(fn, sizeof(fn), "%s/x", tmpdir);
+	assert(mkdir(fn, 0700) == 0);
+	snprintf(fn, sizeof(fn), "%s/x/xterm-alias", tmpdir);
+	assert(symlink("xterm-color", fn) == 0);
+	snprintf(fn, sizeof(fn), "%s/x/xterm-color", tmpdir);
+	copy_file("./terminfo/x/xterm-color", fn);
+
+	setenv("TERMINFO", "./terminfo", 1);
+	test_same_name_same_struct();
+	test_env_invalidation();
+
+	setenv("TERMINFO", tmpdir, 1);
+	test_first_load_err();
+	test_names_share_file();
+	test_mtime_invalidation();
+
+	setenv("TERMINFO", "./terminfo", 1);
+	test_threads();
+
+	ti_cache_flush();
+	assert(ti_cache.files == NULL);
+
+	snprintf(fn, sizeof(fn), "%s/x/xterm-alias", tmpdir);
+	unlink(fn);
+	snprintf(fn, sizeof(fn), "%s/x", tmpdir);
+	rmdir(fn);
+	rmdir(tmpdir);
+
+	return 0;
+}
+
+// vim: noexpandtab
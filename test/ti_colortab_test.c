@@ -0,0 +1,73 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+static void assert_slice(ti_slice sl, const char *want) {
+	assert(sl.ptr != NULL);
+	assert(sl.len == (int)strlen(want));
+	assert(memcmp(sl.ptr, want, sl.len + 1) == 0);
+}
+
+// Every slice is the same as expanding the capability with ti_parm().
+void test_colortab(const char *term, int ncolors) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(ti != NULL);
+
+	ti_colortab *tab = ti_colortab_new(ti);
+	assert(tab != NULL);
+	printf("term=%s colors=%d\n", term, ti_colortab_count(tab));
+	assert(ti_colortab_count(tab) == ncolors);
+
+	char buf[TI_PARM_OUTPUT_MAX];
+	for (int i = 0; i < ncolors; i++) {
+		ti_parm(buf, ti_getstri(ti, ti_setaf), 1, i);
+		assert_slice(ti_colortab_fg(tab, i), buf);
+		ti_parm(buf, ti_getstri(ti, ti_setab), 1, i);
+		assert_slice(ti_colortab_bg(tab, i), buf);
+	}
+	assert_slice(ti_colortab_op(tab), ti_getstri(ti, ti_op));
+	assert_slice(ti_colortab_sgr0(tab), ti_getstri(ti, ti_sgr0));
+
+	// out of range colors are empty
+	assert_slice(ti_colortab_fg(tab, -1), "");
+	assert_slice(ti_colortab_fg(tab, ncolors), "");
+	assert_slice(ti_colortab_bg(tab, ncolors), "");
+
+	// sequences are packed one after another in a single arena
+	ti_slice first = ti_colortab_fg(tab, 0);
+	ti_slice last = ti_colortab_sgr0(tab);
+	const char *p = first.ptr;
+	for (int i = 0; i < ncolors; i++) {
+		ti_slice sl = ti_colortab_fg(tab, i);
+		assert(sl.ptr == p);
+		p += sl.len + 1;
+	}
+	assert(last.ptr > first.ptr);
+
+	// the table doesn't need the terminfo struct after it's built
+	ti_free(ti);
+	assert(ti_colortab_fg(tab, 1).len > 0);
+	ti_colortab_free(tab);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// load terminfo data from our test directory only
+	setenv("TERMINFO", "./terminfo", 1);
+
+	test_colortab("xterm-color", 8);
+	test_colortab("xterm-new", 8);
+	test_colortab("xterm-kitty", 256);
+	test_colortab("minitel1", 8);
+
+	return 0;
+}
+
+// vim: noexpandtab
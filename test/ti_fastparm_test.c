@@ -0,0 +1,112 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+// Format ps with a bound formatter and ti_parm() over a range of params and
+// check the output is the same byte for byte.
+static void assert_same(const char *ps, int kind) {
+	ti_fastparm fp;
+	ti_fastparm_bind(&fp, ps);
+	printf("ps=%s kind=%d\n", ps ? ps : "(null)", fp.kind);
+	assert(fp.kind == kind);
+
+	char want[TI_PARM_OUTPUT_MAX], got[TI_PARM_OUTPUT_MAX];
+	static const int bs[] = {-1, 0, 1, 9, 10, 99, 100, 999, 1000, 65535};
+	for (int a = -3; a < 300; a += (a < 20 ? 1 : 37)) {
+		for (size_t i = 0; i < sizeof(bs) / sizeof(bs[0]); i++) {
+			int b = bs[i];
+			int p[] = {a, b};
+			int wn = ps ? ti_parm(want, ps, 2, a, b) : 0;
+			if (!ps) want[0] = '\0';
+			int gn = ti_fastparm_fmt(&fp, got, p, 2);
+			assert(gn == wn);
+			assert(memcmp(want, got, wn + 1) == 0);
+		}
+	}
+
+	// extremes
+	int p[] = {INT32_MIN, INT32_MAX - 1};
+	if (ps) {
+		int wn = ti_parm(want, ps, 2, p[0], p[1]);
+		assert(ti_fastparm_fmt(&fp, got, p, 2) == wn);
+		assert(memcmp(want, got, wn + 1) == 0);
+	}
+}
+
+// Strings are matched to the expected templates.
+void test_templates() {
+	assert_same("\033[%i%p1%d;%p2%dH", TI_FAST_P1P2);
+	assert_same("\033[%i%p1%d;%p2%dH$<5>", TI_FAST_P1P2);
+	assert_same("\033[%p1%d;%p2%dH", TI_FAST_P1P2);
+	assert_same("\033[%i%p1%dG", TI_FAST_P1);
+	assert_same("\033[%i%p1%dd", TI_FAST_P1);
+	assert_same("\033[%p1%dC", TI_FAST_P1);
+	assert_same("\033[3%p1%dm", TI_FAST_P1);
+	assert_same("\033[48;5;%p1%dm", TI_FAST_P1);
+	assert_same("\033[%?%p1%{8}%<%t3%p1%d%e%p1%{16}%<%t9%p1%{8}%-%d"
+	            "%e38;5;%p1%d%;m", TI_FAST_COLOR16);
+	assert_same("\033[%?%p1%{8}%<%t4%p1%d%e%p1%{16}%<%t10%p1%{8}%-%d"
+	            "%e48;5;%p1%d%;m", TI_FAST_COLOR16);
+	assert_same("\033[%?%p1%{8}%<%t3%p1%d%e38;5;%p1%d%;m", TI_FAST_COLOR8);
+
+	// everything else is interpreted
+	assert_same("\037%p1%'A'%+%c%p2%'A'%+%c", TI_FAST_GENERIC);
+	assert_same("\033[%p2%d;%p1%dH", TI_FAST_GENERIC);
+	assert_same("\033[%%%p1%dC", TI_FAST_GENERIC);
+	assert_same("\033[%?%p1%{7}%<%t3%p1%d%e38;5;%p1%d%;m", TI_FAST_GENERIC);
+	assert_same("\033[H", TI_FAST_GENERIC);
+	assert_same(NULL, TI_FAST_NONE);
+}
+
+// The cursor and color strings of the test terminals format the same as with
+// ti_parm().
+void test_terminal(const char *term) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(ti != NULL);
+
+	ti_fastcaps fc;
+	ti_fastcaps_init(&fc, ti);
+	ti_fastparm *all[] = {
+		&fc.cup, &fc.hpa, &fc.vpa, &fc.cuf, &fc.cub, &fc.cuu, &fc.cud,
+		&fc.setaf, &fc.setab,
+	};
+	for (size_t i = 0; i < sizeof(all) / sizeof(all[0]); i++) {
+		assert_same(all[i]->ps, all[i]->kind);
+	}
+	if (strcmp(term, "minitel1")) {
+		assert(fc.cup.kind == TI_FAST_P1P2);
+		assert(fc.cuf.kind == TI_FAST_P1);
+	}
+
+	// missing params are zero
+	char want[TI_PARM_OUTPUT_MAX], got[TI_PARM_OUTPUT_MAX];
+	int p[] = {4};
+	ti_parm(want, fc.cup.ps, 1, 4);
+	ti_fastparm_fmt(&fc.cup, got, p, 1);
+	assert(strcmp(want, got) == 0);
+
+	ti_free(ti);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// load terminfo data from our test directory only
+	setenv("TERMINFO", "./terminfo", 1);
+
+	test_templates();
+	test_terminal("xterm-color");
+	test_terminal("xterm-new");
+	test_terminal("xterm-kitty");
+	test_terminal("minitel1");
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -126,6 +126,118 @@ void test_getcaps_by_index() {
 	ti_free(ti);
 }
 
+// Every standard and extended capability name finds the same value as its
+// index, with regular and mapped loads.
+void test_getcaps_by_name_all(ti_terminfo *ti) {
+	for (int i = 0; i < ti->bools_count; i++)
+		assert(ti_getbool(ti, ti_boolnames[i]) == ti_getbooli(ti, i));
+	for (int i = 0; i < ti->nums_count; i++)
+		assert(ti_getnum(ti, ti_numnames[i]) == ti_getnumi(ti, i));
+	for (int i = 0; i < ti->strs_count; i++)
+		assert(ti_getstr(ti, ti_strnames[i]) == ti_getstri(ti, i));
+
+	for (int i = 0; i < ti->ext_bools_count; i++) {
+		const char *name = ti_extname(ti, TI_BOOL, i);
+		assert(ti_getbool(ti, name) == ti_getextbooli(ti, i));
+	}
+	for (int i = 0; i < ti->ext_nums_count; i++) {
+		const char *name = ti_extname(ti, TI_NUM, i);
+		assert(ti_getnum(ti, name) == ti_getextnumi(ti, i));
+	}
+	for (int i = 0; i < ti->ext_strs_count; i++) {
+		const char *name = ti_extname(ti, TI_STR, i);
+		assert(ti_getstr(ti, name) == ti_getextstri(ti, i));
+	}
+
+	// names are only found as their own type and are case sensitive
+	assert(ti_getnum(ti, "el") == -1);
+	assert(ti_getstr(ti, "colors") == NULL);
+	assert(ti_getbool(ti, "setrgbf") == 0);
+	assert(ti_getstr(ti, "EL") == NULL);
+	assert(ti_getstr(ti, "") == NULL);
+}
+
+void test_getcaps_by_name_hashed() {
+	const char *terms[] = {"xterm-color", "xterm-new", "xterm-kitty", "minitel1"};
+	for (int i = 0; i < 4; i++) {
+		int err;
+		ti_terminfo *ti = ti_load(terms[i], &err);
+		assert(ti != NULL);
+		test_getcaps_by_name_all(ti);
+		ti_free(ti);
+
+		ti = ti_load_mmap(terms[i], &err);
+		assert(ti != NULL);
+		test_getcaps_by_name_all(ti);
+		ti_free(ti);
+	}
+
+	// extended capabilities used for true color and styled underlines
+	ti_terminfo *ti = ti_load("xterm-kitty", NULL);
+	assert(ti != NULL);
+	assert(ti_getbool(ti, "Tc") == 1);
+	assert(strcmp(ti_getstr(ti, "setrgbf"),
+	              "\x1b[38:2:%p1%d:%p2%d:%p3%dm") == 0);
+	assert(ti_getstr(ti, "Smulx") == NULL);
+	ti_free(ti);
+}
+
+void test_getcaps_batch() {
+	int err;
+	ti_terminfo *ti = ti_load("xterm-kitty", &err);
+	assert(ti != NULL);
+
+	// describe the capabilities an application needs and where they go
+	struct caps {
+		char *cup, *sgr0, *setrgbf, *smxx, *flash;
+		int colors, wsl;
+		int am, Tc, hc;
+	} caps;
+	static const struct ti_capdesc descs[] = {
+		TI_CAP(TI_STR,  "cup",     struct caps, cup),
+		TI_CAP(TI_STR,  "sgr0",    struct caps, sgr0),
+		TI_CAP(TI_STR,  "setrgbf", struct caps, setrgbf),
+		TI_CAP(TI_STR,  "smxx",    struct caps, smxx),
+		TI_CAP(TI_STR,  "flash",   struct caps, flash),
+		TI_CAP(TI_NUM,  "colors",  struct caps, colors),
+		TI_CAP(TI_NUM,  "wsl",     struct caps, wsl),
+		TI_CAP(TI_BOOL, "am",      struct caps, am),
+		TI_CAP(TI_BOOL, "Tc",      struct caps, Tc),
+		TI_CAP(TI_BOOL, "hc",      struct caps, hc),
+	};
+	const int n = sizeof(descs) / sizeof(descs[0]);
+
+	// read them all at once, noting which ones the terminal doesn't have
+	char missing[sizeof(descs) / sizeof(descs[0])];
+	memset(&caps, 0xff, sizeof(caps));
+	int nmissing = ti_getcaps(ti, descs, n, &caps, missing);
+	printf("nmissing=%d\n", nmissing);
+
+	assert(caps.cup == ti_getstr(ti, "cup"));
+	assert(caps.sgr0 == ti_getstr(ti, "sgr0"));
+	assert(caps.setrgbf == ti_getstr(ti, "setrgbf"));
+	assert(caps.smxx == ti_getstr(ti, "smxx"));
+	assert(caps.flash == ti_getstr(ti, "flash"));
+	assert(caps.colors == 256);
+	assert(caps.wsl == -1);
+	assert(caps.am == 1);
+	assert(caps.Tc == 1);
+	assert(caps.hc == 0);
+
+	// wsl and hc aren't set for xterm-kitty
+	const char want[] = {0, 0, 0, 0, 0, 0, 1, 0, 0, 1};
+	for (int i = 0; i < n; i++) {
+		printf("%s missing=%d\n", descs[i].name, missing[i]);
+		assert(missing[i] == want[i]);
+	}
+	assert(nmissing == 2);
+
+	// the missing array is optional
+	assert(ti_getcaps(ti, descs, n, &caps, NULL) == nmissing);
+
+	ti_free(ti);
+}
+
 int main(void) {
 	// load terminfo data from our test directory only
 	setenv("TERMINFO", "./terminfo", 1);
@@ -133,6 +245,8 @@ int main(void) {
 	test_getcaps_by_index();
 	test_getcaps_by_name();
 	test_getcaps_by_name_extended();
+	test_getcaps_by_name_hashed();
+	test_getcaps_batch();
 
 	return 0;
 }
@@ -7,6 +7,8 @@
 #include <unistd.h>
 #include <assert.h>
 
+#include "ti_same_caps.inl"
+
 void test_legacy_storage_format() {
 	int err = 0;
 
@@ -227,6 +229,68 @@ void test_non_terminfo_file() {
 	ti_free(ti);
 }
 
+// Loading with ti_load_mmap() yields the same capabilities as ti_load() but
+// without allocating capability arrays.
+void test_mmap_matches_load(const char *term) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(err == 0);
+	assert(ti != NULL);
+
+	ti_terminfo *mti = ti_load_mmap(term, &err);
+	printf("term=%s err=%d\n", term, err);
+	assert(err == 0);
+	assert(mti != NULL);
+	assert(mti->flags & TI_F_MMAP);
+	assert(mti->nums == NULL && mti->strs == NULL);
+	assert(mti->ext_nums == NULL && mti->ext_strs == NULL);
+	assert(mti->ext_names == NULL);
+
+	assert_same_caps(ti, mti);
+
+	ti_free(mti);
+	ti_free(ti);
+}
+
+// Compact loads keep everything in the struct's allocation.
+void test_compact_matches_load(const char *term) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(err == 0);
+	assert(ti != NULL);
+
+	ti_terminfo *cti = ti_load_compact(term, &err);
+	printf("term=%s err=%d\n", term, err);
+	assert(err == 0);
+	assert(cti != NULL);
+	assert(cti->flags == TI_F_COMPACT);
+	assert(cti->strs == NULL && cti->ext_strs == NULL);
+	assert(cti->ext_names == NULL);
+
+	const char *start = (const char *)cti, *end = cti->data + cti->len;
+	assert((const char *)cti->nums > start && (const char *)cti->nums < end);
+	assert(cti->data > start && cti->term_names >= cti->data);
+
+	assert_same_caps(ti, cti);
+
+	ti_free(cti);
+	ti_free(ti);
+}
+
+// Mapped loads report the same errors as regular loads.
+void test_mmap_errors() {
+	int err = 0;
+	ti_terminfo *ti = ti_load_mmap("xterm-missing", &err);
+	printf("err=%d\n", err);
+	assert(ti == NULL);
+	assert(err == ENOENT);
+
+	ti = ti_load_mmap("xterm-badfile", &err);
+	printf("err=%d\n", err);
+	assert(ti == NULL);
+	assert(err == TI_ERR_BAD_MAGIC);
+}
+
 int main(void) {
 	// make stdout line buffered
 	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
@@ -240,6 +304,15 @@ int main(void) {
 	test_minitel1();
 	test_missing_file();
 	test_non_terminfo_file();
+	test_mmap_matches_load("xterm-color");
+	test_mmap_matches_load("xterm-new");
+	test_mmap_matches_load("xterm-kitty");
+	test_mmap_matches_load("minitel1");
+	test_mmap_errors();
+	test_compact_matches_load("xterm-color");
+	test_compact_matches_load("xterm-new");
+	test_compact_matches_load("xterm-kitty");
+	test_compact_matches_load("minitel1");
 
 	return 0;
 }
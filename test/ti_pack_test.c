@@ -0,0 +1,147 @@
+#define _XOPEN_SOURCE 700    // setenv, mkdtemp
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <assert.h>
+
+#include "ti_same_caps.inl"
+
+// terminfo.tidb is packed from ./terminfo by the Makefile with tools/tipack
+static const char *db = "./terminfo.tidb";
+
+static const char *terms[] = {
+	"xterm-color", "xterm-new", "xterm-kitty", "minitel1", NULL,
+};
+
+// Packed entries resolve to the database path with one hash probe.
+void test_resolve_packed() {
+	setenv("TERMINFO", db, 1);
+
+	char path[TI_FN_MAX];
+	int probes = -1;
+	int rc = ti_resolve_path("xterm-color", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strcmp(path, db) == 0);
+
+	// mapping the database and the hash probe
+	assert(probes == 2);
+
+	// after that only the hash probe
+	for (int i = 0; terms[i]; i++) {
+		rc = ti_resolve_path(terms[i], path, sizeof(path), &probes);
+		printf("term=%s rc=%d probes=%d\n", terms[i], rc, probes);
+		assert(rc == 0);
+		assert(probes == 1);
+	}
+
+	// missing names are remembered like in directories
+	rc = ti_resolve_path("xterm-missing", path, sizeof(path), &probes);
+	assert(rc == ENOENT);
+	assert(probes == 1);
+	rc = ti_resolve_path("xterm-missing", path, sizeof(path), &probes);
+	assert(rc == ENOENT);
+	assert(probes == 0);
+
+	// files that aren't terminfo entries aren't packed
+	rc = ti_resolve_path("xterm-badfile", path, sizeof(path), &probes);
+	assert(rc == ENOENT);
+}
+
+// Entries loaded from the database match the files they were packed from.
+void test_load_packed(const char *term) {
+	setenv("TERMINFO", "./terminfo", 1);
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(err == 0);
+	assert(ti != NULL);
+
+	setenv("TERMINFO", db, 1);
+	ti_terminfo *(*loaders[])(const char *, int *) = {
+		ti_load, ti_load_mmap, ti_load_compact,
+	};
+	for (int i = 0; i < 3; i++) {
+		err = -1;
+		ti_terminfo *pti = loaders[i](term, &err);
+		printf("term=%s loader=%d err=%d\n", term, i, err);
+		assert(err == 0);
+		assert(pti != NULL);
+		assert_same_caps(ti, pti);
+		ti_free(pti);
+	}
+
+	ti_free(ti);
+}
+
+// Shared loads of different names in one database are separate entries.
+void test_shared_packed() {
+	setenv("TERMINFO", db, 1);
+	int err = 0;
+	ti_terminfo *a = ti_load_shared("xterm-color", &err);
+	ti_terminfo *b = ti_load_shared("xterm-new", &err);
+	ti_terminfo *c = ti_load_shared("xterm-color", &err);
+	assert(a && b && c);
+	assert(a != b);
+	assert(a == c);
+	assert(strcmp(b->term_names, "xterm-new|modern xterm terminal emulator") == 0);
+	ti_release(a);
+	ti_release(b);
+	ti_release(c);
+}
+
+// Databases are searched in TERMINFO_DIRS order along with directories, and
+// damaged database files are skipped.
+void test_dirs_packed() {
+	char tmpdir[] = "/tmp/ti_pack_test.XXXXXX";
+	assert(mkdtemp(tmpdir));
+	char bad[TI_FN_MAX + 16];
+	snprintf(bad, sizeof(bad), "%s/bad.tidb", tmpdir);
+	FILE *fp = fopen(bad, "w");
+	assert(fp);
+	fputs("TIDB this is not a database", fp);
+	fclose(fp);
+
+	char dirs[3 * TI_FN_MAX];
+	snprintf(dirs, sizeof(dirs), "%s:%s:./terminfo", bad, db);
+	unsetenv("TERMINFO");
+	setenv("HOME", "/nonexistent", 1);
+	setenv("TERMINFO_DIRS", dirs, 1);
+
+	char path[TI_FN_MAX];
+	int rc = ti_resolve_path("xterm-kitty", path, sizeof(path), NULL);
+	printf("rc=%d path=%s\n", rc, path);
+	assert(rc == 0);
+	assert(strcmp(path, db) == 0);
+
+	ti_terminfo *ti = ti_load("minitel1", NULL);
+	assert(ti != NULL);
+	assert(strncmp(ti->term_names, "minitel1|", 9) == 0);
+	ti_free(ti);
+
+	// a name only in the directory is still found there
+	rc = ti_resolve_path("xterm-badfile", path, sizeof(path), NULL);
+	assert(rc == 0);
+	assert(strcmp(path, "./terminfo/x/xterm-badfile") == 0);
+
+	unlink(bad);
+	rmdir(tmpdir);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	test_resolve_packed();
+	for (int i = 0; terms[i]; i++) {
+		test_load_packed(terms[i]);
+	}
+	test_shared_packed();
+	test_dirs_packed();
+
+	return 0;
+}
+
+// vim: noexpandtab
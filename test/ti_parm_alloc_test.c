@@ -0,0 +1,95 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+// Count heap allocations by wrapping the glibc allocator.
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+
+static int nallocs;
+
+void *malloc(size_t size) {
+	nallocs++;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+	nallocs++;
+	return __libc_calloc(n, size);
+}
+
+void *realloc(void *p, size_t size) {
+	nallocs++;
+	return __libc_realloc(p, size);
+}
+
+// Expand ps with ti_parm() and a compiled program and check neither
+// allocates.
+static void assert_no_allocs(const char *ps, const int *p) {
+	char buf[TI_PARM_OUTPUT_MAX];
+	int before = nallocs;
+	ti_parm_prog *prog = ti_parm_compile(ps);
+	assert(prog != NULL);
+
+	// compiling allocates, so allocations are being counted
+	assert(nallocs > before);
+
+	before = nallocs;
+	ti_parm(buf, ps, 9, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8]);
+	ti_parm_exec(prog, buf, p, 9);
+	int n = nallocs - before;
+
+	printf("ps=%s allocs=%d\n", ps, n);
+	assert(n == 0);
+	ti_parm_free(prog);
+}
+
+// The string operators and variables don't allocate.
+void test_operators() {
+	static const int p[9] = {7, 42, 1};
+	assert_no_allocs("%'x'%c%{79}%s%'y'%l%d", p);
+	assert_no_allocs("%{1234}%PI%gI%s%gJ%s%p2%Pa%ga%ga%=%d%gb%l%d", p);
+	assert_no_allocs("%p1%p2%+%PZ%gZ%:-8s%gZ%gZ%*%d", p);
+	assert_no_allocs("%?%p3%t%'a'%Pc%e%'b'%Pc%;%gc%s", p);
+}
+
+// Colors and attributes of a real terminal don't allocate.
+void test_terminal(const char *term) {
+	int err = 0;
+	ti_terminfo *ti = ti_load(term, &err);
+	assert(ti != NULL);
+
+	static const int cup[9] = {24, 80};
+	static const int color[9] = {196};
+	static const int sgr[9] = {1, 1, 0, 0, 0, 1, 0, 0, 1};
+	const char *ps;
+	if ((ps = ti_getstri(ti, ti_cup))) assert_no_allocs(ps, cup);
+	if ((ps = ti_getstri(ti, ti_setaf))) assert_no_allocs(ps, color);
+	if ((ps = ti_getstri(ti, ti_setab))) assert_no_allocs(ps, color);
+	if ((ps = ti_getstri(ti, ti_sgr))) assert_no_allocs(ps, sgr);
+
+	ti_free(ti);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// load terminfo data from our test directory only
+	setenv("TERMINFO", "./terminfo", 1);
+
+	test_operators();
+	test_terminal("xterm-color");
+	test_terminal("xterm-new");
+	test_terminal("xterm-kitty");
+	test_terminal("minitel1");
+
+	return 0;
+}
+
+// vim: noexpandtab
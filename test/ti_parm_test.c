@@ -8,6 +8,198 @@
 #include <unistd.h>
 #include <assert.h>
 
+// Run ps through ti_parm() and a compiled program and check the output is the
+// same byte for byte.
+static void assert_compiled_same(const char *ps, const int *p) {
+	char want[TI_PARM_OUTPUT_MAX], got[TI_PARM_OUTPUT_MAX];
+	int wn = ti_parm(want, ps, 9, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8]);
+
+	ti_parm_prog *prog = ti_parm_compile(ps);
+	assert(prog != NULL);
+	int gn = ti_parm_exec(prog, got, p, 9);
+	ti_parm_free(prog);
+
+	if (gn != wn || memcmp(want, got, wn + 1) != 0) {
+		printf("mismatch: ps=%s want=%s got=%s\n", ps, want, got);
+	}
+	assert(gn == wn);
+	assert(memcmp(want, got, wn + 1) == 0);
+}
+
+// Compiled programs match the interpreter for the strings above, odd and
+// malformed strings, and every string capability of the test terminals with a
+// few different params.
+void test_compiled() {
+	static const char *strs[] = {
+		"hello %% there %%", "%i%p1%p2%d%d%p3%d", "%'x'%c%{79}%c",
+		"%'y'%s%{80}%s", "%{1234}%PI%gI%s", "%gJ%s", "%{5678}%Pi%gi%s",
+		"%gj%s", "%'y'%l%d", "%p1%p2%+%d", "%p1%p2%-%d", "%p1%p2%*%d",
+		"%p1%p2%/%d", "%p1%p2%&%x", "%p1%p2%|%X",
+		"%p1%p2%^%x", "%p1%~%d", "%p1%p2%O%x", "%p1%p2%A%x", "%p1%!%x",
+		"%p1%p2%=%d", "%p1%p2%>%d", "%p1%p2%<%d", "%p1%:+03x",
+		"%p1%:-02X", "%p1%04o", "%'z'% 4s", "%'z'%:+ 4s", "%'z'%:- 4s",
+		"%p1%1.1d", "%?%p1%tif%eelse%;", "%?%p1%t%?%p2%tif if%eelse%;%;",
+		"%?%p1%tif%e%?%p2%telse if%;%;",
+		// invalid vars, params, instructions and conversions
+		"%P!%g!%p0%d%p9%d%z%{7}%1q%d", "%'%'%s%?%p1%t%'%'%;x",
+		"%?%p1%t%%%e%%%%%;", "%p1%p2%=%t%{1}%:-#10.5x%e%p3%:+ 5.3d%;",
+		"%?%p1%{1}%=%tone%e%p1%{2}%=%ttwo%e%p1%{3}%=%tthree%eother%;",
+		"%{12345}%PZ%gZ%l%d%gZ%gZ%=%d", "", "abc",
+		// the skip scan doesn't land on a boundary
+		"%?%p1%t%{1%;}x%;",
+		NULL,
+	};
+	static const int params[][9] = {
+		{0}, {1, 1, 1}, {2, 0, 7}, {3, 4, 5, 6, 7, 8, 9, 10, 11},
+		{-1, 255, 1000}, {1, 0, 0, 1, 0, 1, 0, 1, 1},
+	};
+	static const char *terms[] = {
+		"xterm-color", "xterm-new", "xterm-kitty", "minitel1", NULL,
+	};
+	int nparams = sizeof(params) / sizeof(params[0]);
+
+	for (int i = 0; strs[i]; i++) {
+		for (int j = 0; j < nparams; j++) {
+			assert_compiled_same(strs[i], params[j]);
+		}
+	}
+
+	// %m by zero is undefined in both
+	assert_compiled_same("%p1%p2%m%d", params[3]);
+
+	setenv("TERMINFO", "./terminfo", 1);
+	for (int t = 0; terms[t]; t++) {
+		int err = 0;
+		ti_terminfo *ti = ti_load(terms[t], &err);
+		assert(ti != NULL);
+		for (int i = 0; i < ti->strs_count; i++) {
+			char *ps = ti_getstri(ti, i);
+			if (!ps) continue;
+			for (int j = 0; j < nparams; j++) {
+				assert_compiled_same(ps, params[j]);
+			}
+		}
+		for (int i = 0; i < ti->ext_strs_count; i++) {
+			char *ps = ti_getextstri(ti, i);
+			if (!ps) continue;
+			for (int j = 0; j < nparams; j++) {
+				assert_compiled_same(ps, params[j]);
+			}
+		}
+		ti_free(ti);
+	}
+
+	// NULL strings compile to nothing
+	assert(ti_parm_compile(NULL) == NULL);
+}
+
+// Static variables set in one context aren't seen by another or by ti_parm().
+void test_contexts() {
+	char buf[TI_PARM_OUTPUT_MAX];
+	ti_parm_ctx *a = ti_parm_ctx_new();
+	ti_parm_ctx *b = ti_parm_ctx_new();
+	assert(a && b);
+
+	int p[] = {11, 22};
+	ti_parm_r(a, buf, sizeof(buf), "%p1%PX", p, 2);
+	ti_parm_r(b, buf, sizeof(buf), "%p2%PX", p, 2);
+	ti_parm(buf, "%{33}%PX", 0);
+
+	int n = ti_parm_r(a, buf, sizeof(buf), "%gX%d", NULL, 0);
+	assert(strcmp(buf, "11") == 0);
+	assert(n == 2);
+	ti_parm_r(b, buf, sizeof(buf), "%gX%d", NULL, 0);
+	assert(strcmp(buf, "22") == 0);
+	ti_parm(buf, "%gX%d", 0);
+	assert(strcmp(buf, "33") == 0);
+
+	// compiled programs use the context they're run with
+	ti_parm_prog *prog = ti_parm_compile("%gX%d");
+	ti_parm_exec_r(a, prog, buf, sizeof(buf), NULL, 0);
+	assert(strcmp(buf, "11") == 0);
+	ti_parm_exec(prog, buf, NULL, 0);
+	assert(strcmp(buf, "33") == 0);
+	ti_parm_free(prog);
+
+	// a NULL context is the default one
+	ti_parm_r(NULL, buf, sizeof(buf), "%gX%d", NULL, 0);
+	assert(strcmp(buf, "33") == 0);
+
+	ti_parm_ctx_free(a);
+	ti_parm_ctx_free(b);
+}
+
+// Output is truncated to the buffer size.
+void test_bufsz() {
+	char buf[8];
+	int p[] = {12345, 678};
+	const char *ps = "\033[%i%p1%d;%p2%dH";
+	ti_parm_prog *prog = ti_parm_compile(ps);
+
+	for (size_t sz = 1; sz <= sizeof(buf); sz++) {
+		memset(buf, 'x', sizeof(buf));
+		int n = ti_parm_r(NULL, buf, sz, ps, p, 2);
+		printf("sz=%zu n=%d\n", sz, n);
+		assert(n == (int)sz - 1);
+		assert(buf[n] == '\0');
+		assert(memcmp(buf, "\033[12346;679H", n) == 0);
+
+		char buf2[8];
+		assert(ti_parm_exec_r(NULL, prog, buf2, sz, p, 2) == n);
+		assert(memcmp(buf, buf2, n + 1) == 0);
+	}
+
+	// nothing is written to an empty buffer
+	buf[0] = 'x';
+	assert(ti_parm_r(NULL, buf, 0, ps, p, 2) == 0);
+	assert(ti_parm_exec_r(NULL, prog, buf, 0, p, 2) == 0);
+	assert(buf[0] == 'x');
+	ti_parm_free(prog);
+}
+
+struct worker {
+	pthread_t thread;
+	int id;
+	int failed;
+};
+
+// Store and read back a static variable in a private context many times.
+static void *parm_worker(void *arg) {
+	struct worker *w = arg;
+	ti_parm_ctx *ctx = ti_parm_ctx_new();
+	ti_parm_prog *prog = ti_parm_compile("%gA%{1}%+%PA%gA%d");
+	char buf[64], want[64];
+
+	for (int i = 1; i <= 10000; i++) {
+		int p[] = {w->id, i};
+		ti_parm_r(ctx, buf, sizeof(buf), "%p1%p2%*%PB%gB%d", p, 2);
+		snprintf(want, sizeof(want), "%d", w->id * i);
+		if (strcmp(buf, want)) w->failed = 1;
+
+		ti_parm_exec_r(ctx, prog, buf, sizeof(buf), NULL, 0);
+		snprintf(want, sizeof(want), "%d", i);
+		if (strcmp(buf, want)) w->failed = 1;
+	}
+
+	ti_parm_free(prog);
+	ti_parm_ctx_free(ctx);
+	return NULL;
+}
+
+// Threads with their own contexts don't see each other's variables.
+void test_threads() {
+	struct worker w[4] = {0};
+	for (int i = 0; i < 4; i++) {
+		w[i].id = i + 1;
+		assert(pthread_create(&w[i].thread, NULL, parm_worker, &w[i]) == 0);
+	}
+	for (int i = 0; i < 4; i++) {
+		pthread_join(w[i].thread, NULL);
+		printf("worker=%d failed=%d\n", w[i].id, w[i].failed);
+		assert(!w[i].failed);
+	}
+}
+
 int main(void) {
 	// make stdout line buffered
 	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
@@ -324,6 +516,11 @@ int main(void) {
 	assert(strcmp(buf, "") == 0);
 	assert(n == strlen(buf));
 
+	test_compiled();
+	test_contexts();
+	test_bufsz();
+	test_threads();
+
 	return 0;
 }
 
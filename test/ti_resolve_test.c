@@ -0,0 +1,164 @@
+#define _XOPEN_SOURCE 700    // setenv, mkdtemp
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <assert.h>
+
+static char tmpdir[] = "/tmp/ti_resolve_test.XXXXXX";
+static char hexdir[TI_FN_MAX];
+static char letterdir[TI_FN_MAX];
+
+void test_resolve_path() {
+	char path[TI_FN_MAX];
+	int probes = -1;
+	int rc = ti_resolve_path("xterm-color", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strcmp(path, "./terminfo/x/xterm-color") == 0);
+
+	// missing dirs ahead of ./terminfo cost one probe each the first time
+	assert(probes > 3);
+
+	// after that only the file itself is probed
+	rc = ti_resolve_path("xterm-color", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(probes == 1);
+
+	// same for other names under a known subdir
+	rc = ti_resolve_path("xterm-kitty", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strcmp(path, "./terminfo/x/xterm-kitty") == 0);
+	assert(probes == 1);
+
+	// a new first letter costs one subdir probe and the file probe
+	rc = ti_resolve_path("minitel1", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strcmp(path, "./terminfo/m/minitel1") == 0);
+	assert(probes == 2);
+}
+
+void test_negative_lookups() {
+	char path[TI_FN_MAX];
+	int probes = -1;
+	int rc = ti_resolve_path("xterm-missing", path, sizeof(path), &probes);
+	printf("rc=%d probes=%d\n", rc, probes);
+	assert(rc == ENOENT);
+	assert(probes > 0);
+
+	struct ti_resolve_stats st;
+	ti_resolve_stats(&st);
+	unsigned long hits = st.negative_hits;
+
+	// missing names are remembered and cost no probes
+	rc = ti_resolve_path("xterm-missing", path, sizeof(path), &probes);
+	printf("rc=%d probes=%d\n", rc, probes);
+	assert(rc == ENOENT);
+	assert(probes == 0);
+
+	ti_resolve_stats(&st);
+	assert(st.negative_hits == hits + 1);
+
+	// loads go through the same resolver
+	int err;
+	assert(ti_load("xterm-missing", &err) == NULL);
+	assert(err == ENOENT);
+	ti_resolve_stats(&st);
+	assert(st.negative_hits == hits + 2);
+}
+
+// Names are found in hex subdirs, and in letter subdirs of the same dir.
+void test_hex_layout() {
+	setenv("TERMINFO", tmpdir, 1);
+
+	char path[TI_FN_MAX];
+	int probes = -1;
+	int rc = ti_resolve_path("xterm-hex", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strstr(path, "/78/xterm-hex"));
+
+	// a dir shared with a case sensitive system has letter subdirs too
+	rc = ti_resolve_path("mixed", path, sizeof(path), &probes);
+	printf("rc=%d path=%s probes=%d\n", rc, path, probes);
+	assert(rc == 0);
+	assert(strstr(path, "/m/mixed"));
+
+	// 'v' subdirs don't exist in either layout: dir state is known so
+	// this is one probe for each subdir, and none the next time
+	rc = ti_resolve_path("vt100", path, sizeof(path), &probes);
+	printf("rc=%d probes=%d\n", rc, probes);
+	assert(rc == ENOENT);
+	assert(probes == 2);
+	rc = ti_resolve_path("vt220", path, sizeof(path), &probes);
+	assert(rc == ENOENT);
+	assert(probes == 0);
+
+	int err;
+	ti_terminfo *ti = ti_load("xterm-hex", &err);
+	assert(ti != NULL);
+	assert(ti_getnumi(ti, ti_colors) == 8);
+	ti_free(ti);
+}
+
+// Changing the environment rebuilds the search path.
+void test_env_change() {
+	char path[TI_FN_MAX];
+	setenv("TERMINFO", "./terminfo", 1);
+	int rc = ti_resolve_path("xterm-hex", path, sizeof(path), NULL);
+	assert(rc == ENOENT);
+	rc = ti_resolve_path("xterm-new", path, sizeof(path), NULL);
+	assert(rc == 0);
+	assert(strcmp(path, "./terminfo/x/xterm-new") == 0);
+
+	unsetenv("TERM");
+	rc = ti_resolve_path(NULL, path, sizeof(path), NULL);
+	assert(rc == TI_ERR_TERM_NOT_SET);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// set up a terminfo dir using the hex layout
+	assert(mkdtemp(tmpdir));
+	snprintf(hexdir, sizeof(hexdir), "%s/78", tmpdir);
+	assert(mkdir(hexdir, 0700) == 0);
+	char fn[TI_FN_MAX + 16];
+	snprintf(fn, sizeof(fn), "%s/xterm-hex", hexdir);
+	char *target = realpath("./terminfo/x/xterm-color", NULL);
+	assert(symlink(target, fn) == 0);
+
+	// and a letter subdir next to it
+	snprintf(letterdir, sizeof(letterdir), "%s/m", tmpdir);
+	assert(mkdir(letterdir, 0700) == 0);
+	char mixed[TI_FN_MAX + 16];
+	snprintf(mixed, sizeof(mixed), "%s/mixed", letterdir);
+	assert(symlink(target, mixed) == 0);
+	free(target);
+
+	// search nonexistent dirs before the test terminfo dir
+	unsetenv("TERMINFO");
+	setenv("HOME", "/nonexistent", 1);
+	setenv("TERMINFO_DIRS", "/nonexistent/a:/nonexistent/b:./terminfo", 1);
+
+	test_resolve_path();
+	test_negative_lookups();
+	test_hex_layout();
+	test_env_change();
+
+	unlink(fn);
+	unlink(mixed);
+	rmdir(hexdir);
+	rmdir(letterdir);
+	rmdir(tmpdir);
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,55 @@
+/* ti_same_caps.inl */
+
+/*
+ * Capability comparison shared by the tests that load the same terminal in
+ * different ways. Include it after ti.c.
+ */
+
+// Assert two terminfo structs for the same terminal have the same
+// capabilities, whatever the way they were loaded.
+static void assert_same_caps(ti_terminfo *ti, ti_terminfo *mti) {
+	assert(strcmp(ti->term_names, mti->term_names) == 0);
+	assert(ti->bools_count == mti->bools_count);
+	assert(ti->nums_count == mti->nums_count);
+	assert(ti->strs_count == mti->strs_count);
+	assert(ti->ext_bools_count == mti->ext_bools_count);
+	assert(ti->ext_nums_count == mti->ext_nums_count);
+	assert(ti->ext_strs_count == mti->ext_strs_count);
+
+	for (int i = 0; i < ti->bools_count; i++)
+		assert(ti_getbooli(ti, i) == ti_getbooli(mti, i));
+	for (int i = 0; i < ti->nums_count; i++)
+		assert(ti_getnumi(ti, i) == ti_getnumi(mti, i));
+	for (int i = 0; i < ti->strs_count; i++) {
+		char *a = ti_getstri(ti, i), *b = ti_getstri(mti, i);
+		assert((a == NULL) == (b == NULL));
+		assert(!a || strcmp(a, b) == 0);
+	}
+
+	int types[] = {TI_BOOL, TI_NUM, TI_STR};
+	int counts[] = {ti->ext_bools_count, ti->ext_nums_count, ti->ext_strs_count};
+	for (int t = 0; t < 3; t++) {
+		for (int i = 0; i < counts[t]; i++) {
+			const char *name = ti_extname(ti, types[t], i);
+			assert(strcmp(name, ti_extname(mti, types[t], i)) == 0);
+		}
+		assert(ti_extname(mti, types[t], counts[t]) == NULL);
+	}
+	for (int i = 0; i < ti->ext_bools_count; i++)
+		assert(ti_getextbooli(ti, i) == ti_getextbooli(mti, i));
+	for (int i = 0; i < ti->ext_nums_count; i++)
+		assert(ti_getextnumi(ti, i) == ti_getextnumi(mti, i));
+	for (int i = 0; i < ti->ext_strs_count; i++) {
+		char *a = ti_getextstri(ti, i), *b = ti_getextstri(mti, i);
+		assert((a == NULL) == (b == NULL));
+		assert(!a || strcmp(a, b) == 0);
+	}
+
+	// lookups by name work on both
+	assert(ti_getnum(mti, "colors") == ti_getnum(ti, "colors"));
+	char *smxx = ti_getstr(ti, "smxx"), *msmxx = ti_getstr(mti, "smxx");
+	assert((smxx == NULL) == (msmxx == NULL));
+	assert(!smxx || strcmp(smxx, msmxx) == 0);
+}
+
+// vim: noexpandtab
@@ -0,0 +1,173 @@
+#define _XOPEN_SOURCE 700    // setenv
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <assert.h>
+
+// Check the names of the terminals defining cap, given in entry order.
+static void assert_defined_by(ti_scan *scan, const char *cap,
+                              const char **names) {
+	const int *entries;
+	int n = ti_scan_find(scan, cap, &entries);
+	printf("%s:", cap);
+	for (int i = 0; i < n; i++) printf(" %s", scan->entries[entries[i]].name);
+	printf("\n");
+
+	int i = 0;
+	for (; names[i]; i++) {
+		assert(i < n);
+		assert(strcmp(scan->entries[entries[i]].name, names[i]) == 0);
+	}
+	assert(i == n);
+}
+
+void test_scan(int nthreads) {
+	printf("nthreads=%d\n", nthreads);
+	int err = -1;
+	ti_scan *scan = ti_db_scan(nthreads, &err);
+	assert(scan != NULL);
+	assert(err == 0);
+
+	// entries are sorted by name and minitel1 is listed once even though
+	// it's in both the m/ and 6d/ subdirectories
+	const char *names[] = {
+		"minitel1", "xterm-badfile", "xterm-color", "xterm-kitty", "xterm-new",
+	};
+	assert(scan->nentries == 5);
+	for (int i = 0; i < 5; i++) {
+		printf("%s %s err=%d\n", scan->entries[i].name, scan->entries[i].path,
+		       scan->entries[i].err);
+		assert(strcmp(scan->entries[i].name, names[i]) == 0);
+		assert(strncmp(scan->entries[i].path, "./terminfo/", 11) == 0);
+	}
+
+	// parse failures are reported
+	assert(scan->nfailed == 1);
+	assert(scan->entries[1].err == TI_ERR_BAD_MAGIC);
+
+	// standard capabilities
+	assert_defined_by(scan, "cup", (const char *[]){
+		"minitel1", "xterm-color", "xterm-kitty", "xterm-new", NULL});
+	assert_defined_by(scan, "colors", (const char *[]){
+		"minitel1", "xterm-color", "xterm-kitty", "xterm-new", NULL});
+	assert_defined_by(scan, "hc", (const char *[]){NULL});
+
+	// extended capabilities
+	assert_defined_by(scan, "setrgbf", (const char *[]){"xterm-kitty", NULL});
+	assert_defined_by(scan, "Tc", (const char *[]){"xterm-kitty", NULL});
+	assert_defined_by(scan, "smxx", (const char *[]){
+		"xterm-kitty", "xterm-new", NULL});
+	assert_defined_by(scan, "NOTACAP", (const char *[]){NULL});
+
+	ti_scan_free(scan);
+}
+
+// Packed databases are scanned too, ahead of directories later in the
+// search path.
+void test_scan_packed() {
+	unsetenv("TERMINFO");
+	setenv("HOME", "/nonexistent", 1);
+	setenv("TERMINFO_DIRS", "./terminfo.tidb:./terminfo", 1);
+
+	ti_scan *scan = ti_db_scan(2, NULL);
+	assert(scan != NULL);
+
+	// the database wins for the names it has; the system paths searched
+	// after it may add more entries
+	const char *names[] = {
+		"minitel1", "xterm-badfile", "xterm-color", "xterm-kitty", "xterm-new",
+	};
+	const char *paths[] = {
+		"./terminfo.tidb", "./terminfo/x/xterm-badfile", "./terminfo.tidb",
+		"./terminfo.tidb", "./terminfo.tidb",
+	};
+	for (int k = 0; k < 5; k++) {
+		int i = 0;
+		while (i < scan->nentries && strcmp(scan->entries[i].name, names[k]))
+			i++;
+		assert(i < scan->nentries);
+		printf("%s %s err=%d\n", scan->entries[i].name, scan->entries[i].path,
+		       scan->entries[i].err);
+		assert(strcmp(scan->entries[i].path, paths[k]) == 0);
+		assert((scan->entries[i].err != 0) == (k == 1));
+	}
+	ti_scan_free(scan);
+}
+
+// Set the data length of the database slot of name.
+static void set_db_len(char *db, const char *name, uint32_t len) {
+	uint32_t nslots = ti_rd32(db + 8);
+	for (uint32_t j = 0; j < nslots; j++) {
+		char *slot = db + TI_DB_HDRSZ + j * TI_DB_SLOTSZ;
+		uint32_t name_off = ti_rd32(slot + 4);
+		if (name_off == 0 || strcmp(db + name_off, name) != 0) continue;
+		for (int k = 0; k < 4; k++) slot[12 + k] = len >> (8 * k);
+		return;
+	}
+	assert(0);
+}
+
+// Broken database entries give the same errors as broken files.
+void test_scan_packed_errors() {
+	static char db[65536];
+	FILE *in = fopen("./terminfo.tidb", "rb");
+	assert(in);
+	size_t len = fread(db, 1, sizeof(db), in);
+	fclose(in);
+	assert(len > 0 && len + TI_DATA_MAX + 1 <= sizeof(db));
+
+	// padding so the too long entry still ends inside the file
+	set_db_len(db, "minitel1", TI_DATA_MAX + 1);
+	set_db_len(db, "xterm-color", 0);
+	len += TI_DATA_MAX + 1;
+
+	char fn[] = "/tmp/ti_scan_test.XXXXXX";
+	int fd = mkstemp(fn);
+	assert(fd >= 0);
+	assert(write(fd, db, len) == (ssize_t)len);
+	close(fd);
+
+	unsetenv("TERMINFO");
+	setenv("HOME", "/nonexistent", 1);
+	setenv("TERMINFO_DIRS", fn, 1);
+	ti_scan *scan = ti_db_scan(1, NULL);
+	assert(scan != NULL);
+	int found = 0;
+	for (int i = 0; i < scan->nentries; i++) {
+		struct ti_scan_entry *e = &scan->entries[i];
+		if (strcmp(e->path, fn) != 0) continue;
+		printf("%s err=%d\n", e->name, e->err);
+		if (strcmp(e->name, "minitel1") == 0) {
+			assert(e->err == EFBIG);
+		} else if (strcmp(e->name, "xterm-color") == 0) {
+			assert(e->err == TI_ERR_NO_HEADER);
+		} else {
+			assert(e->err == 0);
+		}
+		found++;
+	}
+	assert(found == 4);
+	ti_scan_free(scan);
+	unlink(fn);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	// scan our test directory only
+	setenv("TERMINFO", "./terminfo", 1);
+
+	test_scan(1);
+	test_scan(4);
+	test_scan(0);
+	test_scan_packed();
+	test_scan_packed_errors();
+
+	return 0;
+}
+
+// vim: noexpandtab
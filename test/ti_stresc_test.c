@@ -0,0 +1,154 @@
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+static const int paths[] = {
+	STRESC_PATH_SCALAR,
+#ifdef STRESC_X86
+	STRESC_PATH_SSE2, STRESC_PATH_AVX2,
+#endif
+};
+#define NPATHS (int)(sizeof(paths) / sizeof(paths[0]))
+
+// Byte at a time escaping like ti_stresc() and tkbd_stresc() did before the
+// shared kernel.
+static size_t ref_stresc(char *buf, const char *str, size_t len, int flags) {
+	char *pb = buf;
+	for (size_t i = 0; i < len; i++) {
+		unsigned char c = str[i];
+		if (c >= ' ' && c <= '~' && !(c == '\\' && (flags & STRESC_BACKSLASH))) {
+			*pb++ = c;
+			continue;
+		}
+		*pb++ = '\\';
+		switch (c) {
+		case '\033': *pb++ = 'e'; break;
+		case '\t': *pb++ = 't'; break;
+		case '\n': *pb++ = 'n'; break;
+		case '\r': *pb++ = 'r'; break;
+		case '\\': *pb++ = '\\'; break;
+		case '\0':
+			if (flags & STRESC_NUL) {
+				*pb++ = '0';
+				break;
+			}
+			// fall through
+		default:
+			pb += sprintf(pb, "%03hho", c);
+		}
+	}
+	*pb = 0;
+	return pb - buf;
+}
+
+// Fill buf with mostly printable text, escape sequences and some high bytes.
+static void fill(char *buf, size_t len, unsigned int seed) {
+	for (size_t i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		unsigned int r = (seed >> 16) & 0xff;
+		buf[i] = (char)(r < 200 ? ' ' + r % 95 : r);
+	}
+}
+
+// Every path gives the reference output for any length and alignment.
+void test_paths() {
+	static char in[512], want[4 * 512 + 1], got[4 * 512 + 1];
+	fill(in, sizeof(in), 1);
+	for (int flags = 0; flags < 4; flags++) {
+		for (size_t off = 0; off < 40; off++) {
+			for (size_t len = 0; off + len <= sizeof(in); len += 1 + len / 4) {
+				size_t wn = ref_stresc(want, in + off, len, flags);
+				for (int p = 0; p < NPATHS; p++) {
+					size_t used;
+					size_t gn = stresc_kernel(got, sizeof(got), in + off, len,
+					                          &used, flags, paths[p]);
+					assert(used == len);
+					assert(gn == wn);
+					assert(memcmp(want, got, gn) == 0);
+				}
+			}
+		}
+	}
+
+	// every byte value
+	for (int c = 0; c < 256; c++) {
+		char ch = c;
+		for (int flags = 0; flags < 4; flags++) {
+			size_t wn = ref_stresc(want, &ch, 1, flags);
+			for (int p = 0; p < NPATHS; p++) {
+				size_t used;
+				size_t gn = stresc_kernel(got, 8, &ch, 1, &used, flags, paths[p]);
+				assert(gn == wn);
+				assert(memcmp(want, got, gn) == 0);
+			}
+		}
+	}
+}
+
+// ti_stresc() fills the buffer with whole escapes and terminates it.
+void test_stresc_bounded() {
+	char buf[64];
+	int n = ti_stresc(buf, "\033[1mbold\033[0m", sizeof(buf));
+	printf("n=%d buf=%s\n", n, buf);
+	assert(strcmp(buf, "\\e[1mbold\\e[0m") == 0);
+	assert(n == 14);
+
+	n = ti_stresc(buf, "ab\001cd", 5);
+	printf("n=%d buf=%s\n", n, buf);
+	assert(strcmp(buf, "ab") == 0);
+	n = ti_stresc(buf, "ab\001cd", 7);
+	assert(strcmp(buf, "ab\\001") == 0);
+	assert(n == 6);
+	n = ti_stresc(buf, "a\\b", sizeof(buf));
+	assert(strcmp(buf, "a\\b") == 0);
+
+	buf[0] = 'x';
+	assert(ti_stresc(buf, "abc", 0) == 0);
+	assert(buf[0] == 'x');
+	assert(ti_stresc(buf, "abc", 1) == 0);
+	assert(buf[0] == '\0');
+}
+
+// Escaping in small pieces gives the same output as all at once.
+void test_stresc_stream() {
+	static char in[2000], want[4 * 2000 + 1], got[4 * 2000 + 1];
+	fill(in, sizeof(in), 7);
+	int flags = TI_STRESC_BACKSLASH | TI_STRESC_NUL;
+	size_t wn = ref_stresc(want, in, sizeof(in), flags);
+
+	for (size_t bufsz = 4; bufsz < 100; bufsz += 7) {
+		ti_stresc_state st;
+		ti_stresc_init(&st, in, sizeof(in), flags);
+		size_t gn = 0;
+		while (st.len) {
+			size_t n = ti_stresc_next(&st, got + gn, bufsz);
+			assert(n > 0 && n <= bufsz);
+			gn += n;
+		}
+		assert(gn == wn);
+		assert(memcmp(want, got, gn) == 0);
+	}
+
+	// no room for the next escape: nothing consumed
+	ti_stresc_state st;
+	ti_stresc_init(&st, "\001", 1, 0);
+	assert(ti_stresc_next(&st, got, 3) == 0);
+	assert(st.len == 1);
+	assert(ti_stresc_next(&st, got, 4) == 4);
+	assert(st.len == 0);
+}
+
+int main(void) {
+	// make stdout line buffered
+	setvbuf(stdout, NULL, _IOLBF, -BUFSIZ);
+
+	test_paths();
+	test_stresc_bounded();
+	test_stresc_stream();
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -7,9 +7,10 @@
  *
  *
  */
-#define _XOPEN_SOURCE 700    // fileno
+#define _XOPEN_SOURCE 700    // mmap
 
 #include "ti.h"
+#include "stresc.inl"
 
 #include <stdint.h>
 #include <stdarg.h>
@@ -18,9 +19,14 @@
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
-#include <sys/unistd.h>
+#include <sys/mman.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+#include <time.h>
 
 /*
  * Capability name arrays are used to find the index of legacy format
@@ -102,117 +108,791 @@ const char * const ti_strnames[] = {
 	"memu", "box1",
 };
 
+
+/*
+ * Standard capability names are found with a perfect hash generated by
+ * tools/gencap-hash.sh from the same Caps data as the arrays above. A name's
+ * FNV-1a hash picks a displacement from ti_caphash_disp, and the mixed hash
+ * and displacement pick the only slot the name can occupy. Slots hold the
+ * capability type in the top four bits and its index below.
+ *
+ */
+
+#define TI_CAPHASH_BUCKETS 128
+#define TI_CAPHASH_SLOTS   1024
+
+// Capability name hash tables generated with tools/gencap-hash.sh
+// from 497 names (44 bool, 39 num, 414 str)
+static const uint16_t ti_caphash_disp[TI_CAPHASH_BUCKETS] = {
+	0x0000, 0x0000, 0x0003, 0x0005, 0x0001, 0x0003, 0x0001, 0x0000,
+	0x0000, 0x0002, 0x0006, 0x0001, 0x0007, 0x0001, 0x0000, 0x0003,
+	0x0000, 0x0001, 0x0000, 0x0000, 0x0004, 0x0004, 0x0000, 0x0001,
+	0x0002, 0x0003, 0x0000, 0x0001, 0x0000, 0x0000, 0x0002, 0x0000,
+	0x0000, 0x000f, 0x0000, 0x0002, 0x000e, 0x0004, 0x0002, 0x0002,
+	0x0002, 0x0005, 0x0002, 0x0006, 0x0000, 0x0000, 0x0000, 0x0009,
+	0x0000, 0x0000, 0x0007, 0x0002, 0x0003, 0x0006, 0x0001, 0x0006,
+	0x0004, 0x0000, 0x0000, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000,
+	0x0002, 0x0003, 0x0002, 0x0000, 0x0001, 0x0000, 0x0000, 0x0001,
+	0x0000, 0x0001, 0x0001, 0x0005, 0x0002, 0x0000, 0x0000, 0x000b,
+	0x0003, 0x0003, 0x0000, 0x0002, 0x000a, 0x0004, 0x0002, 0x0002,
+	0x000b, 0x0000, 0x0004, 0x0000, 0x0002, 0x0000, 0x0002, 0x0001,
+	0x0000, 0x0004, 0x0003, 0x0011, 0x0000, 0x0001, 0x0000, 0x0005,
+	0x0000, 0x0008, 0x000b, 0x0001, 0x0007, 0x0000, 0x0001, 0x0004,
+	0x0002, 0x000a, 0x0001, 0x0001, 0x0001, 0x000a, 0x0002, 0x0000,
+	0x0002, 0x0000, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0001,
+};
+static const uint16_t ti_caphash_slots[TI_CAPHASH_SLOTS] = {
+	0x30c4, 0x0000, 0x0000, 0x315c, 0x0000, 0x0000, 0x316e, 0x3011,
+	0x0000, 0x0000, 0x3077, 0x0000, 0x0000, 0x30ad, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x200f, 0x316a, 0x0000, 0x1005, 0x0000, 0x2000,
+	0x30c3, 0x0000, 0x0000, 0x0000, 0x316c, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x300f, 0x316f, 0x0000, 0x0000, 0x0000, 0x309b, 0x0000,
+	0x3023, 0x30e4, 0x0000, 0x0000, 0x301f, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x3041, 0x1023, 0x302f, 0x3073, 0x306f, 0x304f,
+	0x0000, 0x0000, 0x3019, 0x0000, 0x0000, 0x0000, 0x30aa, 0x0000,
+	0x0000, 0x0000, 0x318c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x100b, 0x30de, 0x30cd, 0x3198, 0x1012, 0x30af,
+	0x0000, 0x0000, 0x0000, 0x3158, 0x308c, 0x0000, 0x0000, 0x0000,
+	0x3007, 0x3076, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x302b,
+	0x3006, 0x0000, 0x0000, 0x302c, 0x3049, 0x3015, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x2004, 0x314e, 0x0000, 0x317a, 0x30f2,
+	0x0000, 0x3048, 0x1009, 0x3199, 0x101d, 0x0000, 0x0000, 0x0000,
+	0x314a, 0x306d, 0x30dd, 0x0000, 0x0000, 0x0000, 0x0000, 0x308f,
+	0x308e, 0x30fa, 0x2024, 0x0000, 0x0000, 0x0000, 0x30fb, 0x3072,
+	0x303c, 0x307e, 0x3140, 0x30ff, 0x0000, 0x3137, 0x303b, 0x0000,
+	0x0000, 0x303e, 0x1006, 0x310c, 0x3057, 0x3148, 0x3183, 0x0000,
+	0x313a, 0x0000, 0x0000, 0x30d0, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x300b, 0x3152, 0x1001, 0x101e, 0x0000, 0x3185, 0x0000, 0x0000,
+	0x0000, 0x30d7, 0x3134, 0x0000, 0x2026, 0x305b, 0x3042, 0x0000,
+	0x310b, 0x0000, 0x0000, 0x201c, 0x0000, 0x3168, 0x2015, 0x0000,
+	0x1000, 0x305f, 0x1010, 0x308a, 0x0000, 0x0000, 0x0000, 0x315e,
+	0x3037, 0x313b, 0x0000, 0x3119, 0x3177, 0x0000, 0x3082, 0x0000,
+	0x0000, 0x3163, 0x0000, 0x3115, 0x0000, 0x3027, 0x0000, 0x0000,
+	0x0000, 0x30c7, 0x3029, 0x3101, 0x305a, 0x0000, 0x2018, 0x30c0,
+	0x305e, 0x30f1, 0x0000, 0x0000, 0x30ce, 0x0000, 0x30bd, 0x201f,
+	0x2001, 0x0000, 0x101b, 0x3070, 0x0000, 0x0000, 0x0000, 0x1008,
+	0x0000, 0x0000, 0x3182, 0x318e, 0x0000, 0x307d, 0x2025, 0x315f,
+	0x1020, 0x3025, 0x0000, 0x3100, 0x3051, 0x0000, 0x0000, 0x3039,
+	0x0000, 0x3164, 0x0000, 0x0000, 0x200b, 0x3067, 0x3035, 0x30cc,
+	0x30bc, 0x3078, 0x2007, 0x3196, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1029, 0x30e8,
+	0x302d, 0x1013, 0x0000, 0x0000, 0x0000, 0x0000, 0x3127, 0x0000,
+	0x307b, 0x303d, 0x3008, 0x0000, 0x0000, 0x0000, 0x0000, 0x30fd,
+	0x0000, 0x304e, 0x3092, 0x3159, 0x1025, 0x0000, 0x0000, 0x3191,
+	0x0000, 0x0000, 0x0000, 0x302e, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x3096, 0x3026, 0x0000, 0x3071, 0x3193, 0x0000, 0x303a, 0x0000,
+	0x0000, 0x0000, 0x2008, 0x0000, 0x0000, 0x3005, 0x0000, 0x318b,
+	0x0000, 0x1028, 0x0000, 0x0000, 0x0000, 0x30ef, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2023, 0x3081, 0x312c, 0x0000,
+	0x30e5, 0x3016, 0x310e, 0x0000, 0x314f, 0x0000, 0x0000, 0x0000,
+	0x3033, 0x3192, 0x0000, 0x3176, 0x0000, 0x3173, 0x304c, 0x0000,
+	0x30ed, 0x30a7, 0x3110, 0x30f0, 0x0000, 0x0000, 0x319d, 0x100d,
+	0x3080, 0x0000, 0x0000, 0x0000, 0x3169, 0x200e, 0x317f, 0x30a5,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3188,
+	0x0000, 0x0000, 0x0000, 0x311a, 0x306a, 0x100f, 0x0000, 0x30ee,
+	0x0000, 0x0000, 0x0000, 0x3114, 0x30b7, 0x0000, 0x3151, 0x0000,
+	0x3053, 0x1004, 0x3157, 0x0000, 0x0000, 0x312f, 0x309d, 0x30d8,
+	0x0000, 0x3094, 0x0000, 0x301b, 0x0000, 0x30e1, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x30a2, 0x0000, 0x3136, 0x0000, 0x1007, 0x3144,
+	0x317b, 0x102a, 0x3052, 0x3103, 0x3017, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x306e, 0x313c, 0x313e, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x301d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x3093, 0x30a1, 0x0000, 0x30c9, 0x30ae, 0x100c, 0x3147,
+	0x3068, 0x3155, 0x0000, 0x0000, 0x3122, 0x300c, 0x306b, 0x3179,
+	0x101a, 0x0000, 0x0000, 0x30b0, 0x0000, 0x0000, 0x0000, 0x311e,
+	0x3086, 0x3165, 0x0000, 0x30eb, 0x0000, 0x30d9, 0x3090, 0x0000,
+	0x310f, 0x0000, 0x0000, 0x312e, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2009, 0x0000, 0x30c5, 0x0000, 0x30b8, 0x3139, 0x2003,
+	0x3142, 0x0000, 0x1026, 0x0000, 0x0000, 0x3149, 0x0000, 0x3104,
+	0x3187, 0x0000, 0x0000, 0x2021, 0x0000, 0x305c, 0x0000, 0x201a,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3195, 0x30df, 0x0000,
+	0x3118, 0x0000, 0x1003, 0x1015, 0x0000, 0x0000, 0x0000, 0x3190,
+	0x0000, 0x3162, 0x3160, 0x102b, 0x0000, 0x0000, 0x3012, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3130, 0x0000, 0x30d1, 0x308d,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x315a, 0x0000, 0x3075, 0x30b4, 0x3097, 0x0000, 0x0000, 0x3181,
+	0x0000, 0x30a4, 0x30f7, 0x3031, 0x3089, 0x318f, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x30e7, 0x0000, 0x30dc, 0x309c, 0x3087, 0x319a,
+	0x1016, 0x0000, 0x3132, 0x0000, 0x0000, 0x2006, 0x0000, 0x0000,
+	0x0000, 0x3055, 0x0000, 0x0000, 0x3166, 0x0000, 0x310a, 0x30f5,
+	0x318a, 0x0000, 0x0000, 0x3146, 0x30f8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x3116, 0x1011, 0x0000, 0x3172, 0x3131, 0x0000, 0x2013,
+	0x0000, 0x0000, 0x303f, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021,
+	0x0000, 0x0000, 0x30da, 0x3113, 0x30f4, 0x0000, 0x30b3, 0x300e,
+	0x0000, 0x309e, 0x3043, 0x0000, 0x0000, 0x0000, 0x30c1, 0x0000,
+	0x0000, 0x314b, 0x0000, 0x3000, 0x301e, 0x30a6, 0x0000, 0x0000,
+	0x3044, 0x3189, 0x0000, 0x30e2, 0x0000, 0x0000, 0x3001, 0x1019,
+	0x0000, 0x0000, 0x30a3, 0x3009, 0x0000, 0x3064, 0x0000, 0x311d,
+	0x3174, 0x318d, 0x3054, 0x0000, 0x0000, 0x0000, 0x100e, 0x3194,
+	0x0000, 0x314d, 0x0000, 0x30ec, 0x3102, 0x0000, 0x301c, 0x0000,
+	0x30e3, 0x0000, 0x30bf, 0x0000, 0x316b, 0x0000, 0x3063, 0x3161,
+	0x3098, 0x0000, 0x301a, 0x311c, 0x1022, 0x3020, 0x1002, 0x3154,
+	0x2016, 0x3175, 0x0000, 0x3184, 0x0000, 0x0000, 0x3112, 0x3021,
+	0x0000, 0x3034, 0x0000, 0x0000, 0x3084, 0x0000, 0x0000, 0x2012,
+	0x30c6, 0x3069, 0x201d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x3111, 0x1024, 0x3129, 0x1017, 0x0000, 0x0000, 0x0000,
+	0x3099, 0x30d6, 0x0000, 0x30cf, 0x0000, 0x2014, 0x0000, 0x0000,
+	0x30a9, 0x30d5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x312d,
+	0x0000, 0x0000, 0x30d4, 0x201b, 0x0000, 0x30b9, 0x101f, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3038, 0x0000, 0x3002, 0x0000,
+	0x0000, 0x3138, 0x1018, 0x3050, 0x3153, 0x3121, 0x30ea, 0x2011,
+	0x0000, 0x0000, 0x0000, 0x3150, 0x0000, 0x0000, 0x313f, 0x309f,
+	0x0000, 0x0000, 0x0000, 0x2002, 0x0000, 0x30bb, 0x0000, 0x0000,
+	0x0000, 0x2022, 0x0000, 0x0000, 0x0000, 0x3036, 0x305d, 0x3024,
+	0x3135, 0x0000, 0x3143, 0x3091, 0x315b, 0x313d, 0x200d, 0x3156,
+	0x3180, 0x0000, 0x312a, 0x30f6, 0x0000, 0x3045, 0x0000, 0x3178,
+	0x0000, 0x30fc, 0x3032, 0x3013, 0x0000, 0x0000, 0x0000, 0x30a0,
+	0x319b, 0x0000, 0x0000, 0x3047, 0x3060, 0x0000, 0x0000, 0x3197,
+	0x0000, 0x0000, 0x30e6, 0x0000, 0x0000, 0x317c, 0x0000, 0x100a,
+	0x3058, 0x0000, 0x0000, 0x30ca, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x30c2, 0x0000, 0x3120, 0x0000, 0x3145, 0x0000, 0x3088, 0x3028,
+	0x0000, 0x0000, 0x308b, 0x0000, 0x101c, 0x3171, 0x312b, 0x0000,
+	0x3004, 0x0000, 0x30d3, 0x0000, 0x0000, 0x307a, 0x314c, 0x0000,
+	0x2019, 0x2005, 0x30fe, 0x0000, 0x30be, 0x0000, 0x0000, 0x2017,
+	0x3061, 0x0000, 0x3095, 0x316d, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x3125, 0x30f9, 0x3003, 0x0000, 0x309a, 0x3141, 0x30b5,
+	0x3030, 0x3046, 0x0000, 0x0000, 0x319c, 0x0000, 0x200c, 0x0000,
+	0x0000, 0x3010, 0x0000, 0x0000, 0x304b, 0x0000, 0x0000, 0x3066,
+	0x0000, 0x3108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x1027, 0x3126, 0x307f, 0x3123, 0x0000, 0x3059,
+	0x0000, 0x0000, 0x0000, 0x3106, 0x3065, 0x3085, 0x0000, 0x3014,
+	0x0000, 0x3167, 0x0000, 0x0000, 0x0000, 0x3062, 0x0000, 0x0000,
+	0x302a, 0x3124, 0x0000, 0x300d, 0x0000, 0x30ba, 0x0000, 0x0000,
+	0x307c, 0x0000, 0x0000, 0x306c, 0x0000, 0x0000, 0x3128, 0x0000,
+	0x3170, 0x3040, 0x317d, 0x0000, 0x0000, 0x0000, 0x3109, 0x0000,
+	0x0000, 0x0000, 0x30b2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x200a, 0x0000, 0x0000, 0x3056, 0x3079, 0x0000,
+	0x0000, 0x304a, 0x0000, 0x0000, 0x0000, 0x311b, 0x315d, 0x30cb,
+	0x30b1, 0x0000, 0x30ab, 0x0000, 0x30a8, 0x3133, 0x2010, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1014, 0x30ac, 0x304d,
+	0x0000, 0x0000, 0x3105, 0x3186, 0x3074, 0x0000, 0x311f, 0x0000,
+	0x30e0, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x3107, 0x30b6,
+	0x30db, 0x201e, 0x0000, 0x310d, 0x300a, 0x3117, 0x0000, 0x0000,
+	0x30c8, 0x3022, 0x0000, 0x0000, 0x0000, 0x3083, 0x317e, 0x30d2,
+	0x0000, 0x30e9, 0x3018, 0x0000, 0x30f3, 0x0000, 0x0000, 0x0000,
+};
+
 #define TI_FN_MAX   1024   // 1K max filename length
 #define TI_DATA_MAX 16384  // 16K max terminfo file size
 
+// Read little endian 16-bit and 32-bit integers from raw terminfo data.
+// The data pointer doesn't need to be aligned.
+static inline int16_t ti_rd16(const char *p) {
+	const unsigned char *u = (const unsigned char *)p;
+	return (int16_t)(u[0] | (u[1] << 8));
+}
+
+static inline int32_t ti_rd32(const char *p) {
+	const unsigned char *u = (const unsigned char *)p;
+	return (int32_t)((uint32_t)u[0]       | (uint32_t)u[1] << 8 |
+	                 (uint32_t)u[2] << 16 | (uint32_t)u[3] << 24);
+}
+
+// Read numeric capability i from raw data holding sz byte values.
+static inline int32_t ti_rdnum(const char *p, int i, int sz) {
+	return (sz == 4) ? ti_rd32(p + i * 4) : ti_rd16(p + i * 2);
+}
+
 // Raw file information
 struct ti_file {
 	char *data;              // contents of file
 	int  len;                // number of bytes loaded in data
+	int  mmap;               // map file read-only instead of reading it
+	int  lazy;               // decode capabilities on access even when read
+	long off;                // offset of the data within the file
+
+	char fn[TI_FN_MAX];      // path the file was loaded from
+	dev_t dev;               // device and inode identifying the file
+	ino_t ino;
+	struct timespec mtime;   // file modification time when loaded
 };
 
-// Read an entire file into the ti_file struct.
-// Caller must free the string set in ti_file.data.
+// Read an entire file into the ti_file struct, or map it into memory when
+// the mmap member is set. Caller must release data with ti_file_free().
 static int ti_read_file(struct ti_file *f, const char *fn) {
-	FILE *fd = fopen(fn, "rb");
-	if (!fd) {
+	int fd = open(fn, O_RDONLY);
+	if (fd < 0) {
 		return errno;
 	}
 
 	struct stat st;
-	if (fstat(fileno(fd), &st) != 0) {
+	if (fstat(fd, &st) != 0) {
 		int err = errno;
-		fclose(fd);
+		close(fd);
 		return err;
 	}
 	f->len = st.st_size;
+	f->dev = st.st_dev;
+	f->ino = st.st_ino;
+	f->mtime = st.st_mtim;
 
 	if (f->len > TI_DATA_MAX) {
-		fclose(fd);
+		close(fd);
 		return EFBIG;
 	}
 
+	if (f->mmap) {
+		// mmap fails on empty files; leave data NULL and let the
+		// header check report the problem
+		f->data = NULL;
+		if (f->len > 0) {
+			void *m = mmap(NULL, f->len, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (m == MAP_FAILED) {
+				int err = errno;
+				close(fd);
+				return err;
+			}
+			f->data = m;
+		}
+		close(fd);
+		return 0;
+	}
+
 	f->data = malloc(f->len);
 	if (!f->data) {
-		fclose(fd);
+		close(fd);
 		return ENOMEM;
 	}
 
-	if (fread(f->data, 1, f->len, fd) != (size_t)f->len) {
-		free(f->data);
-		fclose(fd);
-		return EIO;
+	for (int n = 0; n < f->len; ) {
+		ssize_t rc = read(fd, f->data + n, f->len - n);
+		if (rc <= 0) {
+			free(f->data);
+			f->data = NULL;
+			close(fd);
+			return EIO;
+		}
+		n += rc;
 	}
 
-	fclose(fd);
+	close(fd);
 
 	return 0;
 }
 
-// Look for the terminfo file for the given term under the given path.
-static int ti_try_path(struct ti_file *f, const char *path, const char *term) {
-	char fn[TI_FN_MAX] = {0};
-	snprintf(fn, sizeof(fn), "%s/%c/%s", path, term[0], term);
+// Release memory allocated or mapped by ti_read_file().
+static void ti_file_free(struct ti_file *f) {
+	if (f->mmap) {
+		if (f->data) munmap(f->data, f->len);
+	} else {
+		free(f->data);
+	}
+	f->data = NULL;
+}
+
+/*
+ * Terminfo path resolution
+ *
+ * Terminfo files are searched for in $TERMINFO alone when set, otherwise in
+ * ~/.terminfo, each $TERMINFO_DIRS entry, and then the system paths below.
+ * Each directory stores files under a first letter subdirectory (x/xterm)
+ * or, on case-insensitive filesystems, a hex subdirectory (78/xterm), and a
+ * directory shared between systems may have both.
+ *
+ * The resolver remembers which search directories exist, which first
+ * character subdirectories exist in each, and which terminal names were not
+ * found anywhere. Repeated lookups then probe the filesystem only for files
+ * that can actually exist. Everything it knows is forgotten every
+ * TI_RESOLVE_TTL seconds and whenever TERMINFO, TERMINFO_DIRS, or HOME
+ * change.
+ *
+ */
+
+#ifndef TI_RESOLVE_TTL
+#define TI_RESOLVE_TTL   5    // seconds to trust cached directory state
+#endif
+#define TI_RESOLVE_DIRS  32   // max number of search directories
+#define TI_MISSING_MAX   256  // max number of cached missing names
+
+// System search paths
+// TODO: add compile time def to support other non-standard locations
+static const char * const ti_syspaths[] = {
+	"/etc/terminfo",
+	"/lib/terminfo",
+	"/usr/share/terminfo",
+	"/usr/share/lib/terminfo",
+	"/usr/local/share/terminfo",
+	NULL
+};
+
+// Environment variables that change where terminfo files are found.
+static const char * const ti_envvars[] = {
+	"TERMINFO", "TERMINFO_DIRS", "HOME",
+};
+#define TI_ENVVARS (int)(sizeof(ti_envvars) / sizeof(char*))
 
-	// try reading in normal dir structure
-	int rc = ti_read_file(f, fn);
-	if (rc == 0) return 0;
+// Snapshot of the ti_envvars values.
+struct ti_envsnap {
+	char *val[TI_ENVVARS];   // copies of variable values or NULL if unset
+	int   set;               // val member has been filled
+};
 
-	// fallback to case-insensitive filesystem path structure
-	snprintf(fn, sizeof(fn), "%s/%x/%s", path, term[0], term);
-	return ti_read_file(f, fn);
+// Compare two possibly NULL strings for equality.
+static int ti_streq(const char *a, const char *b) {
+	if (!a || !b) return a == b;
+	return strcmp(a, b) == 0;
 }
 
-// Find the terminfo file and load its contents into the ti_file struct.
-static int ti_load_data(struct ti_file *f, const char *term) {
-	int rc = 0;
+// Check whether the environment still matches the snapshot. When it doesn't,
+// the snapshot is updated and non-zero is returned.
+static int ti_env_changed(struct ti_envsnap *snap) {
+	int changed = !snap->set;
+	for (int i = 0; i < TI_ENVVARS && !changed; i++) {
+		changed = !ti_streq(snap->val[i], getenv(ti_envvars[i]));
+	}
+	if (!changed) return 0;
+
+	for (int i = 0; i < TI_ENVVARS; i++) {
+		const char *val = getenv(ti_envvars[i]);
+		free(snap->val[i]);
+		snap->val[i] = val ? strdup(val) : NULL;
+	}
+	snap->set = 1;
+	return 1;
+}
+
+// FNV-1a string hash.
+static uint32_t ti_strhash(const char *s) {
+	uint32_t h = 2166136261u;
+	for (; *s; s++) {
+		h ^= (unsigned char)*s;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+// Scramble the bits of a hash value (murmur3 finalizer).
+static uint32_t ti_hashmix(uint32_t h) {
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+// Directory and subdirectory states
+#define TI_DIR_UNKNOWN 0
+#define TI_DIR_MISSING 1
+#define TI_DIR_PRESENT 2
+#define TI_DIR_PACKED  3    // search path is a packed database file
+
+/*
+ * Packed terminfo databases
+ *
+ * A search path entry naming a regular file instead of a directory is read
+ * as a packed database built by tools/tipack. The file holds every entry of
+ * a terminfo directory and an open addressing hash table of terminal names,
+ * so looking up a name costs one hash probe in the mapped file instead of
+ * stat and open calls in the directory tree. All values are little endian:
+ *
+ *     header  "TIDB", uint32 version, uint32 slot count, uint32 name count
+ *     slots   slot count x {uint32 hash, name_off, data_off, data_len}
+ *     data    terminfo file contents and NUL terminated names
+ *
+ * Slot hashes are ti_strhash() of the name, the slot count is a power of
+ * two, and empty slots have a zero name_off. Aliases of a terminal share
+ * one copy of its data.
+ *
+ */
+
+#define TI_DB_MAGIC   "TIDB"
+#define TI_DB_VERSION 1
+#define TI_DB_HDRSZ   16
+#define TI_DB_SLOTSZ  16
+
+// Packed database mapping handed out by the resolver. Loads copy entries out
+// of it without the resolver lock, so it's unmapped when the last user lets go.
+struct ti_dbmap {
+	const char *db;
+	size_t size;
+	int refs;
+};
+
+// Cached knowledge about one search directory.
+struct ti_dir {
+	char   *path;
+	uint8_t state;           // TI_DIR_XXX state of the directory itself
+	uint8_t sub[2][256];     // TI_DIR_XXX state of letter, hex subdirs
+
+	// packed database mapping when state is TI_DIR_PACKED
+	const char *db;
+	size_t dbsize;
+	struct stat dbst;
+	struct ti_dbmap *map;    // resolver reference to db, NULL in scans
+};
+
+// Terminal entry found in a packed database.
+struct ti_dbent {
+	const char *data;        // entry within the database mapping
+	int len;
+	long off;                // offset of data within the database file
+	struct stat st;          // database file status
+	struct ti_dbmap *map;    // mapping data points into
+};
+
+static struct {
+	pthread_mutex_t lock;
+	struct ti_envsnap env;                // env the state was built under
+	time_t filled;                        // time the state was built
+	struct ti_dir dirs[TI_RESOLVE_DIRS];  // search dirs in search order
+	int ndirs;
+	unsigned gen;                         // bumped when dirs are cleared
+	int exclusive;                        // only $TERMINFO is searched
+	uint32_t missing[TI_MISSING_MAX];     // hashes of missing names
+	char    *missing_names[TI_MISSING_MAX];
+	int nmissing;
+	struct ti_resolve_stats stats;
+} ti_resolver = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+// Drop a reference to a packed database mapping.
+// Must be called with the resolver lock held.
+static void ti_dbmap_release(struct ti_dbmap *m) {
+	if (--m->refs > 0) return;
+	munmap((void *)m->db, m->size);
+	free(m);
+}
+
+// Forget everything known about directories and missing names.
+// Must be called with the resolver lock held.
+static void ti_resolver_clear(void) {
+	for (int i = 0; i < ti_resolver.ndirs; i++) {
+		struct ti_dir *d = &ti_resolver.dirs[i];
+		if (d->map) ti_dbmap_release(d->map);
+		free(d->path);
+	}
+	memset(ti_resolver.dirs, 0, sizeof(ti_resolver.dirs));
+	ti_resolver.ndirs = 0;
+	ti_resolver.gen++;
+	for (int i = 0; i < ti_resolver.nmissing; i++) {
+		free(ti_resolver.missing_names[i]);
+	}
+	ti_resolver.nmissing = 0;
+}
+
+static void ti_resolver_add_dir(const char *path) {
+	if (ti_resolver.ndirs >= TI_RESOLVE_DIRS) return;
+	struct ti_dir *d = &ti_resolver.dirs[ti_resolver.ndirs];
+	if (!(d->path = strdup(path))) return;
+	ti_resolver.ndirs++;
+}
+
+// Rebuild the search directory list from the environment when it changed or
+// the cached state expired. Must be called with the resolver lock held.
+static void ti_resolver_refresh(time_t now) {
+	int changed = ti_env_changed(&ti_resolver.env);
+	if (!changed && ti_resolver.ndirs &&
+	    now - ti_resolver.filled < TI_RESOLVE_TTL) {
+		return;
+	}
+
+	ti_resolver_clear();
+	ti_resolver.filled = now;
 
 	// if TERMINFO is set, no other directory should be searched
-	if (getenv("TERMINFO") && getenv("TERMINFO")[0] != '\0') {
-		return ti_try_path(f, getenv("TERMINFO"), term);
+	const char *terminfo = getenv("TERMINFO");
+	ti_resolver.exclusive = terminfo && terminfo[0] != '\0';
+	if (ti_resolver.exclusive) {
+		ti_resolver_add_dir(terminfo);
+		return;
 	}
 
 	// next, consider ~/.terminfo
 	if (getenv("HOME")) {
 		char fn[TI_FN_MAX] = {0};
 		snprintf(fn, sizeof(fn), "%s/.terminfo", getenv("HOME"));
-		rc = ti_try_path(f, fn, term);
-		if (rc == 0) return rc;
+		ti_resolver_add_dir(fn);
 	}
 
-	// next, TERMINFO_DIRS
+	// next, TERMINFO_DIRS; empty entries mean the system default
 	const char *dirs = getenv("TERMINFO_DIRS");
 	if (dirs) {
 		char buf[TI_FN_MAX] = {0};
 		snprintf(buf, sizeof(buf), "%s", dirs);
-		char *dir = strtok(buf, ":");
-		while (dir) {
-			const char *cdir = dir;
-			if (strcmp(cdir, "") == 0) {
-				cdir = "/usr/share/terminfo";
-			}
-			rc = ti_try_path(f, cdir, term);
-			if (rc == 0) return rc;
-			dir = strtok(0, ":");
+		for (char *dir = buf, *end; dir; dir = end) {
+			if ((end = strchr(dir, ':'))) *end++ = '\0';
+			ti_resolver_add_dir(*dir ? dir : "/usr/share/terminfo");
 		}
 	}
 
 	// search in system paths
-	// TODO: add compile time def to support other non-standard locations
-	char *paths[] = {
-		"/etc/terminfo",
-		"/lib/terminfo",
-		"/usr/share/terminfo",
-		"/usr/share/lib/terminfo",
-		"/usr/local/share/terminfo",
-		NULL
-	};
-	for (int i = 0; paths[i]; i++) {
-		rc = ti_try_path(f, paths[i], term);
-		if (rc == 0) return rc;
+	for (int i = 0; ti_syspaths[i]; i++) {
+		ti_resolver_add_dir(ti_syspaths[i]);
+	}
+}
+
+// Check whether term is cached as missing.
+static int ti_resolver_is_missing(const char *term, uint32_t h) {
+	for (int i = 0; i < ti_resolver.nmissing; i++) {
+		if (ti_resolver.missing[i] != h) continue;
+		if (strcmp(ti_resolver.missing_names[i], term) == 0) return 1;
 	}
+	return 0;
+}
 
-	return ENOENT; // file not found
+static void ti_resolver_set_missing(const char *term, uint32_t h) {
+	if (ti_resolver.nmissing >= TI_MISSING_MAX) return;
+	char *name = strdup(term);
+	if (!name) return;
+	ti_resolver.missing[ti_resolver.nmissing] = h;
+	ti_resolver.missing_names[ti_resolver.nmissing++] = name;
+}
+
+// Stat a path, counting the probe. Returns TI_DIR_PRESENT when it's a
+// directory, TI_DIR_MISSING otherwise.
+static int ti_probe_dir(const char *path, int *probes) {
+	struct stat st;
+	(*probes)++;
+	if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) return TI_DIR_PRESENT;
+	return TI_DIR_MISSING;
+}
+
+// Find the state of a search path, counting the probes. Directories are
+// TI_DIR_PRESENT. Files that hold a packed database are mapped into the dir
+// struct and are TI_DIR_PACKED. Anything else is TI_DIR_MISSING.
+static int ti_probe_search_path(struct ti_dir *d, int *probes) {
+	struct stat st;
+	(*probes)++;
+	if (stat(d->path, &st) != 0) return TI_DIR_MISSING;
+	if (S_ISDIR(st.st_mode)) return TI_DIR_PRESENT;
+	if (!S_ISREG(st.st_mode) || st.st_size < TI_DB_HDRSZ) return TI_DIR_MISSING;
+
+	int fd = open(d->path, O_RDONLY);
+	if (fd < 0) return TI_DIR_MISSING;
+	void *m = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (m == MAP_FAILED) return TI_DIR_MISSING;
+
+	const char *db = m;
+	uint32_t nslots = ti_rd32(db + 8);
+	if (memcmp(db, TI_DB_MAGIC, 4) != 0 ||
+	    ti_rd32(db + 4) != TI_DB_VERSION ||
+	    nslots == 0 || (nslots & (nslots - 1)) ||
+	    nslots > (st.st_size - TI_DB_HDRSZ) / TI_DB_SLOTSZ) {
+		munmap(m, st.st_size);
+		return TI_DIR_MISSING;
+	}
+
+	d->db = db;
+	d->dbsize = st.st_size;
+	d->dbst = st;
+	return TI_DIR_PACKED;
+}
+
+// Look up term in a packed database. Returns non-zero and fills in ent when
+// found. Entries pointing outside the file are treated as missing.
+static int ti_db_find(struct ti_dir *d, const char *term, uint32_t h,
+                      struct ti_dbent *ent) {
+	uint32_t nslots = ti_rd32(d->db + 8);
+	for (uint32_t n = 0, j = h & (nslots - 1); n < nslots;
+	     n++, j = (j + 1) & (nslots - 1)) {
+		const char *slot = d->db + TI_DB_HDRSZ + j * TI_DB_SLOTSZ;
+		uint32_t name_off = ti_rd32(slot + 4);
+		if (name_off == 0) break;
+		if ((uint32_t)ti_rd32(slot) != h) continue;
+
+		uint32_t off = ti_rd32(slot + 8), len = ti_rd32(slot + 12);
+		if (name_off >= d->dbsize || off > d->dbsize ||
+		    len > d->dbsize - off || len > TI_DATA_MAX) {
+			break;
+		}
+		const char *name = d->db + name_off;
+		size_t max = d->dbsize - name_off;
+		if (strnlen(name, max) == max || strcmp(name, term) != 0) continue;
+
+		ent->data = d->db + off;
+		ent->len = len;
+		ent->off = off;
+		ent->st = d->dbst;
+		ent->map = d->map;
+		return 1;
+	}
+	return 0;
+}
+
+// Find the state of the letter (layout 0) or hex (layout 1) subdirectory for
+// the first character c of a terminal name, probing it when unknown.
+static int ti_subdir_state(struct ti_dir *d, int layout, unsigned char c,
+                           int *probes) {
+	uint8_t *state = &d->sub[layout][c];
+	if (*state == TI_DIR_UNKNOWN) {
+		char fn[TI_FN_MAX];
+		if (layout == 0) snprintf(fn, sizeof(fn), "%s/%c", d->path, c);
+		else             snprintf(fn, sizeof(fn), "%s/%x", d->path, c);
+		*state = ti_probe_dir(fn, probes);
+	}
+	return *state;
+}
+
+// Probe the state of a resolver search dir. Packed databases get a reference
+// counted handle so loads can copy entries out of them without the lock.
+static int ti_resolver_probe_dir(struct ti_dir *d, int *probes) {
+	int state = ti_probe_search_path(d, probes);
+	if (state != TI_DIR_PACKED) return state;
+	if (!(d->map = malloc(sizeof(struct ti_dbmap)))) {
+		munmap((void *)d->db, d->dbsize);
+		d->db = NULL;
+		return TI_DIR_MISSING;
+	}
+	d->map->db = d->db;
+	d->map->size = d->dbsize;
+	d->map->refs = 1;
+	return state;
+}
+
+// Find the next candidate for term at or after search position *pos, which
+// is a dir index times two plus the subdir layout, probing directories on the
+// way. The candidate path is written to fn, and ent is filled in for entries
+// of packed databases. Returns zero when there are no more candidates.
+// Must be called with the resolver lock held.
+static int ti_resolve_next(const char *term, uint32_t h, int *pos, char *fn,
+                           size_t fnsz, struct ti_dbent *ent, int *probes) {
+	unsigned char c = term[0];
+	ent->map = NULL;
+	for (; *pos < ti_resolver.ndirs * 2; (*pos)++) {
+		struct ti_dir *d = &ti_resolver.dirs[*pos / 2];
+		int l = *pos % 2;
+		if (d->state == TI_DIR_UNKNOWN) {
+			d->state = ti_resolver_probe_dir(d, probes);
+		}
+		if (d->state == TI_DIR_MISSING) continue;
+
+		// packed databases are already mapped; probe the hash table
+		if (d->state == TI_DIR_PACKED) {
+			if (l) continue;
+			(*probes)++;
+			if (!ti_db_find(d, term, h, ent)) continue;
+			snprintf(fn, fnsz, "%s", d->path);
+			(*pos)++;
+			return 1;
+		}
+
+		// a dir may hold both layouts, as when it's shared between
+		// systems, so each char checks both; missing subdirs are
+		// remembered and cost nothing after the first lookup
+		if (ti_subdir_state(d, l, c, probes) != TI_DIR_PRESENT) continue;
+
+		if (l == 0) snprintf(fn, fnsz, "%s/%c/%s", d->path, c, term);
+		else        snprintf(fn, fnsz, "%s/%x/%s", d->path, c, term);
+		(*probes)++;
+		(*pos)++;
+		return 1;
+	}
+	return 0;
+}
+
+// Search function called with each candidate file path, or with the path of
+// a packed database and the entry found in it. Returns 0 when the file was
+// found or an errno value. Called without the resolver lock.
+typedef int (*ti_probe_fn)(const char *fn, const struct ti_dbent *ent,
+                           void *arg);
+
+// Find the terminfo file for term and call probe with each candidate path
+// that can exist until it succeeds. The found path is copied to fn.
+//
+// Candidates are picked under the resolver lock, but the lock is dropped
+// while probe reads them so a slow filesystem only holds up this lookup.
+static int ti_resolve(const char *term, char *fn, size_t fnsz,
+                      ti_probe_fn probe, void *arg, int *probes) {
+	int nprobes = 0, rc = ENOENT, err = 0, pos = 0;
+	uint32_t h = ti_strhash(term);
+
+	pthread_mutex_lock(&ti_resolver.lock);
+	ti_resolver_refresh(time(NULL));
+	ti_resolver.stats.resolves++;
+	unsigned gen = ti_resolver.gen;
+
+	if (ti_resolver_is_missing(term, h)) {
+		ti_resolver.stats.negative_hits++;
+		goto done;
+	}
+
+	struct ti_dbent ent;
+	while (rc && ti_resolve_next(term, h, &pos, fn, fnsz, &ent, &nprobes)) {
+		struct ti_dbmap *map = ent.map;
+		if (map) map->refs++;
+		pthread_mutex_unlock(&ti_resolver.lock);
+		rc = probe(fn, map ? &ent : NULL, arg);
+		pthread_mutex_lock(&ti_resolver.lock);
+		if (map) ti_dbmap_release(map);
+		if (rc && rc != ENOENT && rc != ENOTDIR) err = rc;
+	}
+
+	if (rc == 0) goto done;
+
+	// files that exist but failed to load aren't missing, and neither is
+	// anything looked up in dirs that were dropped meanwhile
+	if (err) {
+		if (ti_resolver.exclusive) rc = err;
+	} else if (gen == ti_resolver.gen) {
+		ti_resolver_set_missing(term, h);
+	}
+
+done:
+	ti_resolver.stats.probes += nprobes;
+	pthread_mutex_unlock(&ti_resolver.lock);
+	if (probes) *probes = nprobes;
+	return rc ? rc : 0;
+}
+
+static int ti_probe_access(const char *fn, const struct ti_dbent *ent,
+                           void *arg) {
+	(void)arg;
+	if (ent) return 0;
+	return access(fn, R_OK) == 0 ? 0 : errno;
+}
+
+int ti_resolve_path(const char *termname, char *path, size_t pathsz,
+                    int *probes) {
+	if (probes) *probes = 0;
+	if (!termname) termname = getenv("TERM");
+	if (!termname) return TI_ERR_TERM_NOT_SET;
+
+	char fn[TI_FN_MAX] = {0};
+	int rc = ti_resolve(termname, fn, sizeof(fn), ti_probe_access, NULL,
+	                    probes);
+	if (rc == 0 && path && pathsz) snprintf(path, pathsz, "%s", fn);
+	return rc;
+}
+
+void ti_resolve_stats(struct ti_resolve_stats *stats) {
+	pthread_mutex_lock(&ti_resolver.lock);
+	*stats = ti_resolver.stats;
+	pthread_mutex_unlock(&ti_resolver.lock);
+}
+
+void ti_resolve_reset(void) {
+	pthread_mutex_lock(&ti_resolver.lock);
+	ti_resolver_clear();
+	memset(&ti_resolver.stats, 0, sizeof(ti_resolver.stats));
+	pthread_mutex_unlock(&ti_resolver.lock);
+}
+
+static int ti_probe_read(const char *fn, const struct ti_dbent *ent,
+                         void *arg) {
+	struct ti_file *f = arg;
+	if (!ent) return ti_read_file(f, fn);
+
+	// copy entries out of packed databases since the database mapping
+	// goes away when the resolver state is refreshed
+	f->data = malloc(ent->len);
+	if (!f->data) return ENOMEM;
+	memcpy(f->data, ent->data, ent->len);
+	f->len = ent->len;
+	f->off = ent->off;
+	f->dev = ent->st.st_dev;
+	f->ino = ent->st.st_ino;
+	f->mtime = ent->st.st_mtim;
+	if (f->mmap) {
+		f->mmap = 0;
+		f->lazy = 1;
+	}
+	return 0;
+}
+
+// Find the terminfo file and load its contents into the ti_file struct.
+static int ti_load_data(struct ti_file *f, const char *term) {
+	return ti_resolve(term, f->fn, sizeof(f->fn), ti_probe_read, f, NULL);
 }
 
 // Terminfo magic number byte values.
@@ -222,35 +902,64 @@ static int ti_load_data(struct ti_file *f, const char *term) {
 #define TI_MAGIC       0432
 #define TI_MAGIC_32BIT 01036
 
-// TODO: big endian arch. terminfo files are always structured little endian.
-ti_terminfo *ti_load(const char *termname, int *err) {
-	if (!termname) termname = getenv("TERM");
-	if (!termname) {
-		if (err) *err = TI_ERR_TERM_NOT_SET;
-		return NULL;
+// Get the name of the i'th extended capability counting all types.
+static const char *ti_extname_at(ti_terminfo *ti, int i) {
+	if (ti->ext_names) {
+		return ti->ext_names[i];
 	}
+	const char *offs = ti->raw_ext_stroffs + ti->ext_strs_count * 2;
+	return ti->raw_ext_nametbl + ti_rd16(offs + i * 2);
+}
 
-	struct ti_file f = {0};
-	int rc = ti_load_data(&f, termname);
-	if (rc) {
-		if (err) *err = rc;
-		return NULL;
+// Build the open addressing hash index used to find extended capabilities
+// by name. The table is kept at most half full. Returns zero or ENOMEM.
+static int ti_index_ext_names(ti_terminfo *ti) {
+	int n = 2;
+	while (n < ti->ext_names_count * 2) n <<= 1;
+	ti->ext_hash = calloc(n, sizeof(uint16_t));
+	if (!ti->ext_hash) return ENOMEM;
+	ti->ext_hash_mask = n - 1;
+	for (int i = 0; i < ti->ext_names_count; i++) {
+		uint32_t j = ti_strhash(ti_extname_at(ti, i)) & ti->ext_hash_mask;
+		while (ti->ext_hash[j]) j = (j + 1) & ti->ext_hash_mask;
+		ti->ext_hash[j] = i + 1;
 	}
+	return 0;
+}
 
+// Parse the terminfo data loaded into f and set up a new ti_terminfo struct
+// in a zeroed allocation of size bytes. The ti_terminfo takes ownership of the
+// file data, including on error.
+//
+// When the file is mapped, capability arrays are not allocated and values are
+// decoded from the raw data on access. All offsets are still validated here so
+// the accessors can trust them.
+static ti_terminfo *ti_parse(struct ti_file *f, size_t size, int *err) {
 	// if data size is less than fixed header we got problems
 	// exit now before allocating a bunch of other stuff
-	if (f.len < (int)(6 * sizeof(int16_t))) {
+	if (f->len < (int)(6 * sizeof(int16_t))) {
 		if (err) *err = TI_ERR_NO_HEADER;
+		ti_file_free(f);
 		return NULL;
 	}
 
 	// alloc and initialize term struct
-	ti_terminfo *ti = calloc(1, sizeof(ti_terminfo));
-	ti->data = f.data;
-	ti->len = f.len;
+	ti_terminfo *ti = calloc(1, size);
+	if (!ti) {
+		if (err) *err = ENOMEM;
+		ti_file_free(f);
+		return NULL;
+	}
+	ti->data = f->data;
+	ti->len = f->len;
+	if (f->mmap) ti->flags |= TI_F_MMAP;
 
-	// pointer to current position in data
+	// decode capabilities on access instead of copying them
+	const int lazy = f->mmap || f->lazy;
+
+	// pointer to current position in data and end of data
 	char *p = ti->data;
+	const char *end = ti->data + ti->len;
 
 	// copy header data into struct
 	struct {
@@ -283,43 +992,57 @@ ti_terminfo *ti_load(const char *termname, int *err) {
 	// size in bytes of numeric capabilities stored in data
 	const int numsz = (h.magic == TI_MAGIC_32BIT)
 		? sizeof(int32_t) : sizeof(int16_t);
+	ti->numsz = numsz;
+
+	// make sure the fixed size sections fit before reading from them
+	if (p + h.nums_count * numsz + h.stroffs_count * 2 > end) {
+		if (err) *err = TI_ERR_BAD_STRTBL;
+		ti_free(ti);
+		return NULL;
+	}
 
 	// copy numeric capabilities into newly allocated array, converting from
 	// 16-bit to 32-bit values if needed
-	ti->nums = malloc(h.nums_count * sizeof(int32_t));
-	if (numsz == sizeof(int32_t)) {
-		memcpy(ti->nums, p, h.nums_count * sizeof(int32_t));
+	if (lazy) {
+		ti->raw_nums = p;
 	} else {
+		ti->nums = malloc(h.nums_count * sizeof(int32_t));
 		for (int i = 0; i < h.nums_count; i++)
-			ti->nums[i] = ((int16_t*)p)[i];
+			ti->nums[i] = ti_rdnum(p, i, numsz);
 	}
 	ti->nums_count = h.nums_count;
 	p += (h.nums_count * numsz);
 
 	// convert string capability offsets into pointers to strtbl
-	ti->strs = calloc(h.stroffs_count, sizeof(char*));
 	ti->strs_count = h.stroffs_count;
-	int16_t *stroffs = (int16_t*)p;
+	char *stroffs = p;
 	p += (h.stroffs_count * sizeof(int16_t));
+	if (lazy) {
+		ti->raw_stroffs = stroffs;
+		ti->raw_strtbl = p;
+	} else {
+		ti->strs = calloc(h.stroffs_count, sizeof(char*));
+	}
 	for (int i = 0; i < h.stroffs_count; i++) {
-		if (stroffs[i] < 0) continue;
-		if (stroffs[i] >= h.strtbl_len) {
+		int16_t off = ti_rd16(stroffs + i * 2);
+		if (off < 0) continue;
+		if (off >= h.strtbl_len) {
 			if (err) *err = TI_ERR_BAD_STROFF;
 			ti_free(ti);
 			return NULL;
 		}
-		ti->strs[i] = p + stroffs[i];
+		if (!lazy) ti->strs[i] = p + off;
 	}
 	p += h.strtbl_len;
 
 	// make sure all of the above pointers point within the loaded data;
 	// if not the terminfo file is corrupt
 	int data_len = p - ti->data;
-	if (data_len > f.len) {
+	if (data_len > f->len) {
 		if (err) *err = TI_ERR_BAD_STRTBL;
 		ti_free(ti);
 		return NULL;
-	} else if (data_len == f.len) {
+	} else if (data_len == f->len) {
 		// no extended caps after legacy caps, return now
 		if (err) *err = 0;
 		return ti;
@@ -334,6 +1057,11 @@ ti_terminfo *ti_load(const char *termname, int *err) {
 		int16_t  strtbl_num;     // count strs in strtbl including names
 		int16_t  strtbl_len;     // total size of strtbl
 	} h2;
+	if (p + sizeof(h2) > end) {
+		if (err) *err = TI_ERR_BAD_STRTBL;
+		ti_free(ti);
+		return NULL;
+	}
 	memcpy(&h2, p, sizeof(h2));
 	p += sizeof(h2);
 
@@ -346,70 +1074,526 @@ ti_terminfo *ti_load(const char *termname, int *err) {
 	ti->ext_bools = (int8_t*)p;
 	p += h2.bools_count + (h2.bools_count % 2); // alignment
 
+	// make sure the fixed size sections fit before reading from them
+	if (p + h2.nums_count * numsz +
+	    (h2.stroffs_count + ti->ext_names_count) * 2 > end) {
+		if (err) *err = TI_ERR_BAD_STRTBL;
+		ti_free(ti);
+		return NULL;
+	}
+
 	// copy extended numeric caps into newly allocated array, converting from
 	// 16-bit to 32-bit values if needed
-	ti->ext_nums = malloc(h2.nums_count * sizeof(int32_t));
-	if (numsz == sizeof(int32_t)) {
-		memcpy(ti->ext_nums, p, h2.nums_count * sizeof(int32_t));
+	if (lazy) {
+		ti->raw_ext_nums = p;
 	} else {
+		ti->ext_nums = malloc(h2.nums_count * sizeof(int32_t));
 		for (int i = 0; i < h2.nums_count; i++)
-			ti->ext_nums[i] = ((int16_t*)p)[i];
+			ti->ext_nums[i] = ti_rdnum(p, i, numsz);
 	}
 	p += (h2.nums_count * numsz);
 
 	// convert string capability offsets into pointers to strtbl
-	stroffs = (int16_t*)p;
+	stroffs = p;
 	p += ((h2.stroffs_count + ti->ext_names_count) * sizeof(int16_t));
 	char *strtbl = p;
-	ti->ext_strs = calloc(h2.stroffs_count, sizeof(char*));
+	if (lazy) {
+		ti->raw_ext_stroffs = stroffs;
+		ti->raw_ext_strtbl = strtbl;
+	} else {
+		ti->ext_strs = calloc(h2.stroffs_count, sizeof(char*));
+	}
 	for (int i = 0; i < h2.stroffs_count; i++) {
-		if (stroffs[i] < 0) continue;  // extended strings can be null
-		if (stroffs[i] >= h2.strtbl_len) {
+		int16_t off = ti_rd16(stroffs + i * 2);
+		if (off < 0) continue;  // extended strings can be null
+		if (off >= h2.strtbl_len) {
 			if (err) *err = TI_ERR_BAD_STROFF;
 			ti_free(ti);
 			return NULL;
 		}
-		ti->ext_strs[i] = strtbl + stroffs[i];
-		p = ti->ext_strs[i] + strlen(ti->ext_strs[i]) + 1;
+		if (!lazy) ti->ext_strs[i] = strtbl + off;
+		p = strtbl + off + strlen(strtbl + off) + 1;
+	}
+
+
+	// convert name offsets into pointers to strtbl
+	char *nameoffs = stroffs + h2.stroffs_count * 2;
+	int nametbl_len = h2.strtbl_len - (p - strtbl);
+
+	// validate offsets and calculate pointers from offsets
+	if (lazy) {
+		ti->raw_ext_nametbl = p;
+	} else {
+		ti->ext_names = calloc(ti->ext_names_count, sizeof(char*));
+	}
+	for (int i = 0; i < ti->ext_names_count; i++) {
+		int16_t off = ti_rd16(nameoffs + i * 2);
+		if (off < 0 || off >= nametbl_len) {
+			if (err) *err = TI_ERR_BAD_STROFF;
+			ti_free(ti);
+			return NULL;
+		}
+		if (!lazy) ti->ext_names[i] = p + off;
+	}
+
+	// set up bool, num, and str name array pointers to their positions in
+	// the overall name pointers array
+	if (!lazy) {
+		ti->ext_bool_names = ti->ext_names;
+		ti->ext_num_names = ti->ext_bool_names + ti->ext_bools_count;
+		ti->ext_str_names = ti->ext_num_names + ti->ext_nums_count;
+	}
+
+	int rc = ti_index_ext_names(ti);
+	if (rc) {
+		if (err) *err = rc;
+		ti_free(ti);
+		return NULL;
+	}
+
+	if (err) *err = 0;
+	return ti;
+}
+
+// Find and parse the terminfo file for termname, reading or mapping it
+// according to the mmap member of f. The size argument gives the number of
+// bytes to allocate for the returned struct, which may be embedded at the
+// start of a larger struct. On return f describes the file that was loaded.
+static ti_terminfo *ti_load_file(struct ti_file *f, const char *termname,
+                                 size_t size, int *err) {
+	if (!termname) termname = getenv("TERM");
+	if (!termname) {
+		if (err) *err = TI_ERR_TERM_NOT_SET;
+		return NULL;
+	}
+
+	int rc = ti_load_data(f, termname);
+	if (rc) {
+		if (err) *err = rc;
+		return NULL;
+	}
+
+	return ti_parse(f, size, err);
+}
+
+
+/*
+ * Builtin terminfo entries
+ *
+ * Pre-parsed, read-only terminfo images can be compiled into the library with
+ * tools/gencap-builtin. Define TI_BUILTIN as the quoted name of the generated
+ * file to include it; see the builtin target in the Makefile.
+ *
+ */
+
+#ifdef TI_BUILTIN
+#include TI_BUILTIN
+#else
+static const ti_terminfo * const ti_builtins[] = { NULL };
+#endif
+
+// Check whether name is one of the "|" separated names in term_names. The
+// last field is a description unless it's the only one.
+static int ti_has_name(const char *term_names, const char *name) {
+	size_t n = strlen(name);
+	for (const char *p = term_names;;) {
+		const char *end = strchr(p, '|');
+		if (!end) return p == term_names && strcmp(p, name) == 0;
+		if ((size_t)(end - p) == n && strncmp(p, name, n) == 0) return 1;
+		p = end + 1;
+	}
+}
+
+ti_terminfo *ti_load_builtin(const char *termname, int *err) {
+	if (!termname) termname = getenv("TERM");
+	if (!termname) {
+		if (err) *err = TI_ERR_TERM_NOT_SET;
+		return NULL;
+	}
+
+	for (int i = 0; ti_builtins[i]; i++) {
+		if (!ti_has_name(ti_builtins[i]->term_names, termname)) continue;
+		if (err) *err = 0;
+		return (ti_terminfo *)ti_builtins[i];
+	}
+
+	if (err) *err = ENOENT;
+	return NULL;
+}
+
+// Find the builtin entry to use for termname. Builtin entries are used
+// before searching the terminfo database unless TERMINFO is set, in which
+// case they're used only when the search didn't find a file.
+static ti_terminfo *ti_builtin_for(const char *termname, int searched) {
+	if (!termname || !ti_builtins[0]) return NULL;
+	const char *terminfo = getenv("TERMINFO");
+	int override = terminfo && terminfo[0] != '\0';
+	if (override != searched) return NULL;
+	return ti_load_builtin(termname, NULL);
+}
+
+// Pack a lazily decoded terminfo struct into a single allocation
+// holding the struct, the decoded numeric capabilities, the extended name
+// index, and a copy of the file data. String capabilities and extended names
+// stay 16-bit offsets into the data and are decoded on access. The source
+// struct is freed.
+static ti_terminfo *ti_compact(ti_terminfo *ti, int *err) {
+	assert(!ti->strs && !ti->ext_names);
+
+	size_t nums = ti->nums_count * sizeof(int32_t);
+	size_t ext_nums = ti->ext_nums_count * sizeof(int32_t);
+	size_t hash = ti->ext_hash ? (ti->ext_hash_mask + 1) * sizeof(uint16_t) : 0;
+	size_t size = sizeof(ti_terminfo) + nums + ext_nums + hash + ti->len;
+
+	ti_terminfo *c = malloc(size);
+	if (!c) {
+		if (err) *err = ENOMEM;
+		ti_free(ti);
+		return NULL;
+	}
+	memset(c, 0, sizeof(ti_terminfo));
+	c->flags = TI_F_COMPACT;
+
+	// numbers first to keep them aligned, then the hash index and the data
+	char *p = (char *)(c + 1);
+	c->nums = (int32_t *)p;
+	c->nums_count = ti->nums_count;
+	for (int i = 0; i < ti->nums_count; i++)
+		c->nums[i] = ti_getnumi(ti, i);
+	p += nums;
+
+	c->ext_nums = (int32_t *)p;
+	c->ext_nums_count = ti->ext_nums_count;
+	for (int i = 0; i < ti->ext_nums_count; i++)
+		c->ext_nums[i] = ti_getextnumi(ti, i);
+	p += ext_nums;
+
+	if (hash) {
+		c->ext_hash = (uint16_t *)p;
+		c->ext_hash_mask = ti->ext_hash_mask;
+		memcpy(c->ext_hash, ti->ext_hash, hash);
+		p += hash;
+	}
+
+	c->data = p;
+	c->len = ti->len;
+	memcpy(c->data, ti->data, ti->len);
+
+	// point everything else at the same place in the copied data
+	#define TI_REBASE(m) \
+		c->m = ti->m ? (void *)(c->data + ((const char *)ti->m - ti->data)) : NULL
+	TI_REBASE(term_names);
+	TI_REBASE(bools);
+	TI_REBASE(ext_bools);
+	TI_REBASE(raw_stroffs);
+	TI_REBASE(raw_strtbl);
+	TI_REBASE(raw_ext_stroffs);
+	TI_REBASE(raw_ext_strtbl);
+	TI_REBASE(raw_ext_nametbl);
+	#undef TI_REBASE
+
+	c->bools_count = ti->bools_count;
+	c->strs_count = ti->strs_count;
+	c->ext_bools_count = ti->ext_bools_count;
+	c->ext_strs_count = ti->ext_strs_count;
+	c->ext_names_count = ti->ext_names_count;
+	c->numsz = ti->numsz;
+
+	ti_free(ti);
+	if (err) *err = 0;
+	return c;
+}
+
+// How ti_load_any() loads terminfo files
+#define TI_LOAD_READ    0
+#define TI_LOAD_MMAP    1
+#define TI_LOAD_COMPACT 2
+
+// Load a terminfo struct from the builtin entries or the database.
+static ti_terminfo *ti_load_any(const char *termname, int how, int *err) {
+	if (!termname) termname = getenv("TERM");
+
+	ti_terminfo *ti = ti_builtin_for(termname, 0);
+	if (!ti) {
+		int rc;
+		struct ti_file f = {0};
+		f.mmap = (how == TI_LOAD_MMAP);
+		f.lazy = (how == TI_LOAD_COMPACT);
+		ti = ti_load_file(&f, termname, sizeof(ti_terminfo), &rc);
+		if (ti && how == TI_LOAD_COMPACT) ti = ti_compact(ti, &rc);
+		if (!ti && rc == ENOENT) ti = ti_builtin_for(termname, 1);
+		if (!ti) {
+			if (err) *err = rc;
+			return NULL;
+		}
+	}
+
+	if (err) *err = 0;
+	return ti;
+}
+
+// TODO: big endian arch. terminfo files are always structured little endian.
+ti_terminfo *ti_load(const char *termname, int *err) {
+	return ti_load_any(termname, TI_LOAD_READ, err);
+}
+
+ti_terminfo *ti_load_mmap(const char *termname, int *err) {
+	return ti_load_any(termname, TI_LOAD_MMAP, err);
+}
+
+ti_terminfo *ti_load_compact(const char *termname, int *err) {
+	return ti_load_any(termname, TI_LOAD_COMPACT, err);
+}
+
+// Most ti_terminfo members point into the data member and so must not be freed
+// directly. String returned from ti_getstr are invalid after ti_freeterm.
+void ti_free(ti_terminfo *ti) {
+	if (!ti || (ti->flags & TI_F_STATIC)) return;
+	assert(!(ti->flags & TI_F_SHARED)); // use ti_release()
+	if (ti->flags & TI_F_COMPACT) {
+		// everything lives in the struct's allocation
+		free(ti);
+		return;
+	}
+	free(ti->nums);      ti->nums = NULL;
+	free(ti->strs);      ti->strs = NULL;
+	free(ti->ext_nums);  ti->ext_nums = NULL;
+	free(ti->ext_strs);  ti->ext_strs = NULL;
+	free(ti->ext_names); ti->ext_names = NULL;
+	free(ti->ext_hash);  ti->ext_hash = NULL;
+	if (ti->flags & TI_F_MMAP) {
+		if (ti->data) munmap(ti->data, ti->len);
+	} else {
+		free(ti->data);
+	}
+	ti->data = NULL;
+	free(ti);
+}
+
+
+/*
+ * Shared terminfo cache
+ *
+ * ti_load_shared() keeps one mapped ti_terminfo per resolved file. Terminal
+ * names are hashed into a small table pointing at the file entries so that
+ * repeated loads of a cached name don't search the terminfo directories or
+ * parse anything. Cached files are re-checked with stat(2) at most once every
+ * TI_CACHE_TTL seconds and the whole cache is dropped whenever one of the
+ * environment variables that affect the directory search changes.
+ *
+ */
+
+#ifndef TI_CACHE_TTL
+#define TI_CACHE_TTL     1    // seconds between mtime checks of cached files
+#endif
+#define TI_CACHE_BUCKETS 64   // name hash table size (power of two)
+
+// Cached file entry. The ti_terminfo member must be first so that the pointer
+// handed out by ti_load_shared() is also a pointer to the entry.
+struct ti_shared {
+	ti_terminfo ti;
+	struct ti_shared *next;  // next entry in ti_cache.files list
+	int    refs;             // outstanding ti_load_shared() references
+	int    stale;            // dropped from cache, free on last release
+	time_t checked;          // last time the file mtime was verified
+	char   fn[TI_FN_MAX];    // path the file was loaded from
+	dev_t  dev;              // device and inode identifying the file
+	ino_t  ino;
+	struct timespec mtime;   // file modification time when loaded
+	long   off;              // offset of the entry in a packed database
+};
+
+// Terminal name pointing to a cached file entry.
+struct ti_shared_name {
+	struct ti_shared_name *next; // next name in hash bucket
+	struct ti_shared *ent;       // cached file for this name
+	char name[];
+};
+
+static struct {
+	pthread_mutex_t lock;
+	struct ti_shared *files;                         // all cached files
+	struct ti_shared_name *names[TI_CACHE_BUCKETS];  // name hash table
+	struct ti_envsnap env;                           // env at fill time
+} ti_cache = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+// Free an entry that is no longer in the files list or referenced.
+static void ti_shared_free(struct ti_shared *ent) {
+	ent->ti.flags &= ~TI_F_SHARED;
+	ti_free(&ent->ti);
+}
+
+// Remove names pointing to ent, or all names when ent is NULL.
+static void ti_cache_drop_names(struct ti_shared *ent) {
+	for (int i = 0; i < TI_CACHE_BUCKETS; i++) {
+		struct ti_shared_name **pn = &ti_cache.names[i];
+		while (*pn) {
+			struct ti_shared_name *n = *pn;
+			if (ent && n->ent != ent) {
+				pn = &n->next;
+				continue;
+			}
+			*pn = n->next;
+			free(n);
+		}
+	}
+}
+
+// Remove a file entry from the cache. The entry is freed now when it isn't
+// referenced or on the last ti_release() otherwise.
+static void ti_cache_drop(struct ti_shared *ent) {
+	ti_cache_drop_names(ent);
+	for (struct ti_shared **pe = &ti_cache.files; *pe; pe = &(*pe)->next) {
+		if (*pe != ent) continue;
+		*pe = ent->next;
+		break;
+	}
+	ent->stale = 1;
+	if (ent->refs == 0) ti_shared_free(ent);
+}
+
+// Drop all cached entries.
+static void ti_cache_drop_all(void) {
+	while (ti_cache.files) ti_cache_drop(ti_cache.files);
+}
+
+// Drop the cache when the environment no longer matches the environment
+// the cache was filled under.
+static void ti_cache_check_env(void) {
+	if (ti_env_changed(&ti_cache.env)) ti_cache_drop_all();
+}
+
+// Check the file behind a cached entry hasn't changed since it was loaded.
+// Returns non-zero when the entry can still be used.
+static int ti_cache_check_file(struct ti_shared *ent, time_t now) {
+	if (now - ent->checked < TI_CACHE_TTL) return 1;
+
+	struct stat st;
+	if (stat(ent->fn, &st) != 0) return 0;
+	if (st.st_dev != ent->dev || st.st_ino != ent->ino) return 0;
+	if (st.st_mtim.tv_sec != ent->mtime.tv_sec) return 0;
+	if (st.st_mtim.tv_nsec != ent->mtime.tv_nsec) return 0;
+
+	ent->checked = now;
+	return 1;
+}
+
+// Look up a cached name. Must be called with the cache lock held.
+static struct ti_shared_name *ti_cache_find(const char *name, uint32_t h) {
+	struct ti_shared_name *n = ti_cache.names[h & (TI_CACHE_BUCKETS - 1)];
+	for (; n; n = n->next) {
+		if (strcmp(n->name, name) == 0) return n;
+	}
+	return NULL;
+}
+
+ti_terminfo *ti_load_shared(const char *termname, int *err) {
+	if (!termname) termname = getenv("TERM");
+	if (!termname) {
+		if (err) *err = TI_ERR_TERM_NOT_SET;
+		return NULL;
+	}
+
+	ti_terminfo *ti = ti_builtin_for(termname, 0);
+	if (ti) {
+		if (err) *err = 0;
+		return ti;
+	}
+
+	uint32_t h = ti_strhash(termname);
+	time_t now = time(NULL);
+
+	pthread_mutex_lock(&ti_cache.lock);
+	ti_cache_check_env();
+	struct ti_shared_name *n = ti_cache_find(termname, h);
+	if (n && ti_cache_check_file(n->ent, now)) {
+		n->ent->refs++;
+		pthread_mutex_unlock(&ti_cache.lock);
+		if (err) *err = 0;
+		return &n->ent->ti;
 	}
+	if (n) ti_cache_drop(n->ent);
+	pthread_mutex_unlock(&ti_cache.lock);
 
+	// load outside the lock so other names can be served meanwhile
+	struct ti_file f = {0};
+	f.mmap = 1;
+	int rc;
+	struct ti_shared *ent = (struct ti_shared *)
+		ti_load_file(&f, termname, sizeof(struct ti_shared), &rc);
+	if (!ent) {
+		if (rc == ENOENT && (ti = ti_builtin_for(termname, 1))) rc = 0;
+		if (err) *err = rc;
+		return ti;
+	}
+	ent->ti.flags |= TI_F_SHARED;
+	ent->checked = now;
+	memcpy(ent->fn, f.fn, sizeof(f.fn));
+	ent->dev = f.dev;
+	ent->ino = f.ino;
+	ent->mtime = f.mtime;
+	ent->off = f.off;
+
+	pthread_mutex_lock(&ti_cache.lock);
+
+	// another thread may have cached the name while we were loading
+	if ((n = ti_cache_find(termname, h))) {
+		n->ent->refs++;
+		pthread_mutex_unlock(&ti_cache.lock);
+		ti_shared_free(ent);
+		if (err) *err = 0;
+		return &n->ent->ti;
+	}
 
-	// convert name offsets into pointers to strtbl
-	int16_t *nameoffs = stroffs + h2.stroffs_count;
-	int nametbl_len = h2.strtbl_len - (p - strtbl);
-
-	// calculate pointers from offsets
-	ti->ext_names = calloc(ti->ext_names_count, sizeof(char*));
-	for (int i = 0; i < ti->ext_names_count; i++) {
-		if (nameoffs[i] < 0 || nameoffs[i] >= nametbl_len) {
-			if (err) *err = TI_ERR_BAD_STROFF;
-			ti_free(ti);
-			return NULL;
-		}
-		ti->ext_names[i] = p + nameoffs[i];
+	// share an entry already loaded from the same file under another name
+	struct ti_shared *e = ti_cache.files;
+	for (; e; e = e->next) {
+		if (e->dev != ent->dev || e->ino != ent->ino) continue;
+		if (e->off != ent->off) continue;
+		if (e->mtime.tv_sec != ent->mtime.tv_sec) continue;
+		if (e->mtime.tv_nsec != ent->mtime.tv_nsec) continue;
+		break;
+	}
+	if (e) {
+		ti_shared_free(ent);
+		ent = e;
+	} else {
+		ent->next = ti_cache.files;
+		ti_cache.files = ent;
 	}
 
-	// set up bool, num, and str name array pointers to their positions in
-	// the overall name pointers array
-	ti->ext_bool_names = ti->ext_names;
-	ti->ext_num_names = ti->ext_bool_names + ti->ext_bools_count;
-	ti->ext_str_names = ti->ext_num_names + ti->ext_nums_count;
+	size_t len = strlen(termname) + 1;
+	n = malloc(sizeof(struct ti_shared_name) + len);
+	if (n) {
+		memcpy(n->name, termname, len);
+		n->ent = ent;
+		n->next = ti_cache.names[h & (TI_CACHE_BUCKETS - 1)];
+		ti_cache.names[h & (TI_CACHE_BUCKETS - 1)] = n;
+	}
 
+	ent->refs++;
+	pthread_mutex_unlock(&ti_cache.lock);
 	if (err) *err = 0;
-	return ti;
+	return &ent->ti;
 }
 
-// Most ti_terminfo members point into the data member and so must not be freed
-// directly. String returned from ti_getstr are invalid after ti_freeterm.
-void ti_free(ti_terminfo *ti) {
-	if (!ti) return;
-	free(ti->nums);      ti->nums = NULL;
-	free(ti->strs);      ti->strs = NULL;
-	free(ti->ext_nums);  ti->ext_nums = NULL;
-	free(ti->ext_strs);  ti->ext_strs = NULL;
-	free(ti->ext_names); ti->ext_names = NULL;
-	free(ti->data);      ti->data = NULL;
-	free(ti);
+void ti_release(ti_terminfo *ti) {
+	if (!ti || (ti->flags & TI_F_STATIC)) return;
+	assert(ti->flags & TI_F_SHARED);
+
+	struct ti_shared *ent = (struct ti_shared *)ti;
+	pthread_mutex_lock(&ti_cache.lock);
+	assert(ent->refs > 0);
+	if (--ent->refs == 0 && ent->stale) {
+		ti_shared_free(ent);
+	}
+	pthread_mutex_unlock(&ti_cache.lock);
+}
+
+void ti_cache_flush(void) {
+	pthread_mutex_lock(&ti_cache.lock);
+	ti_cache_drop_all();
+	pthread_mutex_unlock(&ti_cache.lock);
 }
 
 
@@ -445,7 +1629,7 @@ const char *ti_strerror(int errnum) {
 
 int ti_getbooli(ti_terminfo *ti, int cap) {
 	assert(ti);
-	if (cap < 0 || cap > ti->bools_count) {
+	if (cap < 0 || cap >= ti->bools_count) {
 		return 0;
 	}
 	return ti->bools[cap];
@@ -453,10 +1637,13 @@ int ti_getbooli(ti_terminfo *ti, int cap) {
 
 int ti_getnumi(ti_terminfo *ti, int cap) {
 	assert(ti);
-	if (cap < 0 || cap > ti->nums_count) {
+	if (cap < 0 || cap >= ti->nums_count) {
 		return -1;
 	}
-	return ti->nums[cap];
+	if (ti->nums) {
+		return ti->nums[cap];
+	}
+	return ti_rdnum(ti->raw_nums, cap, ti->numsz);
 }
 
 char *ti_getstri(ti_terminfo *ti, int cap) {
@@ -464,73 +1651,633 @@ char *ti_getstri(ti_terminfo *ti, int cap) {
 	if (cap < 0 || cap >= ti->strs_count) {
 		return NULL;
 	}
-	return ti->strs[cap];
+	if (ti->strs) {
+		return ti->strs[cap];
+	}
+	int16_t off = ti_rd16(ti->raw_stroffs + cap * 2);
+	return (off < 0) ? NULL : (char*)ti->raw_strtbl + off;
 }
 
-int ti_getbool(ti_terminfo *ti, const char *cap) {
+const char *ti_extname(ti_terminfo *ti, int type, int i) {
 	assert(ti);
-	if (cap == NULL) return 0;
 
-	// O(n) linear search through bool capability names.
-	// TIP: load these at startup instead of on-demand.
-	static const int n = (sizeof(ti_boolnames) / sizeof(char*));
-	for (int i = 0; i < n; i++) {
-		if (strcmp(ti_boolnames[i], cap)) continue;
-		return ti_getbooli(ti, i);
+	// names for all types are stored in one array: bools, nums, then strs
+	int n = 0, base = 0;
+	switch (type) {
+	case TI_BOOL:
+		n = ti->ext_bools_count;
+		break;
+	case TI_NUM:
+		n = ti->ext_nums_count;
+		base = ti->ext_bools_count;
+		break;
+	case TI_STR:
+		n = ti->ext_strs_count;
+		base = ti->ext_bools_count + ti->ext_nums_count;
+		break;
 	}
-
-	// check extended boolean capabilties
-	for (int i = 0; i < ti->ext_bools_count; i++) {
-		if (strcmp(ti->ext_bool_names[i], cap)) continue;
-		return ti->ext_bools[i];
+	if (i < 0 || i >= n) {
+		return NULL;
 	}
 
-	return 0;
+	return ti_extname_at(ti, base + i);
+}
 
+int ti_getextbooli(ti_terminfo *ti, int i) {
+	assert(ti);
+	if (i < 0 || i >= ti->ext_bools_count) {
+		return 0;
+	}
+	return ti->ext_bools[i];
 }
 
-int ti_getnum(ti_terminfo *ti, const char *cap) {
+int ti_getextnumi(ti_terminfo *ti, int i) {
 	assert(ti);
-	if (cap == NULL) return -1;
+	if (i < 0 || i >= ti->ext_nums_count) {
+		return -1;
+	}
+	if (ti->ext_nums) {
+		return ti->ext_nums[i];
+	}
+	return ti_rdnum(ti->raw_ext_nums, i, ti->numsz);
+}
 
-	// O(n) linear search through numeric capability names.
-	// TIP: load these at startup instead of on-demand.
-	static const int n = (sizeof(ti_numnames) / sizeof(char*));
-	for (int i = 0; i < n; i++) {
-		if (strcmp(ti_numnames[i], cap)) continue;
-		return ti_getnumi(ti, i);
+char *ti_getextstri(ti_terminfo *ti, int i) {
+	assert(ti);
+	if (i < 0 || i >= ti->ext_strs_count) {
+		return NULL;
+	}
+	if (ti->ext_strs) {
+		return ti->ext_strs[i];
 	}
+	int16_t off = ti_rd16(ti->raw_ext_stroffs + i * 2);
+	return (off < 0) ? NULL : (char*)ti->raw_ext_strtbl + off;
+}
 
-	// check extended numeric capabilties.
-	for (int i = 0; i < ti->ext_nums_count; i++) {
-		if (strcmp(ti->ext_num_names[i], cap)) continue;
-		return ti->ext_nums[i];
+// Find the index of a standard capability name of the given type in the
+// perfect hash tables, or -1. The h argument is the name's ti_strhash().
+static int ti_capindex(int type, const char *name, uint32_t h) {
+	uint32_t b = h & (TI_CAPHASH_BUCKETS - 1);
+	uint32_t slot = ti_hashmix(h ^ ti_caphash_disp[b]) & (TI_CAPHASH_SLOTS - 1);
+	uint16_t e = ti_caphash_slots[slot];
+	if ((e >> 12) != type) return -1;
+
+	int i = e & 0x0fff;
+	const char * const *names = (type == TI_BOOL) ? ti_boolnames :
+	                            (type == TI_NUM) ? ti_numnames : ti_strnames;
+	return strcmp(names[i], name) ? -1 : i;
+}
+
+// Find the index of an extended capability name of the given type in the
+// terminal's ext_hash index, or -1. The h argument is the name's
+// ti_strhash().
+static int ti_extindex(ti_terminfo *ti, int type, const char *name,
+                       uint32_t h) {
+	if (!ti->ext_hash) return -1;
+
+	// names for all types are stored in one array: bools, nums, then strs
+	int base = 0, n = ti->ext_bools_count;
+	if (type != TI_BOOL) {
+		base += n;
+		n = ti->ext_nums_count;
+	}
+	if (type == TI_STR) {
+		base += n;
+		n = ti->ext_strs_count;
 	}
 
+	uint32_t mask = ti->ext_hash_mask;
+	for (uint32_t j = h & mask; ti->ext_hash[j]; j = (j + 1) & mask) {
+		int i = ti->ext_hash[j] - 1;
+		if (i < base || i >= base + n) continue;
+		if (strcmp(ti_extname_at(ti, i), name) == 0) return i - base;
+	}
 	return -1;
 }
 
+int ti_getbool(ti_terminfo *ti, const char *cap) {
+	assert(ti);
+	if (cap == NULL) return 0;
+
+	uint32_t h = ti_strhash(cap);
+	int i = ti_capindex(TI_BOOL, cap, h);
+	if (i >= 0) return ti_getbooli(ti, i);
+
+	// check extended boolean capabilties
+	i = ti_extindex(ti, TI_BOOL, cap, h);
+	return (i >= 0) ? ti_getextbooli(ti, i) : 0;
+}
+
+int ti_getnum(ti_terminfo *ti, const char *cap) {
+	assert(ti);
+	if (cap == NULL) return -1;
+
+	uint32_t h = ti_strhash(cap);
+	int i = ti_capindex(TI_NUM, cap, h);
+	if (i >= 0) return ti_getnumi(ti, i);
+
+	// check extended numeric capabilties
+	i = ti_extindex(ti, TI_NUM, cap, h);
+	return (i >= 0) ? ti_getextnumi(ti, i) : -1;
+}
+
 char *ti_getstr(ti_terminfo *ti, const char *cap) {
 	assert(ti);
 	if (cap == NULL) return NULL;
 
-	// O(n) linear search through string capability names.
-	// TIP: load these at startup instead of on-demand.
-	static const int n = (sizeof(ti_strnames) / sizeof(char*));
+	uint32_t h = ti_strhash(cap);
+	int i = ti_capindex(TI_STR, cap, h);
+	if (i >= 0) return ti_getstri(ti, i);
+
+	// check extended string capabilties
+	i = ti_extindex(ti, TI_STR, cap, h);
+	return (i >= 0) ? ti_getextstri(ti, i) : NULL;
+}
+
+int ti_getcaps(ti_terminfo *ti, const struct ti_capdesc *descs, int n,
+               void *out, char *missing) {
+	assert(ti);
+	assert(descs || n == 0);
+	assert(out);
+
+	int nmissing = 0;
 	for (int i = 0; i < n; i++) {
-		if (strcmp(ti_strnames[i], cap)) continue;
-		return ti_getstri(ti, i);
+		const struct ti_capdesc *d = &descs[i];
+		char *p = (char *)out + d->offset;
+		int found = 0;
+		switch (d->type) {
+		case TI_BOOL:
+			*(int *)p = ti_getbool(ti, d->name);
+			found = *(int *)p > 0;
+			break;
+		case TI_NUM:
+			*(int *)p = ti_getnum(ti, d->name);
+			found = *(int *)p >= 0;
+			break;
+		case TI_STR:
+			*(char **)p = ti_getstr(ti, d->name);
+			found = *(char **)p != NULL;
+			break;
+		}
+		if (missing) missing[i] = !found;
+		nmissing += !found;
 	}
 
-	// check extended string capabilties.
-	for (int i = 0; i < ti->ext_strs_count; i++) {
-		if (strcmp(ti->ext_str_names[i], cap)) continue;
-		return ti->ext_strs[i];
+	return nmissing;
+}
+
+
+/*
+ * Terminfo database scanning
+ *
+ * ti_db_scan() lists every entry in the search paths the same way the path
+ * resolver searches them, parses the entries on a pool of worker threads, and
+ * indexes which terminals define each capability. Workers take entries from a
+ * shared counter in small batches and record the capabilities each entry
+ * defines in its own item, so the only shared state is the counter. The
+ * inverted index is built from the items after the workers finish.
+ *
+ */
+
+#define TI_SCAN_THREADS_MAX 64   // max number of worker threads
+#define TI_SCAN_BATCH       8    // entries taken by a worker at a time
+
+// Standard capabilities are numbered bools, then nums, then strs.
+#define TI_STD_BOOLS (int)(sizeof(ti_boolnames) / sizeof(char*))
+#define TI_STD_NUMS  (int)(sizeof(ti_numnames) / sizeof(char*))
+#define TI_STD_STRS  (int)(sizeof(ti_strnames) / sizeof(char*))
+#define TI_STD_CAPS  (TI_STD_BOOLS + TI_STD_NUMS + TI_STD_STRS)
+
+// Entry found while listing the search paths.
+struct ti_scan_item {
+	char    *name;           // terminal name
+	char    *fn;             // file path; NULL for packed database entries
+	int      dir;            // index of the search path
+	uint32_t off, len;       // data within a packed database
+	int      err;            // zero or the error parsing the entry
+	uint8_t  caps[(TI_STD_CAPS + 7) / 8];  // standard caps defined
+	char    *ext;            // extended caps defined: "name\0...\0\0"
+};
+
+// Extended capability in the inverted index.
+struct ti_scan_ext {
+	const char *name;        // name in one of the items' ext lists
+	int *entries;            // entry indexes defining the capability
+	int  n, size;
+};
+
+// Private part of ti_scan.
+struct ti_scan_index {
+	struct ti_dir *dirs;     // search paths, packed databases mapped
+	int ndirs;
+	struct ti_scan_item *items;
+	int *std;                // entry indexes for each standard capability
+	int  stdoff[TI_STD_CAPS + 1];
+	struct ti_scan_ext *ext; // open addressing table of extended caps
+	uint32_t extmask;
+};
+
+// State shared by the worker threads.
+struct ti_scan_job {
+	pthread_mutex_t lock;
+	struct ti_scan_index *ix;
+	int n;
+	int next;
+};
+
+static int ti_scan_item_cmp(const void *a, const void *b) {
+	const struct ti_scan_item *x = a, *y = b;
+	int c = strcmp(x->name, y->name);
+	return c ? c : x->dir - y->dir;
+}
+
+// Append an entry to the item list. Returns zero or ENOMEM.
+static int ti_scan_add(struct ti_scan_index *ix, int *n, int *size,
+                       const char *name, const char *fn, int dir,
+                       uint32_t off, uint32_t len) {
+	if (*n == *size) {
+		int size2 = *size ? *size * 2 : 256;
+		void *p = realloc(ix->items, size2 * sizeof(struct ti_scan_item));
+		if (!p) return ENOMEM;
+		ix->items = p;
+		*size = size2;
+	}
+	struct ti_scan_item *it = &ix->items[*n];
+	memset(it, 0, sizeof(*it));
+	it->name = strdup(name);
+	it->fn = fn ? strdup(fn) : NULL;
+	if (!it->name || (fn && !it->fn)) {
+		free(it->name);
+		free(it->fn);
+		return ENOMEM;
+	}
+	it->dir = dir;
+	it->off = off;
+	it->len = len;
+	(*n)++;
+	return 0;
+}
+
+// List the entries of a terminfo directory tree.
+static int ti_scan_list_dir(struct ti_scan_index *ix, int dir, int *n,
+                            int *size) {
+	const char *path = ix->dirs[dir].path;
+	DIR *top = opendir(path);
+	if (!top) return 0;
+
+	int rc = 0;
+	struct dirent *sub;
+	while (!rc && (sub = readdir(top))) {
+		if (sub->d_name[0] == '.') continue;
+		char subpath[TI_FN_MAX];
+		snprintf(subpath, sizeof(subpath), "%s/%s", path, sub->d_name);
+		DIR *d = opendir(subpath);
+		if (!d) continue;
+
+		struct dirent *e;
+		while (!rc && (e = readdir(d))) {
+			if (e->d_name[0] == '.') continue;
+			char fn[TI_FN_MAX];
+			int len = snprintf(fn, sizeof(fn), "%s/%s", subpath, e->d_name);
+			if (len >= (int)sizeof(fn)) continue;
+			rc = ti_scan_add(ix, n, size, e->d_name, fn, dir, 0, 0);
+		}
+		closedir(d);
+	}
+	closedir(top);
+	return rc;
+}
+
+// List the entries of a mapped packed database.
+static int ti_scan_list_db(struct ti_scan_index *ix, int dir, int *n,
+                           int *size) {
+	struct ti_dir *d = &ix->dirs[dir];
+	uint32_t nslots = ti_rd32(d->db + 8);
+	for (uint32_t j = 0; j < nslots; j++) {
+		const char *slot = d->db + TI_DB_HDRSZ + j * TI_DB_SLOTSZ;
+		uint32_t name_off = ti_rd32(slot + 4);
+		if (name_off == 0 || name_off >= d->dbsize) continue;
+		const char *name = d->db + name_off;
+		if (strnlen(name, d->dbsize - name_off) == d->dbsize - name_off)
+			continue;
+		uint32_t off = ti_rd32(slot + 8), len = ti_rd32(slot + 12);
+		if (off > d->dbsize || len > d->dbsize - off) len = 0;
+		int rc = ti_scan_add(ix, n, size, name, NULL, dir, off, len);
+		if (rc) return rc;
+	}
+	return 0;
+}
+
+// Parse one entry and record which capabilities it defines.
+static void ti_scan_load(struct ti_scan_index *ix, struct ti_scan_item *it) {
+	struct ti_file f = {0};
+	f.lazy = 1;
+	if (it->fn) {
+		it->err = ti_read_file(&f, it->fn);
+		if (it->err) return;
+	} else {
+		struct ti_dir *d = &ix->dirs[it->dir];
+		// same errors as ti_read_file() gives for a file
+		if (it->len > TI_DATA_MAX) {
+			it->err = EFBIG;
+			return;
+		}
+		if (it->len == 0) {
+			it->err = TI_ERR_NO_HEADER;
+			return;
+		}
+		if (!(f.data = malloc(it->len))) {
+			it->err = ENOMEM;
+			return;
+		}
+		memcpy(f.data, d->db + it->off, it->len);
+		f.len = it->len;
+	}
+
+	ti_terminfo *ti = ti_parse(&f, sizeof(ti_terminfo), &it->err);
+	if (!ti) return;
+
+	int bools = ti->bools_count < TI_STD_BOOLS ? ti->bools_count : TI_STD_BOOLS;
+	int nums = ti->nums_count < TI_STD_NUMS ? ti->nums_count : TI_STD_NUMS;
+	int strs = ti->strs_count < TI_STD_STRS ? ti->strs_count : TI_STD_STRS;
+	for (int i = 0; i < bools; i++) {
+		if (ti_getbooli(ti, i) > 0) it->caps[i / 8] |= 1 << (i % 8);
+	}
+	for (int i = 0; i < nums; i++) {
+		int c = TI_STD_BOOLS + i;
+		if (ti_getnumi(ti, i) >= 0) it->caps[c / 8] |= 1 << (c % 8);
+	}
+	for (int i = 0; i < strs; i++) {
+		int c = TI_STD_BOOLS + TI_STD_NUMS + i;
+		if (ti_getstri(ti, i)) it->caps[c / 8] |= 1 << (c % 8);
+	}
+
+	// copy the names of defined extended caps into one buffer
+	size_t len = 1;
+	for (int pass = 0; pass < 2; pass++) {
+		char *p = it->ext;
+		for (int i = 0; i < ti->ext_names_count; i++) {
+			int defined, type, j;
+			if (i < ti->ext_bools_count) {
+				type = TI_BOOL, j = i;
+				defined = ti_getextbooli(ti, j) > 0;
+			} else if (i < ti->ext_bools_count + ti->ext_nums_count) {
+				type = TI_NUM, j = i - ti->ext_bools_count;
+				defined = ti_getextnumi(ti, j) >= 0;
+			} else {
+				type = TI_STR;
+				j = i - ti->ext_bools_count - ti->ext_nums_count;
+				defined = ti_getextstri(ti, j) != NULL;
+			}
+			if (!defined) continue;
+			const char *name = ti_extname(ti, type, j);
+			if (pass == 0) {
+				len += strlen(name) + 1;
+			} else {
+				size_t n = strlen(name) + 1;
+				memcpy(p, name, n);
+				p += n;
+			}
+		}
+		if (pass == 0) {
+			if (len == 1) break;
+			if (!(it->ext = malloc(len))) {
+				// a failed entry, not one without extended caps
+				it->err = ENOMEM;
+				break;
+			}
+		} else {
+			*p = '\0';
+		}
+	}
+
+	ti_free(ti);
+}
+
+static void *ti_scan_worker(void *arg) {
+	struct ti_scan_job *job = arg;
+	for (;;) {
+		pthread_mutex_lock(&job->lock);
+		int i = job->next;
+		job->next += TI_SCAN_BATCH;
+		pthread_mutex_unlock(&job->lock);
+		if (i >= job->n) break;
+
+		int end = i + TI_SCAN_BATCH < job->n ? i + TI_SCAN_BATCH : job->n;
+		for (; i < end; i++) {
+			ti_scan_load(job->ix, &job->ix->items[i]);
+		}
+	}
+	return NULL;
+}
+
+// Add entry i to the extended capability name in the index.
+static int ti_scan_index_ext(struct ti_scan_index *ix, const char *name,
+                             int i) {
+	uint32_t j = ti_strhash(name) & ix->extmask;
+	while (ix->ext[j].name && strcmp(ix->ext[j].name, name) != 0) {
+		j = (j + 1) & ix->extmask;
+	}
+	struct ti_scan_ext *e = &ix->ext[j];
+	e->name = name;
+	if (e->n == e->size) {
+		int size = e->size ? e->size * 2 : 8;
+		int *p = realloc(e->entries, size * sizeof(int));
+		if (!p) return ENOMEM;
+		e->entries = p;
+		e->size = size;
+	}
+	e->entries[e->n++] = i;
+	return 0;
+}
+
+// Build the inverted capability index from the parsed items.
+static int ti_scan_index(ti_scan *scan) {
+	struct ti_scan_index *ix = scan->index;
+	int n = scan->nentries;
+
+	// count terminals per standard cap, then fill in their entry indexes
+	int total = 0;
+	for (int c = 0; c < TI_STD_CAPS; c++) {
+		ix->stdoff[c] = total;
+		for (int i = 0; i < n; i++) {
+			total += (ix->items[i].caps[c / 8] >> (c % 8)) & 1;
+		}
+	}
+	ix->stdoff[TI_STD_CAPS] = total;
+	ix->std = malloc((total ? total : 1) * sizeof(int));
+	if (!ix->std) return ENOMEM;
+	int fill[TI_STD_CAPS];
+	memcpy(fill, ix->stdoff, sizeof(fill));
+	for (int i = 0; i < n; i++) {
+		for (int c = 0; c < TI_STD_CAPS; c++) {
+			if ((ix->items[i].caps[c / 8] >> (c % 8)) & 1)
+				ix->std[fill[c]++] = i;
+		}
+	}
+
+	// size the extended cap table for at most half full
+	int next = 0;
+	for (int i = 0; i < n; i++) {
+		for (const char *p = ix->items[i].ext; p && *p; p += strlen(p) + 1)
+			next++;
+	}
+	uint32_t size = 16;
+	while (size < (uint32_t)next * 2) size <<= 1;
+	ix->ext = calloc(size, sizeof(struct ti_scan_ext));
+	if (!ix->ext) return ENOMEM;
+	ix->extmask = size - 1;
+	for (int i = 0; i < n; i++) {
+		for (const char *p = ix->items[i].ext; p && *p; p += strlen(p) + 1) {
+			if (ti_scan_index_ext(ix, p, i)) return ENOMEM;
+		}
+	}
+	return 0;
+}
+
+ti_scan *ti_db_scan(int nthreads, int *err) {
+	int rc = ENOMEM;
+	ti_scan *scan = calloc(1, sizeof(ti_scan));
+	struct ti_scan_index *ix = calloc(1, sizeof(struct ti_scan_index));
+	if (!scan || !ix) {
+		free(scan);
+		free(ix);
+		if (err) *err = ENOMEM;
+		return NULL;
+	}
+	scan->index = ix;
+
+	// copy the search paths from the resolver
+	pthread_mutex_lock(&ti_resolver.lock);
+	ti_resolver_refresh(time(NULL));
+	ix->dirs = calloc(ti_resolver.ndirs ? ti_resolver.ndirs : 1,
+	                  sizeof(struct ti_dir));
+	for (int i = 0; ix->dirs && i < ti_resolver.ndirs; i++) {
+		if (!(ix->dirs[i].path = strdup(ti_resolver.dirs[i].path))) break;
+		ix->ndirs++;
 	}
+	pthread_mutex_unlock(&ti_resolver.lock);
+	if (!ix->dirs) goto fail;
+
+	// list entries in search order
+	int n = 0, size = 0, probes = 0;
+	for (int i = 0; i < ix->ndirs; i++) {
+		struct ti_dir *d = &ix->dirs[i];
+		d->state = ti_probe_search_path(d, &probes);
+		if (d->state == TI_DIR_PRESENT) rc = ti_scan_list_dir(ix, i, &n, &size);
+		else if (d->state == TI_DIR_PACKED) rc = ti_scan_list_db(ix, i, &n, &size);
+		else rc = 0;
+		if (rc) {
+			scan->nentries = n;
+			goto fail;
+		}
+	}
+
+	// sort by name, keeping only the first entry found for each name
+	if (n) qsort(ix->items, n, sizeof(struct ti_scan_item), ti_scan_item_cmp);
+	int m = 0;
+	for (int i = 0; i < n; i++) {
+		if (m && strcmp(ix->items[m - 1].name, ix->items[i].name) == 0) {
+			free(ix->items[i].name);
+			free(ix->items[i].fn);
+			continue;
+		}
+		ix->items[m++] = ix->items[i];
+	}
+	n = scan->nentries = m;
+
+	// parse entries on nthreads threads including this one
+	if (nthreads <= 0) nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (nthreads <= 0) nthreads = 1;
+	if (nthreads > TI_SCAN_THREADS_MAX) nthreads = TI_SCAN_THREADS_MAX;
+	struct ti_scan_job job = {
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.ix = ix,
+		.n = n,
+	};
+	pthread_t threads[TI_SCAN_THREADS_MAX];
+	int started = 0;
+	for (; started < nthreads - 1; started++) {
+		if (pthread_create(&threads[started], NULL, ti_scan_worker, &job))
+			break;
+	}
+	ti_scan_worker(&job);
+	for (int i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	// public entry list
+	scan->entries = calloc(n ? n : 1, sizeof(struct ti_scan_entry));
+	if (!scan->entries) goto fail;
+	for (int i = 0; i < n; i++) {
+		struct ti_scan_item *it = &ix->items[i];
+		scan->entries[i].name = it->name;
+		scan->entries[i].path = it->fn ? it->fn : ix->dirs[it->dir].path;
+		scan->entries[i].err = it->err;
+		scan->nfailed += (it->err != 0);
+	}
+
+	if ((rc = ti_scan_index(scan))) goto fail;
+
+	if (err) *err = 0;
+	return scan;
 
+fail:
+	ti_scan_free(scan);
+	if (err) *err = rc;
 	return NULL;
 }
 
+int ti_scan_find(ti_scan *scan, const char *capname, const int **entries) {
+	assert(scan);
+	struct ti_scan_index *ix = scan->index;
+	*entries = NULL;
+	if (!capname) return 0;
+
+	uint32_t h = ti_strhash(capname);
+	int types[] = {TI_BOOL, TI_NUM, TI_STR};
+	int base[] = {0, TI_STD_BOOLS, TI_STD_BOOLS + TI_STD_NUMS};
+	for (int t = 0; t < 3; t++) {
+		int i = ti_capindex(types[t], capname, h);
+		if (i < 0) continue;
+		int c = base[t] + i;
+		*entries = ix->std + ix->stdoff[c];
+		return ix->stdoff[c + 1] - ix->stdoff[c];
+	}
+
+	for (uint32_t j = h & ix->extmask; ix->ext[j].name;
+	     j = (j + 1) & ix->extmask) {
+		if (strcmp(ix->ext[j].name, capname) != 0) continue;
+		*entries = ix->ext[j].entries;
+		return ix->ext[j].n;
+	}
+	return 0;
+}
+
+void ti_scan_free(ti_scan *scan) {
+	if (!scan) return;
+	struct ti_scan_index *ix = scan->index;
+	for (int i = 0; i < scan->nentries; i++) {
+		free(ix->items[i].name);
+		free(ix->items[i].fn);
+		free(ix->items[i].ext);
+	}
+	free(ix->items);
+	for (int i = 0; i < ix->ndirs; i++) {
+		if (ix->dirs[i].db) munmap((void *)ix->dirs[i].db, ix->dirs[i].dbsize);
+		free(ix->dirs[i].path);
+	}
+	free(ix->dirs);
+	free(ix->std);
+	for (uint32_t j = 0; ix->ext && j <= ix->extmask; j++) {
+		free(ix->ext[j].entries);
+	}
+	free(ix->ext);
+	free(ix);
+	free(scan->entries);
+	free(scan);
+}
+
 
 /*
  * Utility functions
@@ -541,39 +2288,33 @@ int ti_stresc(char *buf, const char *str, int n) {
 	assert(buf);
 	assert(str);
 
-	char *pbuf = buf;
-	for (const char *pch = str; *pch; pch++) {
-		if (n - (pbuf - buf) < 5) {
-			// eager bounds check
-			break;
-		}
+	if (n <= 0) return 0;
 
-		if (*pch >= ' ' && *pch <= '~') {
-			*pbuf++ = *pch;
-			continue;
-		}
+	size_t used;
+	size_t pos = stresc_kernel(buf, n - 1, str, strlen(str), &used, 0,
+	                           STRESC_PATH_AUTO);
+	buf[pos] = 0;
 
-		*pbuf++ = '\\';
-		switch (*pch) {
-		case '\x1b': // ESC
-			*pbuf++ = 'e';
-			break;
-		case '\t':
-			*pbuf++ = 't';
-			break;
-		case '\n':
-			*pbuf++ = 'n';
-			break;
-		case '\r':
-			*pbuf++ = 'r';
-			break;
-		default:
-			pbuf+= sprintf(pbuf, "%03hho", *pch);
-		}
-	}
-	*pbuf++ = 0;
+	return pos;
+}
 
-	return pbuf - buf - 1;
+void ti_stresc_init(ti_stresc_state *st, const char *str, size_t len,
+                    int flags) {
+	st->str = str;
+	st->len = len;
+	st->flags = flags;
+}
+
+size_t ti_stresc_next(ti_stresc_state *st, char *buf, size_t bufsz) {
+	// the kernel has its own flag values
+	int flags = (st->flags & TI_STRESC_BACKSLASH ? STRESC_BACKSLASH : 0) |
+	            (st->flags & TI_STRESC_NUL ? STRESC_NUL : 0);
+	size_t used;
+	size_t pos = stresc_kernel(buf, bufsz, st->str, st->len, &used,
+	                           flags, STRESC_PATH_AUTO);
+	st->str += used;
+	st->len -= used;
+	return pos;
 }
 
 
@@ -604,13 +2345,18 @@ int ti_stresc(char *buf, const char *str, int n) {
 #define TI_PARM_STRING_MAX 64          // max size of int converted to string
 #define TI_PARM_OUTPUT_MAX 4096        // max output string size
 #define TI_PARM_PARAMS_MAX 9           // max number of params
+#define TI_PARM_INLINE_MAX 12          // max inline string size
 
+// Stack elements and variables.
+//
+// Numbers stay numbers until they're popped as strings. Strings are stored
+// inline: every string is a %'c' char constant, a number converted to a
+// string, or a variable holding one of those, so they're never longer than an
+// int in decimal. Evaluating a string never allocates.
 struct stk_el {
-	int type;
-	union {
-		char *str;
-		int   num;
-	} val;
+	int  type;                       // stk_str, stk_num, or 0 if unset
+	int  num;
+	char str[TI_PARM_INLINE_MAX];
 };
 
 struct stk {
@@ -618,34 +2364,34 @@ struct stk {
 	struct stk_el el[TI_PARM_STACK_MAX];
 };
 
-// Push a string onto the stack.
-// The string must be heap allocated and must also be freed by the caller after pop.
+// Push a copy of a string onto the stack, truncated to the inline size.
 // Returns 0 if successful, -1 on stack overflow.
-static int stk_push_str(struct stk *stk, char *str) {
+static int stk_push_str(struct stk *stk, const char *str) {
 	if (stk->pos >= TI_PARM_STACK_MAX)
 		return -1;
 
 	struct stk_el *el = &stk->el[stk->pos++];
 	el->type = stk_str;
-	el->val.str = str;
+	int i = 0;
+	for (; str[i] && i < TI_PARM_INLINE_MAX - 1; i++) {
+		el->str[i] = str[i];
+	}
+	el->str[i] = '\0';
 
 	return 0;
 }
 
-// Pop a string off the stack.
-// Returns an empty string on stack underflow.
-// The string returned must be freed by the caller.
-static char *stk_pop_str(struct stk *stk) {
-	if (stk->pos <= 0) return calloc(1, 1);
+// Pop a string off the stack, converting numbers.
+// Returns an empty string on stack underflow. The string returned lives in the
+// popped stack slot and is valid until the next push.
+static const char *stk_pop_str(struct stk *stk) {
+	if (stk->pos <= 0) return "";
 
 	struct stk_el *el = &stk->el[--stk->pos];
-	if (el->type == stk_str) {
-		return el->val.str;
-	} else {
-		char *buf = malloc(TI_PARM_STRING_MAX);
-		snprintf(buf, TI_PARM_STRING_MAX, "%d", el->val.num);
-		return buf;
+	if (el->type == stk_num) {
+		snprintf(el->str, TI_PARM_INLINE_MAX, "%d", el->num);
 	}
+	return el->str;
 }
 
 // Push a number onto the stack.
@@ -655,47 +2401,72 @@ static int stk_push_num(struct stk *stk, int num) {
 
 	struct stk_el *el = &stk->el[stk->pos++];
 	el->type = stk_num;
-	el->val.num  = num;
+	el->num  = num;
 
 	return 0;
 }
 
-// Pop a number off the stack.
+// Pop a number off the stack, converting strings.
 // Returns 0 on stack underflow.
 static int stk_pop_num(struct stk *stk) {
 	if (stk->pos <= 0) return 0;
 
 	struct stk_el *el = &stk->el[--stk->pos];
 	if (el->type == stk_num) {
-		return el->val.num;
+		return el->num;
 	} else {
-		int num = atoi(el->val.str);
-		free(el->val.str);
-		return num;
+		return atoi(el->str);
 	}
 }
 
-// Pop everything off stack and free strings.
-// This doesn't free the stk pointer since it's usually stack allocated.
-static void stk_free(struct stk *stk) {
-	struct stk_el *el = NULL;
-	while (stk->pos > 0) {
-		el = &stk->el[--stk->pos];
-		if (el->type == stk_str) {
-			free(el->val.str);
-		}
+// Pop the top of the stack into a variable as is.
+// Sets the variable to an empty string on stack underflow.
+static void stk_pop_var(struct stk *stk, struct stk_el *var) {
+	if (stk->pos <= 0) {
+		var->type = stk_str;
+		var->str[0] = '\0';
+		return;
 	}
+	*var = stk->el[--stk->pos];
 }
 
-// Static variables
-//
-// NOTE: Static variables are intended to live across multiple param string
-// processing invocations. That is the case in this implementation but note
-// that any strings set here are not freed and live until program termination.
+// Push a copy of a variable onto the stack. Unset variables push an empty
+// string.
+// Returns 0 when successful, -1 on stack overflow.
+static int stk_push_var(struct stk *stk, const struct stk_el *var) {
+	if (!var->type) return stk_push_str(stk, "");
+	if (stk->pos >= TI_PARM_STACK_MAX) return -1;
+
+	stk->el[stk->pos++] = *var;
+
+	return 0;
+}
+
+// Evaluation context
 //
-// This also means ti_parm() processing is not concurrency-safe when static
-// variables are used.
-static char *svars[26];
+// Static variables are intended to live across multiple param string
+// processing invocations, so they're kept in a context passed to each one.
+// Contexts aren't locked: evaluate strings in one context from one thread at a
+// time. ti_parm() and ti_parm_exec() share a default context and are not
+// concurrency-safe when static variables are used.
+struct ti_parm_ctx {
+	struct stk_el svars[26];
+};
+
+static ti_parm_ctx ti_parm_default;
+
+ti_parm_ctx *ti_parm_ctx_new(void) {
+	return calloc(1, sizeof(ti_parm_ctx));
+}
+
+void ti_parm_ctx_free(ti_parm_ctx *ctx) {
+	if (ctx != &ti_parm_default) free(ctx);
+}
+
+// Output limit for a buffer of bufsz bytes, leaving room for the terminator.
+static int ti_parm_max(size_t bufsz) {
+	return bufsz > (size_t)INT32_MAX ? INT32_MAX : (int)bufsz - 1;
+}
 
 
 /*
@@ -736,29 +2507,19 @@ static char *svars[26];
  *           %? expr %t thenpart %e elsepart %;
  *                     if-then-else, %e elsepart is optional.
  *                     else-if's are possible ala Algol 68:
- *                     %? c1 %t b1 %e c2 %t b2 %e c3 %t b3 %e c4 %t b4 %e b5 %;
- *
- *      For those of the above operators which are binary and not commutative,
- *      the stack works in the usual way, with
- *                     %gx %gy %m
- *      resulting in x mod y, not the reverse.
- */
-int ti_parm(char *buf, const char *s, int c, ...) {
-	if (!s) return 0;
-
-	// load varg params into fixed size int array for easier referencing.
-	va_list ap;
-	va_start(ap, c);
-	int params[9] = {0};
-	for (int i = 0; i < 9 && i < c; i++) {
-		params[i] = va_arg(ap, int);
-	}
-	va_end(ap);
-
+ *                     %? c1 %t b1 %e c2 %t b2 %e c3 %t b3 %e c4 %t b4 %e b5 %;
+ *
+ *      For those of the above operators which are binary and not commutative,
+ *      the stack works in the usual way, with
+ *                     %gx %gy %m
+ *      resulting in x mod y, not the reverse.
+ */
+static int ti_parm_run(ti_parm_ctx *ctx, char *buf, int max, const char *s,
+                       int *params) {
 	// variables used in instruction processing
 	int ai = 0, bi = 0;              // unary, arithmetic, binary op vars
-	char *as, *bs;                   // logical compare strs
-	char *str;                       // string pointer var
+	const char *as, *bs;             // logical compare strs
+	const char *str;                 // string pointer var
 	char sstr[TI_PARM_STRING_MAX];   // stack allocated string
 	int i;                           // loop counter
 	char fmt[16];                    // format code buffer
@@ -769,7 +2530,7 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 	struct stk stk = {0};
 
 	// dynamic variables
-	char *dvars[26] = {0};
+	struct stk_el dvars[26] = {0};
 
 	// output buffer pos and number of bytes written
 	int pos = 0;
@@ -780,8 +2541,11 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 
 	for (;*pch;) {
 		if (*pch != '%') {
-			buf[pos++] = *pch++;
-			nwrite++;
+			if (pos < max) {
+				buf[pos++] = *pch;
+				nwrite++;
+			}
+			pch++;
 			continue;
 		}
 
@@ -789,8 +2553,10 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 
 		switch (*pch++) {
 		case '%':
-			buf[pos++] = '%';
-			nwrite++;
+			if (pos < max) {
+				buf[pos++] = '%';
+				nwrite++;
+			}
 			break;
 		case 'i':
 			// increment both params
@@ -801,18 +2567,17 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			// pop char or string, write to output buffer
 			// optimized version of formatted output operator below
 			str = stk_pop_str(&stk);
-			for (i = 0; str[i] && pos < TI_PARM_OUTPUT_MAX; i++) {
+			for (i = 0; str[i] && pos < max; i++) {
 				buf[pos++] = str[i];
 				nwrite++;
 			}
-			free(str);
 			break;
 		case 'd':
 			// pop int, print
 			// optimized version of formatted output operator below
 			ai = stk_pop_num(&stk);
 			snprintf(sstr, TI_PARM_STRING_MAX, "%d", ai);
-			for (i = 0; sstr[i] && pos < TI_PARM_OUTPUT_MAX; i++) {
+			for (i = 0; sstr[i] && pos < max; i++) {
 				buf[pos++] = sstr[i];
 				nwrite++;
 			}
@@ -828,50 +2593,27 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			break;
 		case 'P':
 			// pop & store variable
-			// free already set var before setting new
 			if (*pch >= 'A' && *pch <= 'Z') {
-				ai = *pch-'A';
-				if (svars[ai]) {
-					free(svars[ai]);
-				}
-				svars[ai] = stk_pop_str(&stk);
+				stk_pop_var(&stk, &ctx->svars[*pch-'A']);
 			} else if (*pch >= 'a' && *pch <= 'z') {
-				ai = *pch-'a';
-				if (dvars[ai]) {
-					free(dvars[ai]);
-				}
-				dvars[ai] = stk_pop_str(&stk);
+				stk_pop_var(&stk, &dvars[*pch-'a']);
 			}
 			pch++;
 			break;
 		case 'g':
 			// recall and push variable
 			if (*pch >= 'A' && *pch <= 'Z') {
-				if ((as = svars[*pch-'A'])) {
-					// strdup since strings are freed on pop
-					bs = malloc(strlen(as)+1);
-					strcpy(bs, as);
-					stk_push_str(&stk, bs);
-				} else {
-					stk_push_str(&stk, calloc(1, 1));
-				}
+				stk_push_var(&stk, &ctx->svars[*pch-'A']);
 			} else if (*pch >= 'a' && *pch <= 'z') {
-				if ((as = dvars[*pch-'a'])) {
-					// strdup since strings are freed on pop
-					bs = malloc(strlen(as)+1);
-					strcpy(bs, as);
-					stk_push_str(&stk, bs);
-				} else {
-					stk_push_str(&stk, calloc(1, 1));
-				}
+				stk_push_var(&stk, &dvars[*pch-'a']);
 			}
 			pch++;
 			break;
 		case '\'':
 			// push literal char
-			str = calloc(1, 2);
-			str[0] = *pch++;
-			stk_push_str(&stk, str);
+			sstr[0] = *pch++;
+			sstr[1] = '\0';
+			stk_push_str(&stk, sstr);
 			pch++; // must be ' but we don't check
 			break;
 		case '{':
@@ -889,7 +2631,6 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			// pop str, push length
 			str = stk_pop_str(&stk);
 			stk_push_num(&stk, strlen(str));
-			free(str);
 			break;
 		case '+':
 			// pop int, pop int, add, push int
@@ -966,8 +2707,6 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			bs = stk_pop_str(&stk);
 			as = stk_pop_str(&stk);
 			stk_push_num(&stk, strcmp(bs, as)==0);
-			free(bs); bs = NULL;
-			free(as); as = NULL;
 			break;
 		case '>':
 			// pop int, pop int, greater than, push bool
@@ -1018,7 +2757,7 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			case 'd': case 'x': case 'X': case 'o':
 				ai = stk_pop_num(&stk);
 				snprintf(sstr, TI_PARM_STRING_MAX, fmt, ai);
-				ai = TI_PARM_OUTPUT_MAX;
+				ai = max;
 				for (i = 0; sstr[i] && pos < ai; i++) {
 					buf[pos++] = sstr[i];
 					nwrite++;
@@ -1027,12 +2766,11 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 			case 'c': case 's':
 				str = stk_pop_str(&stk);
 				snprintf(sstr, TI_PARM_STRING_MAX, fmt, str);
-				ai = TI_PARM_OUTPUT_MAX;
+				ai = max;
 				for (i = 0; sstr[i] && pos < ai; i++) {
 					buf[pos++] = sstr[i];
 					nwrite++;
 				}
-				free(str);
 				break;
 			}
 			break;
@@ -1103,16 +2841,791 @@ int ti_parm(char *buf, const char *s, int c, ...) {
 		}
 	}
 
-	// free anything left on the stack
-	stk_free(&stk);
+	buf[pos] = '\0';
+	return nwrite;
+}
+
+int ti_parm(char *buf, const char *s, int c, ...) {
+	if (!s) return 0;
+
+	// load varg params into fixed size int array for easier referencing.
+	va_list ap;
+	va_start(ap, c);
+	int params[TI_PARM_PARAMS_MAX] = {0};
+	for (int i = 0; i < TI_PARM_PARAMS_MAX && i < c; i++) {
+		params[i] = va_arg(ap, int);
+	}
+	va_end(ap);
+
+	return ti_parm_run(&ti_parm_default, buf, TI_PARM_OUTPUT_MAX - 1, s, params);
+}
+
+int ti_parm_r(ti_parm_ctx *ctx, char *buf, size_t bufsz, const char *s,
+              const int *params, int n) {
+	if (!s || !bufsz) return 0;
+
+	int p[TI_PARM_PARAMS_MAX] = {0};
+	for (int i = 0; i < TI_PARM_PARAMS_MAX && i < n; i++) {
+		p[i] = params[i];
+	}
+
+	return ti_parm_run(ctx ? ctx : &ti_parm_default, buf, ti_parm_max(bufsz),
+	                   s, p);
+}
+
+
+/*
+ * Compiled parameterized strings
+ *
+ * ti_parm_compile() parses a parameterized string once into a flat array of
+ * ops that ti_parm_exec() runs without looking at the source again. Runs of
+ * literal text become a single copy, %? %t %e %; become conditional and
+ * unconditional jumps, and printf style formats are decoded into the format
+ * string passed to snprintf.
+ *
+ * Output is byte-identical with ti_parm(). Jump targets are found with the
+ * same scan ti_parm() uses to skip over then and else parts, so strings where
+ * that scan doesn't land on an instruction boundary, or whose formats don't
+ * fit ti_parm()'s format buffer, keep a copy of the source and are handed to
+ * the interpreter.
+ */
+
+#define TI_OP_END   0   // stop
+#define TI_OP_LIT   1   // copy len bytes at pool+arg
+#define TI_OP_INC   2   // %i
+#define TI_OP_PUTS  3   // %c %s
+#define TI_OP_PUTD  4   // %d
+#define TI_OP_PUTF  5   // formatted number, format at pool+arg
+#define TI_OP_PUTFS 6   // formatted string, format at pool+arg
+#define TI_OP_PARM  7   // push param arg
+#define TI_OP_NUM   8   // push number arg
+#define TI_OP_CHAR  9   // push one char string arg
+#define TI_OP_SETS  10  // pop into static var arg
+#define TI_OP_SETD  11  // pop into dynamic var arg
+#define TI_OP_GETS  12  // push static var arg
+#define TI_OP_GETD  13  // push dynamic var arg
+#define TI_OP_LEN   14  // %l
+#define TI_OP_BIN   15  // binary operator arg: + - * / m & | ^ A O = > <
+#define TI_OP_NOT   16  // %!
+#define TI_OP_CPL   17  // %~
+#define TI_OP_JZ    18  // pop number, jump to op arg when zero
+#define TI_OP_JMP   19  // jump to op arg
+
+#define TI_OP_LIT_MAX 0xffff
+
+struct ti_parm_op {
+	uint16_t op;
+	uint16_t len;    // literal length
+	int32_t  arg;
+};
+
+struct ti_parm_prog {
+	const char *src;              // source when interpreted, otherwise NULL
+	const char *pool;             // literal text and formats
+	int nops;
+	struct ti_parm_op ops[];
+};
+
+// Return the offset ti_parm() continues at after skipping a then part (else
+// is set) or an else part, starting at offset i.
+static int ti_parm_skip(const char *s, int i, int stop_at_else) {
+	int nest = 0, done = 0;
+	while (s[i] && !done) {
+		if (s[i++] != '%') continue;
+		switch (s[i++]) {
+		case ';':
+			done = !nest;
+			nest--;
+			break;
+		case '?':
+			nest++;
+			break;
+		case 'e':
+			if (stop_at_else) done = !nest;
+			break;
+		}
+		// "%" at the end of the string leaves i past the terminator
+		if (!s[i - 1]) return i - 1;
+	}
+	return i;
+}
+
+ti_parm_prog *ti_parm_compile(const char *s) {
+	if (!s) return NULL;
+
+	int slen = strlen(s);
+
+	// at most one op per source byte plus the end, and the pool never holds
+	// more than two bytes per source byte: literals and formats with a NUL
+	struct ti_parm_op *ops = malloc((slen + 1) * sizeof(*ops));
+	int *at = malloc((slen + 1) * sizeof(int));
+	char *pool = malloc(2 * slen + 1);
+	if (!ops || !at || !pool) {
+		free(ops);
+		free(at);
+		free(pool);
+		return NULL;
+	}
+
+	int nops = 0, npool = 0;
+	int lit = -1;         // op index of the literal run being extended
+	int interp = 0;       // compilation gave up, interpret the source
+	int i = 0;
+
+	for (int j = 0; j <= slen; j++) at[j] = -1;
+
+	while (s[i]) {
+		int start = i;
+		char ch = s[i];
+
+		if (ch != '%' || s[i + 1] == '%') {
+			// literal text and %%
+			i += (ch == '%') ? 2 : 1;
+			if (lit < 0 || ops[lit].len == TI_OP_LIT_MAX) {
+				at[start] = nops;
+				lit = nops;
+				ops[nops++] = (struct ti_parm_op){TI_OP_LIT, 0, npool};
+			}
+			pool[npool++] = ch;
+			ops[lit].len++;
+			continue;
+		}
+
+		lit = -1;
+		at[start] = nops;
+		i++; // skip over '%'
+
+		struct ti_parm_op op = {TI_OP_END, 0, 0};
+		ch = s[i++];
+		switch (ch) {
+		case 'i':
+			op.op = TI_OP_INC;
+			break;
+		case 'c': case 's':
+			op.op = TI_OP_PUTS;
+			break;
+		case 'd':
+			op.op = TI_OP_PUTD;
+			break;
+		case 'p':
+			if (!s[i]) goto done;
+			op.arg = s[i++] - '1';
+			if (op.arg >= 0 && op.arg < TI_PARM_PARAMS_MAX) {
+				op.op = TI_OP_PARM;
+			} else {
+				op.op = TI_OP_NUM;
+				op.arg = 0;
+			}
+			break;
+		case 'P': case 'g':
+			if (!s[i]) goto done;
+			if (s[i] >= 'A' && s[i] <= 'Z') {
+				op.op = ch == 'P' ? TI_OP_SETS : TI_OP_GETS;
+				op.arg = s[i] - 'A';
+			} else if (s[i] >= 'a' && s[i] <= 'z') {
+				op.op = ch == 'P' ? TI_OP_SETD : TI_OP_GETD;
+				op.arg = s[i] - 'a';
+			} else {
+				i++;
+				continue;
+			}
+			i++;
+			break;
+		case '\'':
+			op.op = TI_OP_CHAR;
+			op.arg = (unsigned char)s[i];
+			if (s[i]) i++;
+			if (s[i]) i++; // must be ' but we don't check
+			break;
+		case '{':
+			op.op = TI_OP_NUM;
+			for (; s[i] >= '0' && s[i] <= '9'; i++) {
+				op.arg = op.arg * 10 + (s[i] - '0');
+			}
+			if (s[i]) i++; // must be } but we don't check
+			break;
+		case 'l':
+			op.op = TI_OP_LEN;
+			break;
+		case '+': case '-': case '*': case '/': case 'm':
+		case '&': case '|': case '^': case 'A': case 'O':
+		case '=': case '>': case '<':
+			op.op = TI_OP_BIN;
+			op.arg = ch;
+			break;
+		case '!':
+			op.op = TI_OP_NOT;
+			break;
+		case '~':
+			op.op = TI_OP_CPL;
+			break;
+
+		case '0': case '1': case '2': case '3': case '4':
+		case 'x': case 'X': case 'o': case ':': case ' ': {
+			// decode the format the same way ti_parm() does
+			char fmt[16];
+			size_t fpos = 0;
+			fmt[fpos++] = '%';
+			i--;
+			if (s[i] == ':') i++;
+			while (s[i]=='+'||s[i]=='-'||s[i]=='#'||s[i]==' ') {
+				if (fpos < sizeof(fmt)) fmt[fpos++] = s[i];
+				i++;
+			}
+			while ((s[i]>='0' && s[i]<='9') || s[i]=='.') {
+				if (fpos < sizeof(fmt)) fmt[fpos++] = s[i];
+				i++;
+			}
+			if (!s[i] || fpos + 2 > sizeof(fmt)) {
+				interp = 1;
+				goto done;
+			}
+			fmt[fpos++] = s[i++];
+
+			switch (s[i - 1]) {
+			case 'd': case 'x': case 'X': case 'o':
+				op.op = TI_OP_PUTF;
+				break;
+			case 'c': case 's':
+				op.op = TI_OP_PUTFS;
+				break;
+			default:
+				// unknown conversions print nothing
+				continue;
+			}
+			op.arg = npool;
+			memcpy(pool + npool, fmt, fpos);
+			npool += fpos;
+			pool[npool++] = '\0';
+			break;
+		}
+
+		case 't':
+			// jump over the then part, target resolved below
+			op.op = TI_OP_JZ;
+			op.arg = ti_parm_skip(s, i, 1);
+			break;
+		case 'e':
+			// reached the end of a then part, jump over the else part
+			op.op = TI_OP_JMP;
+			op.arg = ti_parm_skip(s, i, 0);
+			break;
+		case '\0':
+			goto done;
+		default:
+			// %? %; and invalid instructions do nothing
+			continue;
+		}
+		ops[nops++] = op;
+	}
+
+done:
+	at[slen] = nops;
+	ops[nops++] = (struct ti_parm_op){TI_OP_END, 0, 0};
+
+	// resolve jump targets from source offsets to ops
+	for (int j = 0; j < nops && !interp; j++) {
+		if (ops[j].op != TI_OP_JZ && ops[j].op != TI_OP_JMP) continue;
+		if (at[ops[j].arg] < 0) {
+			interp = 1;
+		} else {
+			ops[j].arg = at[ops[j].arg];
+		}
+	}
+
+	if (interp) {
+		nops = 0;
+		npool = slen + 1;
+		memcpy(pool, s, npool);
+	}
+
+	ti_parm_prog *prog = malloc(sizeof(*prog) + nops * sizeof(*ops) + npool);
+	if (prog) {
+		char *p = (char*)&prog->ops[nops];
+		memcpy(prog->ops, ops, nops * sizeof(*ops));
+		memcpy(p, pool, npool);
+		prog->src = interp ? p : NULL;
+		prog->pool = p;
+		prog->nops = nops;
+	}
+
+	free(ops);
+	free(at);
+	free(pool);
+	return prog;
+}
+
+void ti_parm_free(ti_parm_prog *prog) {
+	free(prog);
+}
+
+// Write the string in sstr to buf at pos, returning the new pos.
+static int ti_parm_put(char *buf, int pos, int max, const char *sstr) {
+	for (int i = 0; sstr[i] && pos < max; i++) {
+		buf[pos++] = sstr[i];
+	}
+	return pos;
+}
+
+// Write num in decimal to buf at pos like "%d", returning the new pos.
+static int ti_parm_putd(char *buf, int pos, int max, int num) {
+	char tmp[16];
+	int n = 0;
+	unsigned int u = num < 0 ? -(unsigned int)num : (unsigned int)num;
+	do {
+		tmp[n++] = '0' + u % 10;
+		u /= 10;
+	} while (u);
+	if (num < 0) tmp[n++] = '-';
+	while (n && pos < max) {
+		buf[pos++] = tmp[--n];
+	}
+	return pos;
+}
+
+int ti_parm_exec_r(ti_parm_ctx *ctx, const ti_parm_prog *prog, char *buf,
+                   size_t bufsz, const int *params, int n) {
+	if (!prog || !bufsz) return 0;
+	if (!ctx) ctx = &ti_parm_default;
+
+	int p[TI_PARM_PARAMS_MAX] = {0};
+	for (int i = 0; i < TI_PARM_PARAMS_MAX && i < n; i++) {
+		p[i] = params[i];
+	}
+
+	int max = ti_parm_max(bufsz);
+	if (prog->src) return ti_parm_run(ctx, buf, max, prog->src, p);
+
+	struct stk stk = {0};
+	struct stk_el dvars[26] = {0};
+	char sstr[TI_PARM_STRING_MAX];
+	const char *str, *as, *bs;
+	int ai, bi;
+	int pos = 0;
 
-	// free dynamic variables
-	for (i = 0; i < 26; i++) {
-		free(dvars[i]);
+	for (const struct ti_parm_op *op = prog->ops;; op++) {
+		switch (op->op) {
+		case TI_OP_END:
+			goto done;
+		case TI_OP_LIT:
+			ai = op->len < max - pos ? op->len : max - pos;
+			memcpy(buf + pos, prog->pool + op->arg, ai);
+			pos += ai;
+			break;
+		case TI_OP_INC:
+			p[0]++;
+			p[1]++;
+			break;
+		case TI_OP_PUTS:
+			pos = ti_parm_put(buf, pos, max, stk_pop_str(&stk));
+			break;
+		case TI_OP_PUTD:
+			pos = ti_parm_putd(buf, pos, max, stk_pop_num(&stk));
+			break;
+		case TI_OP_PUTF:
+			snprintf(sstr, TI_PARM_STRING_MAX, prog->pool + op->arg,
+			         stk_pop_num(&stk));
+			pos = ti_parm_put(buf, pos, max, sstr);
+			break;
+		case TI_OP_PUTFS:
+			str = stk_pop_str(&stk);
+			snprintf(sstr, TI_PARM_STRING_MAX, prog->pool + op->arg, str);
+			pos = ti_parm_put(buf, pos, max, sstr);
+			break;
+		case TI_OP_PARM:
+			stk_push_num(&stk, p[op->arg]);
+			break;
+		case TI_OP_NUM:
+			stk_push_num(&stk, op->arg);
+			break;
+		case TI_OP_CHAR:
+			sstr[0] = op->arg;
+			sstr[1] = '\0';
+			stk_push_str(&stk, sstr);
+			break;
+		case TI_OP_SETS:
+			stk_pop_var(&stk, &ctx->svars[op->arg]);
+			break;
+		case TI_OP_SETD:
+			stk_pop_var(&stk, &dvars[op->arg]);
+			break;
+		case TI_OP_GETS:
+			stk_push_var(&stk, &ctx->svars[op->arg]);
+			break;
+		case TI_OP_GETD:
+			stk_push_var(&stk, &dvars[op->arg]);
+			break;
+		case TI_OP_LEN:
+			stk_push_num(&stk, strlen(stk_pop_str(&stk)));
+			break;
+		case TI_OP_BIN:
+			if (op->arg == '=') {
+				bs = stk_pop_str(&stk);
+				as = stk_pop_str(&stk);
+				stk_push_num(&stk, strcmp(bs, as)==0);
+				break;
+			}
+			bi = stk_pop_num(&stk);
+			ai = stk_pop_num(&stk);
+			switch (op->arg) {
+			case '+': ai = ai + bi; break;
+			case '-': ai = ai - bi; break;
+			case '*': ai = ai * bi; break;
+			case '/': ai = bi ? ai / bi : 0; break;
+			case 'm': ai = ai % bi; break;
+			case '&': ai = ai & bi; break;
+			case '|': ai = ai | bi; break;
+			case '^': ai = ai ^ bi; break;
+			case 'A': ai = ai && bi; break;
+			case 'O': ai = ai || bi; break;
+			case '>': ai = ai > bi; break;
+			case '<': ai = ai < bi; break;
+			}
+			stk_push_num(&stk, ai);
+			break;
+		case TI_OP_NOT:
+			stk_push_num(&stk, !stk_pop_num(&stk));
+			break;
+		case TI_OP_CPL:
+			stk_push_num(&stk, ~stk_pop_num(&stk));
+			break;
+		case TI_OP_JZ:
+			if (stk_pop_num(&stk)) break;
+			op = &prog->ops[op->arg] - 1;
+			break;
+		case TI_OP_JMP:
+			op = &prog->ops[op->arg] - 1;
+			break;
+		}
 	}
 
+done:
 	buf[pos] = '\0';
-	return nwrite;
+	return pos;
+}
+
+int ti_parm_exec(const ti_parm_prog *prog, char *buf, const int *params, int n) {
+	return ti_parm_exec_r(&ti_parm_default, prog, buf, TI_PARM_OUTPUT_MAX,
+	                      params, n);
+}
+
+
+/*
+ * Fast parameterized string formatting
+ *
+ * Almost every terminal uses one of a few shapes for its cursor movement and
+ * color strings: "\E[%i%p1%d;%p2%dH" for cup, "\E[%p1%dC" for cuf, and the
+ * xterm 16/256 color conditional for setaf and setab. ti_fastparm_bind()
+ * matches a string against a table of those templates and binds a formatter
+ * that writes the literal parts of the string around the decimal params
+ * directly. Strings that don't match any template are formatted with
+ * ti_parm_r() using the default context.
+ *
+ * In template patterns "*" captures a run of literal text and everything else
+ * must match the string exactly. Captures are kept as slices of the bound
+ * string in the lit array in order.
+ */
+
+typedef int (*ti_fast_fn)(const ti_fastparm *fp, char *buf, const int *p);
+
+// Two digit decimal lookup table.
+static const char ti_digits2[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+// Write num in decimal to buf like "%d", returning the number of bytes written.
+static int ti_fast_dec(char *buf, int num) {
+	char tmp[12];
+	char *p = tmp + sizeof(tmp);
+	unsigned int u = num < 0 ? -(unsigned int)num : (unsigned int)num;
+	while (u >= 100) {
+		p -= 2;
+		memcpy(p, ti_digits2 + (u % 100) * 2, 2);
+		u /= 100;
+	}
+	if (u >= 10) {
+		p -= 2;
+		memcpy(p, ti_digits2 + u * 2, 2);
+	} else {
+		*--p = '0' + u;
+	}
+	if (num < 0) *--p = '-';
+
+	int n = tmp + sizeof(tmp) - p;
+	memcpy(buf, p, n);
+	return n;
+}
+
+// Write literal slice i of fp to buf, returning the number of bytes written.
+static inline int ti_fast_lit(const ti_fastparm *fp, int i, char *buf) {
+	memcpy(buf, fp->lit[i], fp->litlen[i]);
+	return fp->litlen[i];
+}
+
+static int ti_fast_generic(const ti_fastparm *fp, char *buf, const int *p) {
+	return ti_parm_r(NULL, buf, TI_PARM_OUTPUT_MAX, fp->ps, p,
+	                 TI_PARM_PARAMS_MAX);
+}
+
+static int ti_fast_none(const ti_fastparm *fp, char *buf, const int *p) {
+	(void)fp; (void)p;
+	buf[0] = '\0';
+	return 0;
+}
+
+// "*%p1%d*" and "*%i%p1%d*"
+static int ti_fast_p1(const ti_fastparm *fp, char *buf, const int *p) {
+	int n = ti_fast_lit(fp, 0, buf);
+	n += ti_fast_dec(buf + n, p[0] + fp->inc);
+	n += ti_fast_lit(fp, 1, buf + n);
+	buf[n] = '\0';
+	return n;
+}
+
+// "*%p1%d*%p2%d*" and "*%i%p1%d*%p2%d*"
+static int ti_fast_p1p2(const ti_fastparm *fp, char *buf, const int *p) {
+	int n = ti_fast_lit(fp, 0, buf);
+	n += ti_fast_dec(buf + n, p[0] + fp->inc);
+	n += ti_fast_lit(fp, 1, buf + n);
+	n += ti_fast_dec(buf + n, p[1] + fp->inc);
+	n += ti_fast_lit(fp, 2, buf + n);
+	buf[n] = '\0';
+	return n;
+}
+
+// 8 color conditional with a fallback for higher colors
+static int ti_fast_color8(const ti_fastparm *fp, char *buf, const int *p) {
+	int n = ti_fast_lit(fp, 0, buf);
+	n += ti_fast_lit(fp, p[0] < 8 ? 1 : 2, buf + n);
+	n += ti_fast_dec(buf + n, p[0]);
+	n += ti_fast_lit(fp, 3, buf + n);
+	buf[n] = '\0';
+	return n;
+}
+
+// 8 color conditional, 8 bright colors, and a fallback for higher colors
+static int ti_fast_color16(const ti_fastparm *fp, char *buf, const int *p) {
+	int n = ti_fast_lit(fp, 0, buf);
+	if (p[0] < 8) {
+		n += ti_fast_lit(fp, 1, buf + n);
+		n += ti_fast_dec(buf + n, p[0]);
+	} else if (p[0] < 16) {
+		n += ti_fast_lit(fp, 2, buf + n);
+		n += ti_fast_dec(buf + n, p[0] - 8);
+	} else {
+		n += ti_fast_lit(fp, 3, buf + n);
+		n += ti_fast_dec(buf + n, p[0]);
+	}
+	n += ti_fast_lit(fp, 4, buf + n);
+	buf[n] = '\0';
+	return n;
+}
+
+static const struct ti_fast_template {
+	int         kind;
+	int         inc;       // value %i adds to params
+	int         nparams;
+	const char *pat;
+	ti_fast_fn  fn;
+} ti_fast_templates[] = {
+	{TI_FAST_P1,      0, 1, "*%p1%d*",           ti_fast_p1},
+	{TI_FAST_P1,      1, 1, "*%i%p1%d*",         ti_fast_p1},
+	{TI_FAST_P1P2,    0, 2, "*%p1%d*%p2%d*",     ti_fast_p1p2},
+	{TI_FAST_P1P2,    1, 2, "*%i%p1%d*%p2%d*",   ti_fast_p1p2},
+	{TI_FAST_COLOR8,  0, 1,
+		"*%?%p1%{8}%<%t*%p1%d%e*%p1%d%;*", ti_fast_color8},
+	{TI_FAST_COLOR16, 0, 1,
+		"*%?%p1%{8}%<%t*%p1%d%e%p1%{16}%<%t*%p1%{8}%-%d%e*%p1%d%;*",
+		ti_fast_color16},
+};
+
+// Match ps against a template pattern, capturing literal runs into fp.
+// Returns 1 when the whole string matches.
+static int ti_fast_match(ti_fastparm *fp, const char *ps, const char *pat) {
+	int nlit = 0;
+	for (; *pat; pat++) {
+		if (*pat != '*') {
+			if (*ps++ != *pat) return 0;
+			continue;
+		}
+		const char *start = ps;
+		while (*ps && *ps != '%') ps++;
+		if (ps - start > UINT8_MAX || nlit == TI_FAST_LIT_MAX) return 0;
+		fp->lit[nlit] = start;
+		fp->litlen[nlit++] = ps - start;
+	}
+	return *ps == '\0';
+}
+
+void ti_fastparm_bind(ti_fastparm *fp, const char *ps) {
+	memset(fp, 0, sizeof(*fp));
+	fp->ps = ps;
+	if (!ps) {
+		fp->kind = TI_FAST_NONE;
+		fp->fn = ti_fast_none;
+		return;
+	}
+
+	int n = sizeof(ti_fast_templates) / sizeof(ti_fast_templates[0]);
+	for (int i = 0; i < n; i++) {
+		const struct ti_fast_template *t = &ti_fast_templates[i];
+		if (!ti_fast_match(fp, ps, t->pat)) continue;
+		fp->kind = t->kind;
+		fp->inc = t->inc;
+		fp->nparams = t->nparams;
+		fp->fn = t->fn;
+		return;
+	}
+
+	memset(fp->lit, 0, sizeof(fp->lit));
+	memset(fp->litlen, 0, sizeof(fp->litlen));
+	fp->kind = TI_FAST_GENERIC;
+	fp->nparams = TI_PARM_PARAMS_MAX;
+	fp->fn = ti_fast_generic;
+}
+
+int ti_fastparm_fmt(const ti_fastparm *fp, char *buf, const int *params, int n) {
+	if (n >= fp->nparams) return fp->fn(fp, buf, params);
+
+	int p[TI_PARM_PARAMS_MAX] = {0};
+	for (int i = 0; i < n; i++) {
+		p[i] = params[i];
+	}
+	return fp->fn(fp, buf, p);
+}
+
+void ti_fastcaps_init(ti_fastcaps *fc, ti_terminfo *ti) {
+	ti_fastparm_bind(&fc->cup, ti_getstri(ti, ti_cup));
+	ti_fastparm_bind(&fc->hpa, ti_getstri(ti, ti_hpa));
+	ti_fastparm_bind(&fc->vpa, ti_getstri(ti, ti_vpa));
+	ti_fastparm_bind(&fc->cuf, ti_getstri(ti, ti_cuf));
+	ti_fastparm_bind(&fc->cub, ti_getstri(ti, ti_cub));
+	ti_fastparm_bind(&fc->cuu, ti_getstri(ti, ti_cuu));
+	ti_fastparm_bind(&fc->cud, ti_getstri(ti, ti_cud));
+	ti_fastparm_bind(&fc->setaf, ti_getstri(ti, ti_setaf));
+	ti_fastparm_bind(&fc->setab, ti_getstri(ti, ti_setab));
+}
+
+
+/*
+ * Color sequence tables
+ *
+ * A ti_colortab holds the setaf and setab expansion of every color the
+ * terminal supports, followed by op and sgr0, in one allocation: the table
+ * header, an offset/length index, and a string arena where each sequence is
+ * followed by a null terminator. Lookups return slices of the arena.
+ */
+
+#define TI_COLORTAB_MAX 256
+
+struct ti_colortab_ent {
+	uint32_t off;  // arena offset
+	uint32_t len;
+};
+
+struct ti_colortab {
+	int ncolors;
+	const char *arena;
+	struct ti_colortab_ent ent[];  // fg colors, bg colors, op, sgr0
+};
+
+ti_colortab *ti_colortab_new(ti_terminfo *ti) {
+	int ncolors = ti_getnumi(ti, ti_colors);
+	if (ncolors < 0) ncolors = 0;
+	if (ncolors > TI_COLORTAB_MAX) ncolors = TI_COLORTAB_MAX;
+	int nent = 2 * ncolors + 2;
+
+	ti_fastparm setaf, setab;
+	ti_fastparm_bind(&setaf, ti_getstri(ti, ti_setaf));
+	ti_fastparm_bind(&setab, ti_getstri(ti, ti_setab));
+	const char *op = ti_getstri(ti, ti_op);
+	const char *sgr0 = ti_getstri(ti, ti_sgr0);
+
+	// expand everything into a scratch arena first, sized generously for
+	// the usual few bytes per sequence and grown when that's not enough
+	size_t cap = nent * 32 + 2 * TI_PARM_OUTPUT_MAX;
+	size_t len = 0;
+	uint32_t *lens = malloc(nent * sizeof(uint32_t));
+	char *scratch = malloc(cap);
+	if (!lens || !scratch) goto fail;
+
+	for (int i = 0; i < nent; i++) {
+		if (cap - len < TI_PARM_OUTPUT_MAX + 1) {
+			char *p = realloc(scratch, cap * 2);
+			if (!p) goto fail;
+			scratch = p;
+			cap *= 2;
+		}
+		char *out = scratch + len;
+		int n;
+		if (i < 2 * ncolors) {
+			int color = i % ncolors;
+			n = ti_fastparm_fmt(i < ncolors ? &setaf : &setab, out, &color, 1);
+		} else {
+			const char *s = (i == nent - 2) ? op : sgr0;
+			n = s ? strlen(s) : 0;
+			memcpy(out, s ? s : "", n + 1);
+		}
+		lens[i] = n;
+		len += n + 1;
+	}
+
+	size_t hdr = sizeof(ti_colortab) + nent * sizeof(struct ti_colortab_ent);
+	ti_colortab *tab = malloc(hdr + len);
+	if (!tab) goto fail;
+
+	char *arena = (char*)tab + hdr;
+	memcpy(arena, scratch, len);
+	tab->ncolors = ncolors;
+	tab->arena = arena;
+	uint32_t off = 0;
+	for (int i = 0; i < nent; i++) {
+		tab->ent[i].off = off;
+		tab->ent[i].len = lens[i];
+		off += lens[i] + 1;
+	}
+
+	free(lens);
+	free(scratch);
+	return tab;
+
+fail:
+	free(lens);
+	free(scratch);
+	return NULL;
+}
+
+void ti_colortab_free(ti_colortab *tab) {
+	free(tab);
+}
+
+int ti_colortab_count(const ti_colortab *tab) {
+	return tab->ncolors;
+}
+
+static inline ti_slice ti_colortab_slice(const ti_colortab *tab, int i) {
+	return (ti_slice){tab->arena + tab->ent[i].off, tab->ent[i].len};
+}
+
+ti_slice ti_colortab_fg(const ti_colortab *tab, int color) {
+	if (color < 0 || color >= tab->ncolors) return (ti_slice){"", 0};
+	return ti_colortab_slice(tab, color);
+}
+
+ti_slice ti_colortab_bg(const ti_colortab *tab, int color) {
+	if (color < 0 || color >= tab->ncolors) return (ti_slice){"", 0};
+	return ti_colortab_slice(tab, tab->ncolors + color);
+}
+
+ti_slice ti_colortab_op(const ti_colortab *tab) {
+	return ti_colortab_slice(tab, 2 * tab->ncolors);
+}
+
+ti_slice ti_colortab_sgr0(const ti_colortab *tab) {
+	return ti_colortab_slice(tab, 2 * tab->ncolors + 1);
 }
 
 // vim: noexpandtab
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*
@@ -53,9 +54,25 @@ typedef struct ti_terminfo {
 
 	char   **ext_names;          // array of extended cap names pointers
 	int16_t  ext_names_count;    // ext_names array size
+	uint16_t *ext_hash;          // ext_names hash index (ext_names index + 1)
+	uint16_t  ext_hash_mask;     // ext_hash array size - 1
 
 	char *   data;               // raw terminfo data loaded from file
 	int      len;                // size of data in bytes
+
+	// Raw on-disk sections used to decode capabilities on access when the
+	// nums, strs, ext_nums, ext_strs, and ext_names arrays are not
+	// allocated. See ti_load_mmap().
+	const char *raw_nums;        // numeric caps (16 or 32-bit values)
+	const char *raw_stroffs;     // string cap offsets into raw_strtbl
+	const char *raw_strtbl;      // string table
+	const char *raw_ext_nums;    // extended numeric caps
+	const char *raw_ext_stroffs; // extended string offsets, then name offsets
+	const char *raw_ext_strtbl;  // extended string table
+	const char *raw_ext_nametbl; // extended name table
+	int16_t     numsz;           // size in bytes of raw numeric caps
+
+	int16_t     flags;           // TI_F_XXX flags describing data ownership
 } ti_terminfo;
 
 /*
@@ -74,6 +91,114 @@ typedef struct ti_terminfo {
 ti_terminfo *ti_load(const char *termname, int *err);
 void         ti_free(ti_terminfo *ti);
 
+/*
+ * Like ti_load() but maps the terminfo file into memory read-only instead of
+ * reading it onto the heap. All ti_terminfo tables point straight into the
+ * mapping and numeric and string capabilities are decoded from the on-disk
+ * layout on access, so loading costs one open, one mmap, and a single small
+ * allocation for the ti_terminfo struct.
+ *
+ * Terminfo structs loaded this way must be accessed with the ti_getxxx()
+ * functions only; the nums, strs, ext_nums, ext_strs, and ext_names members
+ * are NULL. Use ti_free() to unmap the file.
+ */
+ti_terminfo *ti_load_mmap(const char *termname, int *err);
+
+/*
+ * Like ti_load() but packs the ti_terminfo struct, numeric capabilities, and
+ * a copy of the terminfo file into a single allocation. String capabilities
+ * and extended capability names are kept as the file's 16-bit offsets and
+ * decoded on access, so a loaded terminal takes less than half the memory of
+ * ti_load() in one heap block instead of up to eight.
+ *
+ * Terminfo structs loaded this way must be accessed with the ti_getxxx()
+ * functions only; the strs, ext_strs, and ext_names members are NULL. Use
+ * ti_free() to release the struct.
+ */
+ti_terminfo *ti_load_compact(const char *termname, int *err);
+
+/*
+ * Terminfo struct flags
+ *
+ * Set in the ti_terminfo flags member by the loading functions.
+ */
+#define TI_F_MMAP    0x0001  // data is a read-only file mapping
+#define TI_F_SHARED  0x0002  // owned by the shared cache; see ti_release()
+#define TI_F_STATIC  0x0004  // builtin read-only entry; see ti_load_builtin()
+#define TI_F_COMPACT 0x0008  // single allocation; see ti_load_compact()
+
+/*
+ * Load a terminfo struct from a process-wide cache shared by all callers.
+ *
+ * The first load of a terminal name searches the terminfo database and maps
+ * the file like ti_load_mmap(). Later loads of the same name return the same
+ * ti_terminfo pointer without doing any I/O, and names that resolve to the
+ * same file share one struct. Cached files are checked for modification at
+ * most once a second and the cache is dropped whenever TERMINFO,
+ * TERMINFO_DIRS, or HOME change.
+ *
+ * Structs returned from ti_load_shared() are immutable and must be released
+ * with ti_release() instead of ti_free(). They stay valid until released even
+ * if the cache drops them in the meantime. These functions are thread-safe.
+ *
+ * The ti_cache_flush() function drops all cached entries, freeing the ones
+ * that are not currently referenced.
+ */
+ti_terminfo *ti_load_shared(const char *termname, int *err);
+void         ti_release(ti_terminfo *ti);
+void         ti_cache_flush(void);
+
+/*
+ * Look up a terminal compiled into the library with tools/gencap-builtin,
+ * without doing any I/O or memory allocation. The termname argument may be
+ * any of the terminal's names, or NULL to use the TERM environment variable.
+ *
+ * Builtin entries are read-only and live for the life of the program;
+ * ti_free() and ti_release() ignore them. The other ti_load functions return
+ * builtin entries before searching the terminfo database unless the TERMINFO
+ * environment variable is set, in which case builtin entries are only used
+ * when no file is found.
+ *
+ * Returns NULL and sets err to ENOENT when no builtin entry matches.
+ */
+ti_terminfo *ti_load_builtin(const char *termname, int *err);
+
+/*
+ * Find the path of the terminfo file for the given terminal name, or the TERM
+ * environment variable when termname is NULL. The path is written to the path
+ * buffer, truncated to pathsz bytes.
+ *
+ * Search directories and letter (x/) or hex (78/) subdirectories that don't
+ * exist, and terminal names that weren't found, are remembered so that later
+ * lookups skip doomed filesystem probes.
+ * All ti_load functions use the same resolver. Cached state expires after a
+ * few seconds and is dropped when TERMINFO, TERMINFO_DIRS, or HOME change.
+ *
+ * A TERMINFO or TERMINFO_DIRS entry may also name a packed database file
+ * built with tools/tipack, which is mapped once and searched with a single
+ * hash probe. The path of the database is returned for entries found in one.
+ *
+ * Returns zero on success or an error code like ti_load(). When probes is not
+ * NULL it's set to the number of filesystem probes the lookup issued.
+ */
+int ti_resolve_path(const char *termname, char *path, size_t pathsz,
+                    int *probes);
+
+/*
+ * Path resolution statistics
+ *
+ * Totals for all lookups since the program started or ti_resolve_reset() was
+ * last called. Loads made by ti_load() and friends are included.
+ */
+struct ti_resolve_stats {
+	unsigned long resolves;       // number of path lookups
+	unsigned long probes;         // filesystem probes issued for lookups
+	unsigned long negative_hits;  // lookups answered as missing from cache
+};
+
+void ti_resolve_stats(struct ti_resolve_stats *stats);
+void ti_resolve_reset(void);
+
 /*
  * Error codes
  *
@@ -130,23 +255,255 @@ int   ti_getbooli(ti_terminfo *ti, int capindex);
 int   ti_getnumi(ti_terminfo *ti, int capindex);
 char *ti_getstri(ti_terminfo *ti, int capindex);
 
+/*
+ * Capability types
+ *
+ * Used to select boolean, numeric, or string capabilities in functions that
+ * operate on more than one type.
+ */
+#define TI_BOOL 1
+#define TI_NUM  2
+#define TI_STR  3
+
+/*
+ * Read extended capability names and values by index. The index must be less
+ * than the ext_bools_count, ext_nums_count, or ext_strs_count member for the
+ * given capability type. Use these to loop over all extended capabilities
+ * instead of accessing the ext_xxx struct members directly.
+ *
+ * The ti_extname() function returns the name of the extended capability of
+ * the given TI_BOOL, TI_NUM, or TI_STR type; NULL when the index is out of
+ * range. The value functions behave like ti_getbooli(), ti_getnumi(), and
+ * ti_getstri().
+ */
+const char *ti_extname(ti_terminfo *ti, int type, int i);
+int         ti_getextbooli(ti_terminfo *ti, int i);
+int         ti_getextnumi(ti_terminfo *ti, int i);
+char       *ti_getextstri(ti_terminfo *ti, int i);
+
+/*
+ * Capability descriptors for ti_getcaps()
+ *
+ * Each descriptor names a standard or extended capability, its TI_BOOL,
+ * TI_NUM, or TI_STR type, and the offset of the member in the caller's struct
+ * that receives its value: an int for booleans and numbers and a char pointer
+ * for strings. Use the TI_CAP() macro to fill in the offset:
+ *
+ *     struct caps { char *cup; char *setrgbf; int colors; int bce; };
+ *     static const struct ti_capdesc capdescs[] = {
+ *         TI_CAP(TI_STR,  "cup",     struct caps, cup),
+ *         TI_CAP(TI_STR,  "setrgbf", struct caps, setrgbf),
+ *         TI_CAP(TI_NUM,  "colors",  struct caps, colors),
+ *         TI_CAP(TI_BOOL, "bce",     struct caps, bce),
+ *     };
+ */
+struct ti_capdesc {
+	const char *name;            // terminfo capability name
+	int         type;            // TI_BOOL, TI_NUM, or TI_STR
+	size_t      offset;          // offset of the value in the output struct
+};
+
+#define TI_CAP(type, name, st, member) { (name), (type), offsetof(st, member) }
+
+/*
+ * Read the n capabilities described by descs into the struct at out, storing
+ * the same values ti_getbool(), ti_getnum(), and ti_getstr() return. When the
+ * missing argument is not NULL it must point to an array of n chars that is
+ * set to 1 for each capability the terminal doesn't have (unset booleans,
+ * negative numbers, and NULL strings) and 0 for the rest.
+ *
+ * Returns the number of missing capabilities.
+ */
+int ti_getcaps(ti_terminfo *ti, const struct ti_capdesc *descs, int n,
+               void *out, char *missing);
+
+/*
+ * Scan the whole terminfo database in parallel
+ *
+ * The ti_db_scan() function lists every terminal in the directories and
+ * packed databases ti_load() searches and parses them all on nthreads worker
+ * threads, or one per CPU when nthreads is zero. Entries are sorted by name,
+ * and when a name exists in more than one search path only the one ti_load()
+ * would use is listed. Entries that fail to parse are kept with their error.
+ *
+ * The scan also indexes which terminals define each capability: set
+ * booleans, non-negative numbers, and non-NULL strings, standard and
+ * extended. ti_scan_find() returns the number of terminals defining capname
+ * and points entries at their indexes in the entries array.
+ *
+ * Returns NULL and sets err when the scan can't allocate memory. Release the
+ * result with ti_scan_free().
+ */
+struct ti_scan_entry {
+	const char *name;            // terminal name
+	const char *path;            // file or packed database it was read from
+	int         err;             // zero or the error parsing the entry
+};
+
+typedef struct ti_scan {
+	struct ti_scan_entry *entries;   // all entries sorted by name
+	int nentries;
+	int nfailed;                     // entries with a non-zero err
+	struct ti_scan_index *index;     // internal
+} ti_scan;
+
+ti_scan *ti_db_scan(int nthreads, int *err);
+int      ti_scan_find(ti_scan *scan, const char *capname, const int **entries);
+void     ti_scan_free(ti_scan *scan);
+
 /*
  * Process terminfo parameterized string.
  * The c argument specifies the number of variadic arguments that follow.
+ * buf must have room for 4096 bytes, longer output is truncated.
+ *
+ * Static variables (%P[A-Z] and %g[A-Z]) are kept in a default context shared
+ * by ti_parm() and ti_parm_exec(), so neither is safe to call from more than
+ * one thread. Use ti_parm_r() and ti_parm_exec_r() with a context per thread
+ * or per terminal instead.
  *
  * Returns the number of bytes written not counting the null terminator.
  */
 int ti_parm(char *buf, const char *ps, int c, ...);
 
+/*
+ * Evaluation context holding the static variables set by parameterized
+ * strings. Contexts aren't locked and must not be used by more than one
+ * thread at a time. ti_parm_ctx_new() returns NULL when allocation fails.
+ */
+typedef struct ti_parm_ctx ti_parm_ctx;
+
+ti_parm_ctx *ti_parm_ctx_new(void);
+void         ti_parm_ctx_free(ti_parm_ctx *ctx);
+
+/*
+ * Process terminfo parameterized string with n params using the static
+ * variables in ctx, or the default context when ctx is NULL. At most bufsz
+ * bytes including the null terminator are written to buf.
+ *
+ * Returns the number of bytes written not counting the null terminator.
+ */
+int ti_parm_r(ti_parm_ctx *ctx, char *buf, size_t bufsz, const char *ps,
+              const int *params, int n);
+
+/*
+ * Compile a parameterized string into a program that can be run many times
+ * with ti_parm_exec() without parsing the string again. Output is the same as
+ * ti_parm() with the same params.
+ *
+ * Returns NULL when ps is NULL or memory allocation fails. The program must be
+ * freed with ti_parm_free() and doesn't reference ps after compiling.
+ */
+typedef struct ti_parm_prog ti_parm_prog;
+
+ti_parm_prog *ti_parm_compile(const char *ps);
+int           ti_parm_exec(const ti_parm_prog *prog, char *buf,
+                           const int *params, int n);
+int           ti_parm_exec_r(ti_parm_ctx *ctx, const ti_parm_prog *prog,
+                             char *buf, size_t bufsz, const int *params, int n);
+void          ti_parm_free(ti_parm_prog *prog);
+
+/*
+ * Fast formatting for cursor movement and color strings.
+ *
+ * ti_fastparm_bind() recognizes the few shapes almost all terminals use for
+ * cup, hpa, vpa, cuf, cub, cuu, cud, setaf, and setab, and binds a formatter
+ * that writes the literal parts of the string around the decimal params
+ * without interpreting it. Other strings are formatted with ti_parm_r() using
+ * the default context. Either way ti_fastparm_fmt() writes the same output as
+ * ti_parm() with n params from the params array and returns its length; buf
+ * must have room for it. NULL strings format as the empty string.
+ *
+ * ti_fastcaps_init() binds the cursor and color capabilities of a terminal,
+ * usually right after loading it. Bound strings point into ti, which must
+ * outlive them.
+ */
+#define TI_FAST_NONE    0  // no string
+#define TI_FAST_GENERIC 1  // formatted with ti_parm_r()
+#define TI_FAST_P1      2  // "...%p1%d..." with optional %i
+#define TI_FAST_P1P2    3  // "...%p1%d...%p2%d..." with optional %i
+#define TI_FAST_COLOR8  4  // 8 colors, then a fallback for the rest
+#define TI_FAST_COLOR16 5  // 8 colors, 8 bright colors, then a fallback
+#define TI_FAST_LIT_MAX 5
+
+typedef struct ti_fastparm {
+	int (*fn)(const struct ti_fastparm *fp, char *buf, const int *params);
+	const char *ps;                      // bound string
+	const char *lit[TI_FAST_LIT_MAX];    // literal parts of ps
+	uint8_t     litlen[TI_FAST_LIT_MAX]; // literal part lengths
+	int8_t      kind;                    // TI_FAST_XXX template matched
+	int8_t      inc;                     // added to params by %i
+	int8_t      nparams;                 // params the formatter reads
+} ti_fastparm;
+
+typedef struct ti_fastcaps {
+	ti_fastparm cup, hpa, vpa, cuf, cub, cuu, cud, setaf, setab;
+} ti_fastcaps;
+
+void ti_fastparm_bind(ti_fastparm *fp, const char *ps);
+int  ti_fastparm_fmt(const ti_fastparm *fp, char *buf, const int *params, int n);
+void ti_fastcaps_init(ti_fastcaps *fc, ti_terminfo *ti);
+
+/*
+ * Precomputed color sequences.
+ *
+ * ti_colortab_new() expands setaf and setab for every color the terminal
+ * supports, up to 256, along with op and sgr0, into a single allocation.
+ * The lookup functions return slices of it without copying: ptr points at the
+ * sequence, which is also null terminated, and len is its length. Colors out
+ * of range and missing capabilities give an empty slice.
+ *
+ * The table doesn't reference ti after it's built. Returns NULL when memory
+ * allocation fails. Free the table with ti_colortab_free().
+ */
+typedef struct ti_slice {
+	const char *ptr;
+	int         len;
+} ti_slice;
+
+typedef struct ti_colortab ti_colortab;
+
+ti_colortab *ti_colortab_new(ti_terminfo *ti);
+void         ti_colortab_free(ti_colortab *tab);
+int          ti_colortab_count(const ti_colortab *tab);
+ti_slice     ti_colortab_fg(const ti_colortab *tab, int color);
+ti_slice     ti_colortab_bg(const ti_colortab *tab, int color);
+ti_slice     ti_colortab_op(const ti_colortab *tab);
+ti_slice     ti_colortab_sgr0(const ti_colortab *tab);
+
 
 /*
  * Write escaped version of str to buf. All non-printable and control characters
- * are escaped. buf should be allocated to be 4x the size of str.
+ * are escaped. buf should be allocated to be 4x the size of str. At most n
+ * bytes including the null terminator are written and escapes are never cut
+ * in half.
  *
  * Returns the number of bytes written to buf.
  */
 int ti_stresc(char *buf, const char *str, int n);
 
+/*
+ * Escape a buffer of len bytes in pieces, for large inputs such as captured
+ * terminal traffic. Each ti_stresc_next() call escapes as much of the
+ * remaining input as fits in bufsz bytes of buf, without splitting escapes
+ * or null terminating, and returns the number of bytes written. The input is
+ * done when the len member reaches zero. bufsz must be at least 4 for every
+ * call to make progress.
+ *
+ * The flags select the tkbd_stresc() escapes on top of the ti_stresc() ones.
+ */
+#define TI_STRESC_BACKSLASH 0x1  // escape '\' as "\\"
+#define TI_STRESC_NUL       0x2  // escape NUL as "\0" instead of "\000"
+
+typedef struct ti_stresc_state {
+	const char *str;             // next input byte
+	size_t      len;             // input bytes left
+	int         flags;           // TI_STRESC_XXX
+} ti_stresc_state;
+
+void   ti_stresc_init(ti_stresc_state *st, const char *str, size_t len,
+                      int flags);
+size_t ti_stresc_next(ti_stresc_state *st, char *buf, size_t bufsz);
+
 /*
  * Capability name arrays.
  *
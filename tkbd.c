@@ -9,6 +9,7 @@
 
 #include "tkbd.h"
 #include "ti.h"
+#include "stresc.inl"
 
 #include <stdlib.h>            // strtoul
 #include <stddef.h>            // size_t
@@ -871,34 +872,11 @@ int tkbd_stresc(char *buf, const char *str, size_t strsz)
 	assert(buf);
 	assert(str);
 
-	// characters to escape and corresponding codes
-	static const char chars[] = {'\\','\t','\n','\r','\033','\0'};
-	static const char codes[] = {'\\', 't', 'n', 'r', 'e',   '0'};
+	// backslash and NUL get lettered escape codes along with \t \n \r \e
+	size_t used;
+	size_t n = stresc_kernel(buf, strsz * 4, str, strsz, &used,
+	                         STRESC_BACKSLASH | STRESC_NUL, STRESC_PATH_AUTO);
+	buf[n] = 0;
 
-	char *pb = buf;
-	const char *ps = str;
-	const char * const pse = str + strsz;
-
-	for (; ps < pse; ps++) {
-		if (*ps >= ' ' && *ps <= '~' && *ps != '\\') {
-			*pb++ = *ps;
-			continue;
-		}
-
-		*pb++ = '\\';
-		size_t i = 0;
-		for (; i < sizeof(chars); i++) {
-			if (*ps == chars[i]) {
-				*pb++ = codes[i];
-				break;
-			}
-		}
-		if (i < sizeof(chars))
-			continue;
-
-		pb += sprintf(pb, "%03hho", *ps);
-	}
-	*pb = 0;
-
-	return pb - buf;
+	return n;
 }
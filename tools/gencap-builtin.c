@@ -0,0 +1,171 @@
+/*
+ *
+ * gencap-builtin.c - Compile terminfo entries into static C data.
+ * Copyright (c) 2020, Auxrelius I <aux01@aux.life>
+ *
+ * Usage: tools/gencap-builtin <term>... >ti_builtin.inl
+ *
+ * Loads each named terminal from the terminfo database (honoring TERMINFO and
+ * TERMINFO_DIRS) and writes a C source file with a pre-parsed, read-only
+ * ti_terminfo image for each one. Build ti.c with -DTI_BUILTIN='"<file>"' to
+ * compile the images in; see ti_load_builtin() in ti.h.
+ *
+ *
+ */
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Write a C array initializer for n bytes of data.
+static void put_bytes(const char *data, int n) {
+	for (int i = 0; i < n; i++) {
+		printf("%s0x%02x,", (i % 12) ? " " : "\n\t", (unsigned char)data[i]);
+	}
+	printf("\n");
+}
+
+// Write a C array initializer for n ints.
+static void put_ints(const int32_t *v, int n) {
+	for (int i = 0; i < n; i++) {
+		printf("%s%d,", (i % 10) ? " " : "\n\t", v[i]);
+	}
+	printf("\n");
+}
+
+// Write a C array initializer for n unsigned shorts.
+static void put_shorts(const uint16_t *v, int n) {
+	for (int i = 0; i < n; i++) {
+		printf("%s%u,", (i % 10) ? " " : "\n\t", v[i]);
+	}
+	printf("\n");
+}
+
+// Write a C array initializer for n string pointers into data.
+static void put_strs(int idx, ti_terminfo *ti, char **strs, int n) {
+	for (int i = 0; i < n; i++) {
+		if (strs[i]) {
+			printf("\tTI_BI_STR(%d, %d),\n", idx, (int)(strs[i] - ti->data));
+		} else {
+			printf("\tNULL,\n");
+		}
+	}
+}
+
+// Write the static data for one terminal.
+static void put_term(int idx, ti_terminfo *ti) {
+	printf("// %s\n", ti->term_names);
+
+	printf("static const char ti_bi%d_data[] = {", idx);
+	put_bytes(ti->data, ti->len);
+	printf("};\n");
+
+	if (ti->nums_count) {
+		printf("static const int32_t ti_bi%d_nums[] = {", idx);
+		put_ints(ti->nums, ti->nums_count);
+		printf("};\n");
+	}
+	if (ti->strs_count) {
+		printf("static char * const ti_bi%d_strs[] = {\n", idx);
+		put_strs(idx, ti, ti->strs, ti->strs_count);
+		printf("};\n");
+	}
+	if (ti->ext_nums_count) {
+		printf("static const int32_t ti_bi%d_ext_nums[] = {", idx);
+		put_ints(ti->ext_nums, ti->ext_nums_count);
+		printf("};\n");
+	}
+	if (ti->ext_strs_count) {
+		printf("static char * const ti_bi%d_ext_strs[] = {\n", idx);
+		put_strs(idx, ti, ti->ext_strs, ti->ext_strs_count);
+		printf("};\n");
+	}
+	if (ti->ext_names_count) {
+		printf("static char * const ti_bi%d_ext_names[] = {\n", idx);
+		put_strs(idx, ti, ti->ext_names, ti->ext_names_count);
+		printf("};\n");
+		printf("static const uint16_t ti_bi%d_ext_hash[] = {", idx);
+		put_shorts(ti->ext_hash, ti->ext_hash_mask + 1);
+		printf("};\n");
+	}
+
+	int nb = ti->ext_bools_count, nn = ti->ext_nums_count;
+	printf("static const ti_terminfo ti_bi%d = {\n", idx);
+	printf("\t.term_names      = TI_BI_STR(%d, %d),\n", idx,
+	       (int)(ti->term_names - ti->data));
+	printf("\t.bools           = (int8_t *)TI_BI_STR(%d, %d),\n", idx,
+	       (int)((char *)ti->bools - ti->data));
+	if (ti->nums_count)
+		printf("\t.nums            = (int32_t *)ti_bi%d_nums,\n", idx);
+	if (ti->strs_count)
+		printf("\t.strs            = (char **)ti_bi%d_strs,\n", idx);
+	printf("\t.bools_count     = %d,\n", ti->bools_count);
+	printf("\t.nums_count      = %d,\n", ti->nums_count);
+	printf("\t.strs_count      = %d,\n", ti->strs_count);
+	if (ti->ext_names_count) {
+		printf("\t.ext_bools       = (int8_t *)TI_BI_STR(%d, %d),\n",
+		       idx, (int)((char *)ti->ext_bools - ti->data));
+		if (nn)
+			printf("\t.ext_nums        = (int32_t *)ti_bi%d_ext_nums,\n",
+			       idx);
+		if (ti->ext_strs_count)
+			printf("\t.ext_strs        = (char **)ti_bi%d_ext_strs,\n",
+			       idx);
+		printf("\t.ext_bool_names  = (char **)ti_bi%d_ext_names,\n", idx);
+		printf("\t.ext_num_names   = (char **)ti_bi%d_ext_names + %d,\n",
+		       idx, nb);
+		printf("\t.ext_str_names   = (char **)ti_bi%d_ext_names + %d,\n",
+		       idx, nb + nn);
+		printf("\t.ext_bools_count = %d,\n", nb);
+		printf("\t.ext_nums_count  = %d,\n", nn);
+		printf("\t.ext_strs_count  = %d,\n", ti->ext_strs_count);
+		printf("\t.ext_names       = (char **)ti_bi%d_ext_names,\n", idx);
+		printf("\t.ext_names_count = %d,\n", ti->ext_names_count);
+		printf("\t.ext_hash        = (uint16_t *)ti_bi%d_ext_hash,\n", idx);
+		printf("\t.ext_hash_mask   = %u,\n", ti->ext_hash_mask);
+	}
+	printf("\t.data            = (char *)ti_bi%d_data,\n", idx);
+	printf("\t.len             = %d,\n", ti->len);
+	printf("\t.numsz           = %d,\n", ti->numsz);
+	printf("\t.flags           = TI_F_STATIC,\n");
+	printf("};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 2 || strcmp(argv[1], "--help") == 0) {
+		fprintf(stderr, "Usage: %s <term>... >ti_builtin.inl\n", argv[0]);
+		return 2;
+	}
+
+	printf("/*\n");
+	printf(" * Builtin terminfo entries generated by tools/gencap-builtin:\n");
+	printf(" *");
+	for (int i = 1; i < argc; i++) printf(" %s", argv[i]);
+	printf("\n *\n");
+	printf(" */\n\n");
+	printf("#define TI_BI_STR(idx, off) ((char *)ti_bi##idx##_data + off)\n\n");
+
+	for (int i = 1; i < argc; i++) {
+		int err;
+		ti_terminfo *ti = ti_load(argv[i], &err);
+		if (!ti) {
+			fprintf(stderr, "error: %s: %s\n", argv[i], ti_strerror(err));
+			return 1;
+		}
+		put_term(i - 1, ti);
+		ti_free(ti);
+	}
+
+	printf("static const ti_terminfo * const ti_builtins[] = {\n");
+	for (int i = 1; i < argc; i++) {
+		printf("\t&ti_bi%d,\n", i - 1);
+	}
+	printf("\tNULL\n");
+	printf("};\n\n");
+	printf("#undef TI_BI_STR\n");
+
+	return 0;
+}
+
+// vim: noexpandtab
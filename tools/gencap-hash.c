@@ -0,0 +1,126 @@
+/*
+ *
+ * gencap-hash.c - Generate a perfect hash of terminfo capability names.
+ * Copyright (c) 2020, Auxrelius I <aux01@aux.life>
+ *
+ * Usage: tools/gencap-hash <caps.txt
+ *
+ * Reads "<bool|num|str> <capname>" lines in Caps file order and writes the
+ * ti_caphash_disp and ti_caphash_slots tables used by ti.c to find the index
+ * of a standard capability name. See tools/gencap-hash.sh.
+ *
+ * Names are split into TI_CAPHASH_BUCKETS buckets by their FNV-1a hash. Each
+ * bucket gets a displacement, tried in order from zero, that places all of
+ * its names in free slots of a TI_CAPHASH_SLOTS table. Large buckets are
+ * placed first while the table is still mostly empty.
+ *
+ *
+ */
+
+#include "../ti.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_NAMES 1024
+
+struct cap {
+	char     name[32];
+	int      type;
+	int      index;
+	uint32_t hash;
+};
+
+static struct cap caps[MAX_NAMES];
+static int ncaps;
+
+static int bucket_size[TI_CAPHASH_BUCKETS];
+static int bucket_order[TI_CAPHASH_BUCKETS];
+static uint16_t disp[TI_CAPHASH_BUCKETS];
+static uint16_t slots[TI_CAPHASH_SLOTS];
+
+static int by_size(const void *a, const void *b) {
+	return bucket_size[*(const int *)b] - bucket_size[*(const int *)a];
+}
+
+// Try to place every name in bucket b with displacement d.
+static int place(int b, uint16_t d) {
+	int placed[MAX_NAMES], n = 0;
+	for (int i = 0; i < ncaps; i++) {
+		if ((caps[i].hash & (TI_CAPHASH_BUCKETS - 1)) != (uint32_t)b) continue;
+		uint32_t slot = ti_hashmix(caps[i].hash ^ d) & (TI_CAPHASH_SLOTS - 1);
+		if (slots[slot]) break;
+		slots[slot] = (caps[i].type << 12) | caps[i].index;
+		placed[n++] = slot;
+		if (n == bucket_size[b]) return 1;
+	}
+	while (n--) slots[placed[n]] = 0;
+	return 0;
+}
+
+static void put_table(const char *decl, const uint16_t *v, int n) {
+	printf("%s = {", decl);
+	for (int i = 0; i < n; i++) {
+		printf("%s0x%04x,", (i % 8) ? " " : "\n\t", v[i]);
+	}
+	printf("\n};\n");
+}
+
+int main(int argc, char *argv[]) {
+	if (argc > 1) {
+		fprintf(stderr, "Usage: %s <caps.txt\n", argv[0]);
+		return 2;
+	}
+
+	char type[8], name[32];
+	int counts[4] = {0};
+	while (scanf("%7s %31s", type, name) == 2) {
+		int t = strcmp(type, "bool") == 0 ? TI_BOOL :
+		        strcmp(type, "num") == 0 ? TI_NUM :
+		        strcmp(type, "str") == 0 ? TI_STR : 0;
+		if (!t) continue;
+		if (ncaps == MAX_NAMES) {
+			fprintf(stderr, "error: too many names\n");
+			return 1;
+		}
+		for (int i = 0; i < ncaps; i++) {
+			if (strcmp(caps[i].name, name) == 0) {
+				fprintf(stderr, "error: duplicate name: %s\n", name);
+				return 1;
+			}
+		}
+		struct cap *c = &caps[ncaps++];
+		strcpy(c->name, name);
+		c->type = t;
+		c->index = counts[t]++;
+		c->hash = ti_strhash(name);
+		bucket_size[c->hash & (TI_CAPHASH_BUCKETS - 1)]++;
+	}
+
+	for (int b = 0; b < TI_CAPHASH_BUCKETS; b++) bucket_order[b] = b;
+	qsort(bucket_order, TI_CAPHASH_BUCKETS, sizeof(int), by_size);
+
+	for (int i = 0; i < TI_CAPHASH_BUCKETS; i++) {
+		int b = bucket_order[i];
+		if (!bucket_size[b]) break;
+		uint32_t d = 0;
+		while (d <= 0xffff && !place(b, d)) d++;
+		if (d > 0xffff) {
+			fprintf(stderr, "error: no displacement for bucket %d\n", b);
+			return 1;
+		}
+		disp[b] = d;
+	}
+
+	printf("// Capability name hash tables generated with tools/gencap-hash.sh\n");
+	printf("// from %d names (%d bool, %d num, %d str)\n",
+	       ncaps, counts[TI_BOOL], counts[TI_NUM], counts[TI_STR]);
+	put_table("static const uint16_t ti_caphash_disp[TI_CAPHASH_BUCKETS]",
+	          disp, TI_CAPHASH_BUCKETS);
+	put_table("static const uint16_t ti_caphash_slots[TI_CAPHASH_SLOTS]",
+	          slots, TI_CAPHASH_SLOTS);
+
+	return 0;
+}
+
+// vim: noexpandtab
@@ -0,0 +1,34 @@
+#!/bin/sh
+#/ Usage: gencap-hash.sh [<url>]
+#/ Generates the perfect hash tables ti.c uses to find standard terminfo
+#/ capabilities by name, using the latest ncurses Caps database published to
+#/ the ThomasDickey/ncurses-snapshots repository on GitHub, or a custom URL
+#/ if provided. Names are hashed in the same order as gencap-names.sh lists
+#/ them, so regenerate both together.
+set -eu
+
+# Show usage
+if [ $# -gt 0 ] && [ "$1" = "--help" ]; then
+    grep <"$0" '^#/' | cut -c4-
+    exit
+fi
+
+# URL of raw ncurses Caps file
+url="${1:-https://raw.githubusercontent.com/ThomasDickey/ncurses-snapshots/master/include/Caps}"
+
+# Use local Caps file if it exists
+if [ $# -eq 0 -a -f "Caps" ]; then
+    fetch="cat Caps"
+else
+    fetch="curl -sS '$url'"
+fi
+
+# Build the hash table generator
+dir=$(dirname "$0")
+make -s "$dir/gencap-hash" >&2
+
+# Fetch file and emit "<type> <capname>" lines
+eval "$fetch" |
+    grep -v -e "^#" |
+    awk '{print $3" "$2}' |
+    "$dir/gencap-hash"
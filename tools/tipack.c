@@ -0,0 +1,268 @@
+/*
+ *
+ * tipack.c - Pack a terminfo directory into a single database file.
+ * Copyright (c) 2020, Auxrelius I <aux01@aux.life>
+ *
+ * Usage: tools/tipack <terminfo-dir> <output-file>
+ *
+ * Reads every terminfo file under the letter (x/xterm) and hex (78/xterm)
+ * subdirectories of terminfo-dir and writes a packed database that ti.c can
+ * search with one hash probe. Names linking to the same file share one copy
+ * of its data. Point TERMINFO or a TERMINFO_DIRS entry at the output file to
+ * use it; see "Packed terminfo databases" in ti.c for the format.
+ *
+ * The database is written to a temporary file and renamed into place so
+ * programs that have the old one mapped keep a consistent view of it.
+ *
+ *
+ */
+
+#define _XOPEN_SOURCE 700    // dirent, stat members
+
+#include "../ti.c"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Unique terminfo file.
+struct blob {
+	dev_t    dev;
+	ino_t    ino;
+	char    *data;
+	int      len;
+	uint32_t off;
+};
+
+// Terminal name pointing at a blob.
+struct name {
+	char    *name;
+	int      blob;
+	uint32_t hash;
+	uint32_t off;
+};
+
+static struct blob *blobs;
+static int nblobs;
+static struct name *names;
+static int nnames;
+
+static void *grow(void *p, int n, size_t size) {
+	// grow arrays in powers of two
+	if (n & (n - 1)) return p;
+	p = realloc(p, (n ? n * 2 : 16) * size);
+	if (!p) {
+		fprintf(stderr, "error: out of memory\n");
+		exit(1);
+	}
+	return p;
+}
+
+// Hash sets of name and blob indices + 1, 0 for empty slots, kept at most
+// half full so packing stays linear in the number of files.
+static int *name_set, *blob_set;
+static uint32_t set_mask;
+
+static uint32_t blob_hash(dev_t dev, ino_t ino) {
+	uint64_t key = ((uint64_t)dev * 0x9e3779b97f4a7c15ull) ^ (uint64_t)ino;
+	key *= 0x9e3779b97f4a7c15ull;
+	return (uint32_t)(key >> 32);
+}
+
+static void set_insert(int *set, uint32_t hash, int i) {
+	uint32_t j = hash & set_mask;
+	while (set[j]) j = (j + 1) & set_mask;
+	set[j] = i + 1;
+}
+
+// Make room for one more name and blob.
+static void grow_sets(void) {
+	if (name_set && (uint32_t)(nnames + 1) * 2 <= set_mask + 1) return;
+	set_mask = set_mask ? set_mask * 2 + 1 : 63;
+	free(name_set);
+	free(blob_set);
+	name_set = calloc(set_mask + 1, sizeof(int));
+	blob_set = calloc(set_mask + 1, sizeof(int));
+	if (!name_set || !blob_set) {
+		fprintf(stderr, "error: out of memory\n");
+		exit(1);
+	}
+	for (int i = 0; i < nnames; i++) {
+		set_insert(name_set, names[i].hash, i);
+	}
+	for (int i = 0; i < nblobs; i++) {
+		set_insert(blob_set, blob_hash(blobs[i].dev, blobs[i].ino), i);
+	}
+}
+
+static int have_name(const char *name, uint32_t hash) {
+	for (uint32_t j = hash & set_mask; name_set[j]; j = (j + 1) & set_mask) {
+		struct name *n = &names[name_set[j] - 1];
+		if (n->hash == hash && strcmp(n->name, name) == 0) return 1;
+	}
+	return 0;
+}
+
+// Index of the blob read from the file dev and ino identify, or -1.
+static int find_blob(dev_t dev, ino_t ino) {
+	uint32_t j = blob_hash(dev, ino) & set_mask;
+	for (; blob_set[j]; j = (j + 1) & set_mask) {
+		struct blob *b = &blobs[blob_set[j] - 1];
+		if (b->dev == dev && b->ino == ino) return blob_set[j] - 1;
+	}
+	return -1;
+}
+
+// Add the terminfo file at fn under the given name unless the name was seen
+// in another subdirectory already. Files already read under another name
+// are only stat'ed.
+static void add_file(const char *fn, const char *name) {
+	grow_sets();
+	uint32_t hash = ti_strhash(name);
+	if (have_name(name, hash)) return;
+
+	struct stat st;
+	if (stat(fn, &st) != 0) {
+		fprintf(stderr, "warning: %s: %s\n", fn, strerror(errno));
+		return;
+	}
+	int b = find_blob(st.st_dev, st.st_ino);
+	if (b < 0) {
+		struct ti_file f = {0};
+		int rc = ti_read_file(&f, fn);
+		if (rc) {
+			fprintf(stderr, "warning: %s: %s\n", fn, strerror(rc));
+			return;
+		}
+
+		// skip files that aren't compiled terminfo entries
+		if (f.len < 2 || (ti_rd16(f.data) != TI_MAGIC &&
+		                  ti_rd16(f.data) != TI_MAGIC_32BIT)) {
+			ti_file_free(&f);
+			return;
+		}
+
+		blobs = grow(blobs, nblobs, sizeof(struct blob));
+		blobs[nblobs] = (struct blob){f.dev, f.ino, f.data, f.len, 0};
+		set_insert(blob_set, blob_hash(f.dev, f.ino), nblobs);
+		b = nblobs++;
+	}
+
+	names = grow(names, nnames, sizeof(struct name));
+	names[nnames] = (struct name){strdup(name), b, hash, 0};
+	set_insert(name_set, hash, nnames);
+	nnames++;
+}
+
+static void scan_dir(const char *dir) {
+	DIR *top = opendir(dir);
+	if (!top) {
+		fprintf(stderr, "error: %s: %s\n", dir, strerror(errno));
+		exit(1);
+	}
+
+	struct dirent *sub;
+	while ((sub = readdir(top))) {
+		if (sub->d_name[0] == '.') continue;
+
+		char path[TI_FN_MAX];
+		snprintf(path, sizeof(path), "%s/%s", dir, sub->d_name);
+		DIR *d = opendir(path);
+		if (!d) continue;
+
+		struct dirent *e;
+		while ((e = readdir(d))) {
+			if (e->d_name[0] == '.') continue;
+			char fn[TI_FN_MAX + 256];
+			snprintf(fn, sizeof(fn), "%s/%s", path, e->d_name);
+			add_file(fn, e->d_name);
+		}
+		closedir(d);
+	}
+	closedir(top);
+}
+
+static void put32(FILE *out, uint32_t v) {
+	unsigned char b[4] = {v, v >> 8, v >> 16, v >> 24};
+	fwrite(b, 1, 4, out);
+}
+
+static void write_db(FILE *out) {
+	uint32_t nslots = 2;
+	while (nslots < (uint32_t)nnames * 2) nslots <<= 1;
+
+	// lay out blob data, then names, after the slot table
+	uint32_t off = TI_DB_HDRSZ + nslots * TI_DB_SLOTSZ;
+	for (int i = 0; i < nblobs; i++) {
+		blobs[i].off = off;
+		off += blobs[i].len;
+	}
+	for (int i = 0; i < nnames; i++) {
+		names[i].off = off;
+		off += strlen(names[i].name) + 1;
+	}
+
+	// place names in slots with linear probing
+	int *slots = malloc(nslots * sizeof(int));
+	if (!slots) {
+		fprintf(stderr, "error: out of memory\n");
+		exit(1);
+	}
+	for (uint32_t j = 0; j < nslots; j++) slots[j] = -1;
+	for (int i = 0; i < nnames; i++) {
+		uint32_t j = names[i].hash & (nslots - 1);
+		while (slots[j] >= 0) j = (j + 1) & (nslots - 1);
+		slots[j] = i;
+	}
+
+	fwrite(TI_DB_MAGIC, 1, 4, out);
+	put32(out, TI_DB_VERSION);
+	put32(out, nslots);
+	put32(out, nnames);
+	for (uint32_t j = 0; j < nslots; j++) {
+		if (slots[j] < 0) {
+			for (int k = 0; k < 4; k++) put32(out, 0);
+			continue;
+		}
+		struct name *n = &names[slots[j]];
+		put32(out, n->hash);
+		put32(out, n->off);
+		put32(out, blobs[n->blob].off);
+		put32(out, blobs[n->blob].len);
+	}
+	for (int i = 0; i < nblobs; i++) {
+		fwrite(blobs[i].data, 1, blobs[i].len, out);
+	}
+	for (int i = 0; i < nnames; i++) {
+		fwrite(names[i].name, 1, strlen(names[i].name) + 1, out);
+	}
+	free(slots);
+}
+
+int main(int argc, char *argv[]) {
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s <terminfo-dir> <output-file>\n", argv[0]);
+		return 2;
+	}
+
+	scan_dir(argv[1]);
+
+	char tmp[TI_FN_MAX];
+	snprintf(tmp, sizeof(tmp), "%s.tmp", argv[2]);
+	FILE *out = fopen(tmp, "wb");
+	if (!out) {
+		fprintf(stderr, "error: %s: %s\n", tmp, strerror(errno));
+		return 1;
+	}
+	write_db(out);
+	if (fclose(out) != 0 || rename(tmp, argv[2]) != 0) {
+		fprintf(stderr, "error: %s: %s\n", argv[2], strerror(errno));
+		remove(tmp);
+		return 1;
+	}
+
+	fprintf(stderr, "%s: %d names, %d entries\n", argv[2], nnames, nblobs);
+	return 0;
+}
+
+// vim: noexpandtab